@@ -14,6 +14,8 @@
 r"""
 Helper functions for serializing quantum tapes.
 """
+from itertools import product
+import struct
 from typing import List, Tuple
 import numpy as np
 from pennylane import (
@@ -41,6 +43,105 @@ pauli_name_map = {
     "Z": "PauliZ",
 }
 
+BINARY_CIRCUIT_MAGIC = b"PLBC"
+BINARY_CIRCUIT_VERSION = (1, 0)
+_binary_header = struct.Struct("<4sHH6IQ")
+_binary_section = struct.Struct("<QQ")
+
+
+def _binary_offsets(lengths) -> np.ndarray:
+    """Offsets of consecutive arrays with the given lengths, starting at zero."""
+    return np.cumsum([0, *lengths], dtype="<u4")
+
+
+def pack_binary_circuit(num_qubits: int, operations: List, observables: List) -> bytes:
+    """Pack operations and observables into a binary circuit.
+
+    The layout matches ``BinaryCircuit.hpp``: a header, a table of sections and the arrays
+    of the sections, each aligned to 8 bytes.
+
+    Args:
+        num_qubits (int): number of qubits of the circuit
+        operations (list): ``(name, wires, params, inverse, matrix)`` tuples, where the matrix
+            is empty for the operations applied from their name
+        observables (list): lists of ``(coeff, factors)`` terms, where each factor is a
+            ``(name, wires, matrix)`` tuple
+
+    Returns:
+        bytes: the binary circuit
+    """
+    names = {}
+    factors = [f for obs in observables for _, term in obs for f in term]
+    items = [(op[0], op[1], op[4]) for op in operations] + factors
+
+    def name_index(name):
+        return names.setdefault(name, len(names))
+
+    item_names = [
+        name_index(name) | (1 << 31 if inverse else 0)
+        for name, _, _, inverse, _ in operations
+    ] + [name_index(name) for name, _, _ in factors]
+    encoded_names = [name.encode() for name in names]
+    wires = [np.asarray(w, dtype="<u4").ravel() for _, w, _ in items]
+    matrices = [np.asarray(m, dtype="<c16").ravel() for _, _, m in items]
+    params = [np.asarray(op[2], dtype="<f8").ravel() for op in operations]
+    terms = [term for obs in observables for term in obs]
+
+    sections = [
+        _binary_offsets(len(n) for n in encoded_names),
+        np.frombuffer(b"".join(encoded_names), dtype=np.uint8),
+        np.array(item_names, dtype="<u4"),
+        _binary_offsets(len(w) for w in wires),
+        np.concatenate([np.empty(0, dtype="<u4"), *wires]),
+        _binary_offsets(len(p) for p in params),
+        np.concatenate([np.empty(0, dtype="<f8"), *params]),
+        _binary_offsets(len(m) for m in matrices),
+        np.concatenate([np.empty(0, dtype="<c16"), *matrices]),
+        _binary_offsets(len(obs) for obs in observables),
+        np.array([coeff for coeff, _ in terms], dtype="<f8"),
+        _binary_offsets(len(term) for _, term in terms),
+    ]
+
+    def align(offset):
+        return (offset + 7) & ~7
+
+    table = []
+    size = _binary_header.size + len(sections) * _binary_section.size
+    for section in sections:
+        size = align(size)
+        table.append((size, section.size))
+        size += section.nbytes
+    size = align(size)
+
+    buffer = bytearray(size)
+    _binary_header.pack_into(
+        buffer,
+        0,
+        BINARY_CIRCUIT_MAGIC,
+        *BINARY_CIRCUIT_VERSION,
+        num_qubits,
+        len(operations),
+        len(observables),
+        len(terms),
+        len(factors),
+        len(sections),
+        size,
+    )
+    for idx, ((offset, count), section) in enumerate(zip(table, sections)):
+        _binary_section.pack_into(
+            buffer, _binary_header.size + idx * _binary_section.size, offset, count
+        )
+        buffer[offset : offset + section.nbytes] = section.tobytes()
+    return bytes(buffer)
+
+
+def is_basis_state_projector(observable) -> bool:
+    """Whether an observable is a projector onto a computational basis state, as opposed to a
+    projector onto an arbitrary state vector."""
+    return observable.name == "Projector" and len(observable.parameters[0]) == len(
+        observable.wires
+    )
+
 
 class QuantumScriptSerializer:
     """Serializer class for `pennylane.tape.QuantumScript` data.
@@ -90,6 +191,9 @@ class QuantumScriptSerializer:
         self.hamiltonian_c128 = lightning_ops.observables.HamiltonianC128
         self.sparse_hamiltonian_c64 = lightning_ops.observables.SparseHamiltonianC64
         self.sparse_hamiltonian_c128 = lightning_ops.observables.SparseHamiltonianC128
+        # Native projectors are not available on every backend
+        self.projector_obs_c64 = getattr(lightning_ops.observables, "ProjectorObsC64", None)
+        self.projector_obs_c128 = getattr(lightning_ops.observables, "ProjectorObsC128", None)
 
         self._use_mpi = use_mpi
 
@@ -167,6 +271,14 @@ class QuantumScriptSerializer:
             )
         return self.sparse_hamiltonian_c64 if self.use_csingle else self.sparse_hamiltonian_c128
 
+    @property
+    def projector_obs(self):
+        """Projector observable matching ``use_csingle`` precision, or ``None`` if the backend
+        has no native projector."""
+        if self._use_mpi:
+            return None
+        return self.projector_obs_c64 if self.use_csingle else self.projector_obs_c128
+
     def _named_obs(self, observable, wires_map: dict):
         """Serializes a Named observable"""
         wires = [wires_map[w] for w in observable.wires]
@@ -181,6 +293,12 @@ class QuantumScriptSerializer:
         wires = [wires_map[w] for w in observable.wires]
         return self.hermitian_obs(matrix(observable).ravel().astype(self.ctype), wires)
 
+    def _projector(self, observable, wires_map: dict):
+        """Serializes a projector onto a computational basis state"""
+        wires = [wires_map[w] for w in observable.wires]
+        state = [int(bit) for bit in np.ravel(unwrap(observable.parameters[0]))]
+        return self.projector_obs(state, wires)
+
     def _tensor_ob(self, observable, wires_map: dict):
         """Serialize a tensor observable"""
         assert isinstance(observable, Tensor)
@@ -220,6 +338,9 @@ class QuantumScriptSerializer:
         wires_list = observable.wires.tolist()
         wires.extend([wires_map[w] for w in wires_list])
 
+        if self.device_name == "lightning.qubit":
+            # The observable is Hermitian, so only its upper triangle is stored
+            return self.sparse_hamiltonian_obs(data, indices, offsets, wires, upper_triangle=True)
         return self.sparse_hamiltonian_obs(data, indices, offsets, wires)
 
     def _pauli_word(self, observable, wires_map: dict):
@@ -253,6 +374,8 @@ class QuantumScriptSerializer:
             return self._sparse_hamiltonian(observable, wires_map)
         if isinstance(observable, (PauliX, PauliY, PauliZ, Identity, Hadamard)):
             return self._named_obs(observable, wires_map)
+        if is_basis_state_projector(observable) and self.projector_obs is not None:
+            return self._projector(observable, wires_map)
         if observable._pauli_rep is not None:
             return self._pauli_sentence(observable._pauli_rep, wires_map)
         return self._hermitian_ob(observable, wires_map)
@@ -312,6 +435,10 @@ class QuantumScriptSerializer:
                 if name == "QubitUnitary":
                     params.append([0.0])
                     mats.append(matrix(single_op))
+                elif name == "GroverOperator" and hasattr(self.sv_type, "applyGroverOperator"):
+                    # Applied natively from its wires, without building its matrix
+                    params.append([])
+                    mats.append([])
                 elif not hasattr(self.sv_type, name):
                     params.append([])
                     mats.append(matrix(single_op))
@@ -324,3 +451,67 @@ class QuantumScriptSerializer:
 
         inverses = [False] * len(names)
         return (names, params, wires, inverses, mats), uses_stateprep
+
+    def _binary_terms(self, observable, wires_map: dict) -> List:
+        """Flatten an observable into the ``(coeff, factors)`` terms of a binary circuit."""
+        # pylint: disable=protected-access
+        if isinstance(observable, Tensor):
+            terms = [(1.0, [])]
+            for obs in observable.obs:
+                terms = [
+                    (coeff * sub_coeff, factors + sub_factors)
+                    for (coeff, factors), (sub_coeff, sub_factors) in product(
+                        terms, self._binary_terms(obs, wires_map)
+                    )
+                ]
+            return terms
+        if observable.name == "Hamiltonian":
+            return [
+                (float(coeff) * sub_coeff, factors)
+                for coeff, op in zip(unwrap(observable.coeffs), observable.ops)
+                for sub_coeff, factors in self._binary_terms(op, wires_map)
+            ]
+        if observable.name == "SparseHamiltonian":
+            raise DeviceError("Binary circuits do not support SparseHamiltonian observables.")
+        if isinstance(observable, (PauliX, PauliY, PauliZ, Identity, Hadamard)):
+            wires = [wires_map[w] for w in observable.wires]
+            if observable.name == "Identity":
+                wires = wires[:1]
+            return [(1.0, [(observable.name, wires, [])])]
+        if observable._pauli_rep is not None:
+            return [
+                (
+                    float(np.real(coeff)),
+                    [(pauli_name_map[p], [wires_map[w]], []) for w, p in pword.items()]
+                    or [("Identity", [0], [])],
+                )
+                for pword, coeff in observable._pauli_rep.items()
+            ]
+        wires = [wires_map[w] for w in observable.wires]
+        return [(1.0, [("Hermitian", wires, matrix(observable))])]
+
+    def serialize_binary(self, tape: QuantumTape, wires_map: dict) -> Tuple[bytes, bool]:
+        """Serializes the operations and observables of an input tape into a binary circuit.
+
+        A binary circuit is a flat buffer, which the C++ backends read in place without
+        parsing it. It can be written to a file and memory-mapped.
+
+        Args:
+            tape (QuantumTape): the input quantum tape
+            wires_map (dict): a dictionary mapping input wires to the device's backend wires
+
+        Returns:
+            Tuple[bytes, bool]: the binary circuit, and whether the tape prepares a state,
+            which is not included in the binary circuit
+        """
+        (names, params, wires, inverses, mats), uses_stateprep = self.serialize_ops(
+            tape, wires_map
+        )
+        operations = [
+            (name, op_wires, [float(unwrap(p)) for p in op_params], inverse, mat)
+            for name, op_params, op_wires, inverse, mat in zip(
+                names, params, wires, inverses, mats
+            )
+        ]
+        observables = [self._binary_terms(obs, wires_map) for obs in tape.observables]
+        return pack_binary_circuit(len(wires_map), operations, observables), uses_stateprep
@@ -409,6 +409,26 @@ void registerBackendAgnosticObservables(py::module_ &m) {
             "Compare two observables");
 }
 
+/**
+ * @brief Flatten per-partition results of equal size into a row-major 2D numpy
+ * array with one row per partition.
+ *
+ * @tparam T Datatype of the results.
+ * @param partitions Results for each partition.
+ */
+template <class T>
+auto createNumpyArrayFromPartitions(
+    const std::vector<std::vector<T>> &partitions) -> py::array_t<T> {
+    const size_t num_cols = partitions.empty() ? 0 : partitions[0].size();
+    std::vector<T> data;
+    data.reserve(partitions.size() * num_cols);
+    for (const auto &partition : partitions) {
+        data.insert(data.end(), partition.begin(), partition.end());
+    }
+    return createNumpyArrayFromVector(std::move(data), partitions.size(),
+                                      num_cols);
+}
+
 /**
  * @brief Register agnostic measurements class functionalities.
  *
@@ -426,11 +446,11 @@ void registerBackendAgnosticMeasurements(PyClass &pyclass) {
         .def("probs",
              [](Measurements<StateVectorT> &M,
                 const std::vector<size_t> &wires) {
-                 return py::array_t<ParamT>(py::cast(M.probs(wires)));
+                 return createNumpyArrayFromVector(M.probs(wires));
              })
         .def("probs",
              [](Measurements<StateVectorT> &M) {
-                 return py::array_t<ParamT>(py::cast(M.probs()));
+                 return createNumpyArrayFromVector(M.probs());
              })
         .def(
             "expval",
@@ -439,6 +459,51 @@ void registerBackendAgnosticMeasurements(PyClass &pyclass) {
                 return M.expval(*ob);
             },
             "Expected value of an observable object.")
+        .def(
+            "expval_shot_vector",
+            [](Measurements<StateVectorT> &M,
+               const std::shared_ptr<Observable<StateVectorT>> &ob,
+               const std::vector<size_t> &shot_vector) {
+                return createNumpyArrayFromVector(
+                    M.expval_shot_vector(*ob, shot_vector));
+            },
+            "Expected value of an observable object for each partition of a "
+            "shot vector, from a single draw.")
+        .def(
+            "expval_adaptive",
+            [](Measurements<StateVectorT> &M,
+               const std::shared_ptr<Observable<StateVectorT>> &ob,
+               size_t num_shots, ParamT pilot_fraction) {
+                auto estimate = M.expval_adaptive(*ob, num_shots,
+                                                  pilot_fraction);
+                return py::make_tuple(
+                    estimate.value, estimate.std_error,
+                    createNumpyArrayFromVector(std::move(estimate.shots)));
+            },
+            py::arg("ob"), py::arg("num_shots"),
+            py::arg("pilot_fraction") = 0.1,
+            "Expected value of an observable object within a shot budget, "
+            "allocating the shots of Hamiltonian terms by their estimated "
+            "variance. Returns the estimate, its standard error and the shots "
+            "spent on each term.")
+        .def(
+            "probs_shot_vector",
+            [](Measurements<StateVectorT> &M, const std::vector<size_t> &wires,
+               const std::vector<size_t> &shot_vector) {
+                return createNumpyArrayFromPartitions(
+                    M.probs_shot_vector(wires, shot_vector));
+            },
+            "Estimated probabilities of the given wires for each partition of "
+            "a shot vector, from a single draw.")
+        .def(
+            "counts_shot_vector",
+            [](Measurements<StateVectorT> &M, const std::vector<size_t> &wires,
+               const std::vector<size_t> &shot_vector) {
+                return createNumpyArrayFromPartitions(
+                    M.counts_shot_vector(wires, shot_vector));
+            },
+            "Outcome counts of the given wires for each partition of a shot "
+            "vector, from a single draw.")
         .def(
             "var",
             [](Measurements<StateVectorT> &M,
@@ -446,23 +511,13 @@ void registerBackendAgnosticMeasurements(PyClass &pyclass) {
                 return M.var(*ob);
             },
             "Variance of an observable object.")
-        .def("generate_samples", [](Measurements<StateVectorT> &M,
-                                    size_t num_wires, size_t num_shots) {
-            auto &&result = M.generate_samples(num_shots);
-            const size_t ndim = 2;
-            const std::vector<size_t> shape{num_shots, num_wires};
-            constexpr auto sz = sizeof(size_t);
-            const std::vector<size_t> strides{sz * num_wires, sz};
-            // return 2-D NumPy array
-            return py::array(py::buffer_info(
-                result.data(), /* data as contiguous array  */
-                sz,            /* size of one scalar        */
-                py::format_descriptor<size_t>::format(), /* data type */
-                ndim,   /* number of dimensions      */
-                shape,  /* shape of the matrix       */
-                strides /* strides for each axis     */
-                ));
-        });
+        .def("generate_samples",
+             [](Measurements<StateVectorT> &M, size_t num_wires,
+                size_t num_shots) {
+                 // return 2-D NumPy array
+                 return createNumpyArrayFromVector(
+                     M.generate_samples(num_shots), num_shots, num_wires);
+             });
 }
 
 /**
@@ -485,7 +540,30 @@ auto registerAdjointJacobian(
                                         operations,
                                         trainableParams};
     adjoint_jacobian.adjointJacobian(std::span{jac}, jd, sv);
-    return py::array_t<PrecisionT>(py::cast(jac));
+    return createNumpyArrayFromVector(std::move(jac));
+}
+
+/**
+ * @brief Register the adjoint Jacobian method writing into a preallocated
+ * array.
+ */
+template <class StateVectorT>
+void registerAdjointJacobianOut(
+    AdjointJacobian<StateVectorT> &adjoint_jacobian, const StateVectorT &sv,
+    const std::vector<std::shared_ptr<Observable<StateVectorT>>> &observables,
+    const OpsData<StateVectorT> &operations,
+    const std::vector<size_t> &trainableParams,
+    py::array_t<typename StateVectorT::PrecisionT, py::array::c_style> &out) {
+    auto jac =
+        getOutputSpan(out, observables.size() * trainableParams.size());
+    std::fill(jac.begin(), jac.end(), 0);
+    const JacobianData<StateVectorT> jd{operations.getTotalNumParams(),
+                                        sv.getLength(),
+                                        sv.getData(),
+                                        observables,
+                                        operations,
+                                        trainableParams};
+    adjoint_jacobian.adjointJacobian(jac, jd, sv);
 }
 
 /**
@@ -590,12 +668,16 @@ void registerBackendAgnosticAlgorithms(py::module_ &m) {
                     operations,
                     trainableParams};
                 adjoint_jacobian.batchAdjointJacobian(std::span{jac}, jd);
-                return py::array_t<PrecisionT>(py::cast(jac));
+                return createNumpyArrayFromVector(std::move(jac));
             },
             "Batch Adjoint Jacobian method.")
 #endif
         .def("__call__", &registerAdjointJacobian<StateVectorT>,
-             "Adjoint Jacobian method.");
+             "Adjoint Jacobian method.")
+        .def("__call__", &registerAdjointJacobianOut<StateVectorT>,
+             py::arg("sv"), py::arg("observables"), py::arg("operations"),
+             py::arg("trainableParams"), py::arg("out").noconvert(),
+             "Adjoint Jacobian method writing into a preallocated array.");
 }
 
 /**
@@ -12,22 +12,94 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #pragma once
+#include <algorithm>
 #include <set>
+#include <span>
 #include <sstream>
 #include <string>
 #include <tuple>
 #include <variant>
 #include <vector>
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
 #include "Constant.hpp"
 #include "ConstantUtil.hpp" // lookup
+#include "Error.hpp"
 #include "GateOperation.hpp"
 
 namespace py = pybind11;
 
 namespace Pennylane::Bindings {
+/**
+ * @brief Create a 1D numpy array taking ownership of a vector's storage.
+ *
+ * The vector is moved to the heap and released by the capsule attached to
+ * the returned array, so no element is copied.
+ *
+ * @tparam T Datatype of the vector.
+ * @tparam NumpyT Datatype of the array, layout-compatible with `T` (e.g.
+ * `std::complex` for `Kokkos::complex`).
+ * @param data Vector to hand over to numpy.
+ * @return Numpy array viewing the vector's data.
+ */
+template <class T, class NumpyT = T>
+auto createNumpyArrayFromVector(std::vector<T> &&data) -> py::array_t<NumpyT> {
+    static_assert(sizeof(T) == sizeof(NumpyT) && alignof(T) == alignof(NumpyT),
+                  "The vector and array datatypes must have the same layout.");
+    auto *vec = new std::vector<T>(std::move(data));
+    auto capsule = py::capsule(
+        vec, [](void *p) { delete static_cast<std::vector<T> *>(p); });
+    return py::array_t<NumpyT>({vec->size()}, {sizeof(NumpyT)},
+                               reinterpret_cast<NumpyT *>(vec->data()),
+                               capsule);
+}
+
+/**
+ * @brief Create a row-major 2D numpy array taking ownership of a vector's
+ * storage.
+ *
+ * @tparam T Datatype of the vector.
+ * @param data Vector of size `num_rows * num_cols` to hand over to numpy.
+ * @param num_rows Number of rows.
+ * @param num_cols Number of columns.
+ * @return Numpy array viewing the vector's data.
+ */
+template <class T>
+auto createNumpyArrayFromVector(std::vector<T> &&data, size_t num_rows,
+                                size_t num_cols) -> py::array_t<T> {
+    PL_ABORT_IF_NOT(data.size() == num_rows * num_cols,
+                    "The vector size does not match the array shape.");
+    auto *vec = new std::vector<T>(std::move(data));
+    auto capsule = py::capsule(
+        vec, [](void *p) { delete static_cast<std::vector<T> *>(p); });
+    return py::array_t<T>({num_rows, num_cols},
+                          {sizeof(T) * num_cols, sizeof(T)}, vec->data(),
+                          capsule);
+}
+
+/**
+ * @brief Get a writable view of a caller-provided output array.
+ *
+ * Output arguments must be bound with `py::arg(...).noconvert()`, otherwise
+ * pybind11 converts an array of another dtype or layout into a temporary and
+ * the results never reach the caller.
+ *
+ * @tparam T Datatype of the array.
+ * @param out C-contiguous numpy array receiving the results.
+ * @param size Expected number of elements.
+ * @return Span over the array's data.
+ */
+template <class T>
+auto getOutputSpan(py::array_t<T, py::array::c_style> &out, size_t size)
+    -> std::span<T> {
+    PL_ABORT_IF_NOT(out.writeable(), "The output array is read-only.");
+    PL_ABORT_IF_NOT(static_cast<size_t>(out.size()) == size,
+                    "The output array has the wrong size.");
+    return {out.mutable_data(), size};
+}
+
 /**
  * @brief Register matrix.
  */
@@ -42,6 +114,42 @@ void registerMatrix(
                    inverse);
 }
 
+/**
+ * @brief Register diagonal matrix.
+ */
+template <class StateVectorT>
+void registerDiagonal(
+    StateVectorT &st,
+    const py::array_t<std::complex<typename StateVectorT::PrecisionT>,
+                      py::array::c_style | py::array::forcecast> &diag,
+    const std::vector<size_t> &wires, bool inverse = false) {
+    using ComplexT = typename StateVectorT::ComplexT;
+    PL_ABORT_IF_NOT(diag.ndim() == 1 && static_cast<size_t>(diag.size()) ==
+                                            (size_t{1} << wires.size()),
+                    "The size of the diagonal does not match with the given "
+                    "number of wires");
+    st.applyDiagonal(static_cast<const ComplexT *>(diag.request().ptr), wires,
+                     inverse);
+}
+
+/**
+ * @brief Register reflection about a state.
+ */
+template <class StateVectorT>
+void registerReflection(
+    StateVectorT &st,
+    const py::array_t<std::complex<typename StateVectorT::PrecisionT>,
+                      py::array::c_style | py::array::forcecast> &state,
+    const std::vector<size_t> &wires) {
+    using ComplexT = typename StateVectorT::ComplexT;
+    PL_ABORT_IF_NOT(state.ndim() == 1 && static_cast<size_t>(state.size()) ==
+                                             (size_t{1} << wires.size()),
+                    "The size of the state does not match with the given "
+                    "number of wires");
+    st.applyReflection(static_cast<const ComplexT *>(state.request().ptr),
+                       wires);
+}
+
 /**
  * @brief Register StateVector class to pybind.
  *
@@ -49,9 +157,13 @@ void registerMatrix(
  * @tparam Pyclass Pybind11's class object type
  *
  * @param pyclass Pybind11's class object to bind statevector
+ * @param matrix_gates Gates the statevector only applies from their matrix.
+ * No method is bound for them, so that Python passes their matrix instead.
  */
 template <class StateVectorT, class PyClass>
-void registerGatesForStateVector(PyClass &pyclass) {
+void registerGatesForStateVector(
+    PyClass &pyclass,
+    const std::vector<Pennylane::Gates::GateOperation> &matrix_gates = {}) {
     using PrecisionT =
         typename StateVectorT::PrecisionT; // Statevector's precision
     using ParamT = PrecisionT;             // Parameter's data precision
@@ -63,8 +175,13 @@ void registerGatesForStateVector(PyClass &pyclass) {
     pyclass.def("applyMatrix", &registerMatrix<StateVectorT>,
                 "Apply a given matrix to wires.");
 
-    for_each_enum<GateOperation>([&pyclass](GateOperation gate_op) {
+    for_each_enum<GateOperation>([&pyclass,
+                                  &matrix_gates](GateOperation gate_op) {
         using Pennylane::Util::lookup;
+        if (std::find(matrix_gates.begin(), matrix_gates.end(), gate_op) !=
+            matrix_gates.end()) {
+            return;
+        }
         const auto gate_name =
             std::string(lookup(Constant::gate_names, gate_op));
         const std::string doc = "Apply the " + gate_name + " gate.";
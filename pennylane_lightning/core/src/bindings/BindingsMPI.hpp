@@ -256,11 +256,11 @@ void registerBackendAgnosticMeasurementsMPI(PyClass &pyclass) {
         .def("probs",
              [](MeasurementsMPI<StateVectorT> &M,
                 const std::vector<size_t> &wires) {
-                 return py::array_t<ParamT>(py::cast(M.probs(wires)));
+                 return createNumpyArrayFromVector(M.probs(wires));
              })
         .def("probs",
              [](MeasurementsMPI<StateVectorT> &M) {
-                 return py::array_t<ParamT>(py::cast(M.probs()));
+                 return createNumpyArrayFromVector(M.probs());
              })
         .def(
             "expval",
@@ -278,20 +278,9 @@ void registerBackendAgnosticMeasurementsMPI(PyClass &pyclass) {
             "Variance of an observable object.")
         .def("generate_samples", [](MeasurementsMPI<StateVectorT> &M,
                                     size_t num_wires, size_t num_shots) {
-            auto &&result = M.generate_samples(num_shots);
-            const size_t ndim = 2;
-            const std::vector<size_t> shape{num_shots, num_wires};
-            constexpr auto sz = sizeof(size_t);
-            const std::vector<size_t> strides{sz * num_wires, sz};
             // return 2-D NumPy array
-            return py::array(py::buffer_info(
-                result.data(), /* data as contiguous array  */
-                sz,            /* size of one scalar        */
-                py::format_descriptor<size_t>::format(), /* data type */
-                ndim,   /* number of dimensions      */
-                shape,  /* shape of the matrix       */
-                strides /* strides for each axis     */
-                ));
+            return createNumpyArrayFromVector(M.generate_samples(num_shots),
+                                              num_shots, num_wires);
         });
 }
 
@@ -312,7 +301,7 @@ auto registerAdjointJacobianMPI(
                                            observables, operations,
                                            trainableParams};
     adjoint_jacobian.adjointJacobian(std::span{jac}, jd, sv);
-    return py::array_t<PrecisionT>(py::cast(jac));
+    return createNumpyArrayFromVector(std::move(jac));
 }
 
 /**
@@ -412,7 +401,7 @@ void registerBackendAgnosticAlgorithmsMPI(py::module_ &m) {
                     operations.getTotalNumParams(), sv, observables, operations,
                     trainableParams};
                 adjoint_jacobian.adjointJacobian_serial(std::span{jac}, jd);
-                return py::array_t<PrecisionT>(py::cast(jac));
+                return createNumpyArrayFromVector(std::move(jac));
             },
             "Batch Adjoint Jacobian method.")
         .def("__call__", &registerAdjointJacobianMPI<StateVectorT>,
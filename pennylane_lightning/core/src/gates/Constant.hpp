@@ -26,7 +26,8 @@ namespace Pennylane::Gates::Constant {
 /**
  * @brief List of multi-qubit gates
  */
-[[maybe_unused]] constexpr std::array multi_qubit_gates{GateOperation::MultiRZ};
+[[maybe_unused]] constexpr std::array multi_qubit_gates{GateOperation::MultiRZ,
+                                                       GateOperation::QFT};
 /**
  * @brief List of multi-qubit generators
  */
@@ -38,6 +39,7 @@ namespace Pennylane::Gates::Constant {
  */
 [[maybe_unused]] constexpr std::array multi_qubit_matrix_ops{
     MatrixOperation::MultiQubitOp,
+    MatrixOperation::DiagonalOp,
 };
 
 /**
@@ -93,7 +95,8 @@ namespace Pennylane::Gates::Constant {
     std::pair<GateOperation, std::string_view>{
         GateOperation::DoubleExcitationPlus, "DoubleExcitationPlus"},
     std::pair<GateOperation, std::string_view>{GateOperation::MultiRZ,
-                                               "MultiRZ"}};
+                                               "MultiRZ"},
+    std::pair<GateOperation, std::string_view>{GateOperation::QFT, "QFT"}};
 /**
  * @brief Generator names.
  *
@@ -155,6 +158,8 @@ namespace Pennylane::Gates::Constant {
                                                  "TwoQubitOp"},
     std::pair<MatrixOperation, std::string_view>{MatrixOperation::MultiQubitOp,
                                                  "MultiQubitOp"},
+    std::pair<MatrixOperation, std::string_view>{MatrixOperation::DiagonalOp,
+                                                 "DiagonalOp"},
 };
 
 /**
@@ -266,5 +271,6 @@ namespace Pennylane::Gates::Constant {
     std::pair<GateOperation, size_t>{GateOperation::DoubleExcitationPlus, 1},
     std::pair<GateOperation, size_t>{GateOperation::CSWAP, 0},
     std::pair<GateOperation, size_t>{GateOperation::MultiRZ, 1},
+    std::pair<GateOperation, size_t>{GateOperation::QFT, 0},
 };
 } // namespace Pennylane::Gates::Constant
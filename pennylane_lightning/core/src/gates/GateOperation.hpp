@@ -65,6 +65,7 @@ enum class GateOperation : uint32_t {
     DoubleExcitationPlus,
     /* Multi-qubit gates */
     MultiRZ,
+    QFT,
     /* END (placeholder) */
     END
 };
@@ -106,6 +107,7 @@ enum class MatrixOperation : uint32_t {
     SingleQubitOp = 0,
     TwoQubitOp,
     MultiQubitOp,
+    DiagonalOp,
     /* END (placeholder) */
     END
 };
@@ -0,0 +1,325 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file GatePatterns.hpp
+ * Declares gates by their sparsity pattern, so that backend kernels can be
+ * generated from a single description of each gate.
+ *
+ * A gate pattern is a struct with
+ *  - `op`: the `GateOperation` it implements,
+ *  - `num_wires` and `num_params`,
+ *  - `entries`: the nonzero entries of its matrix, as (row, column) pairs
+ *    in the basis of the gate wires (`wires[0]` is the most significant bit),
+ *  - `coefficients<ComplexT, PrecisionT>(params...)`: the values of those
+ *    entries, in the same order.
+ *
+ * Rows missing from `entries` are left unchanged (identity). Kernels
+ * generated from a pattern only read and write the amplitudes of the rows
+ * that appear in `entries`, and apply the adjoint of the gate as the
+ * conjugate transpose of the pattern.
+ */
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include "GateOperation.hpp"
+
+namespace Pennylane::Gates::Pattern {
+/**
+ * @brief Nonzero entry of a gate matrix.
+ */
+struct Entry {
+    std::size_t row;
+    std::size_t col;
+};
+
+/// @cond DEV
+namespace Internal {
+/**
+ * @brief Flag the rows of a gate pattern.
+ */
+template <class GatePattern>
+constexpr auto activeMask()
+    -> std::array<bool, std::size_t{1} << GatePattern::num_wires> {
+    std::array<bool, std::size_t{1} << GatePattern::num_wires> mask{};
+    for (const auto &entry : GatePattern::entries) {
+        mask[entry.row] = true;
+    }
+    return mask;
+}
+
+template <class GatePattern> constexpr auto countActive() -> std::size_t {
+    std::size_t count = 0;
+    for (const bool active : activeMask<GatePattern>()) {
+        count += active ? 1 : 0;
+    }
+    return count;
+}
+
+template <class GatePattern> constexpr auto columnsAreActive() -> bool {
+    constexpr std::size_t dim = std::size_t{1} << GatePattern::num_wires;
+    const auto mask = activeMask<GatePattern>();
+    for (const auto &entry : GatePattern::entries) {
+        if (entry.row >= dim || entry.col >= dim || !mask[entry.col]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class GatePattern>
+constexpr auto activeIndices()
+    -> std::array<std::size_t, countActive<GatePattern>()> {
+    constexpr std::size_t dim = std::size_t{1} << GatePattern::num_wires;
+    std::array<std::size_t, countActive<GatePattern>()> indices{};
+    const auto mask = activeMask<GatePattern>();
+    std::size_t pos = 0;
+    for (std::size_t idx = 0; idx < dim; idx++) {
+        if (mask[idx]) {
+            indices[pos++] = idx;
+        }
+    }
+    return indices;
+}
+
+template <class GatePattern>
+constexpr auto localEntries()
+    -> std::array<Entry, GatePattern::entries.size()> {
+    constexpr std::size_t dim = std::size_t{1} << GatePattern::num_wires;
+    const auto indices = activeIndices<GatePattern>();
+    std::array<std::size_t, dim> position{};
+    for (std::size_t pos = 0; pos < indices.size(); pos++) {
+        position[indices[pos]] = pos;
+    }
+    std::array<Entry, GatePattern::entries.size()> local{};
+    for (std::size_t e = 0; e < local.size(); e++) {
+        local[e] = {position[GatePattern::entries[e].row],
+                    position[GatePattern::entries[e].col]};
+    }
+    return local;
+}
+} // namespace Internal
+/// @endcond
+
+/**
+ * @brief Compile-time properties of a gate pattern, used by the kernel
+ * generators.
+ *
+ * @tparam GatePattern Gate pattern declaration.
+ */
+template <class GatePattern> struct PatternTraits {
+    static_assert(Internal::columnsAreActive<GatePattern>(),
+                  "Every column of a gate pattern must also be one of its "
+                  "rows, otherwise the gate is not unitary.");
+
+    constexpr static std::size_t num_wires = GatePattern::num_wires;
+    constexpr static std::size_t nnz = GatePattern::entries.size();
+
+    /**
+     * @brief Number of amplitudes per block the gate reads and writes.
+     */
+    constexpr static std::size_t num_active =
+        Internal::countActive<GatePattern>();
+
+    /**
+     * @brief Indices (in the basis of the gate wires) of the amplitudes the
+     * gate reads and writes, in increasing order.
+     */
+    constexpr static std::array<std::size_t, num_active> active_indices =
+        Internal::activeIndices<GatePattern>();
+
+    /**
+     * @brief Entries of the pattern, with rows and columns given as
+     * positions in `active_indices`.
+     */
+    constexpr static std::array<Entry, nnz> local_entries =
+        Internal::localEntries<GatePattern>();
+};
+
+/**
+ * @brief SingleExcitation gate: a rotation between |01> and |10>.
+ */
+struct SingleExcitation {
+    constexpr static GateOperation op = GateOperation::SingleExcitation;
+    constexpr static std::size_t num_wires = 2;
+    constexpr static std::size_t num_params = 1;
+    constexpr static std::array<Entry, 4> entries{
+        {{0b01, 0b01}, {0b01, 0b10}, {0b10, 0b01}, {0b10, 0b10}}};
+
+    template <template <typename...> class ComplexT, typename PrecisionT>
+    static auto coefficients(PrecisionT angle)
+        -> std::array<ComplexT<PrecisionT>, entries.size()> {
+        const PrecisionT c = std::cos(angle / 2);
+        const PrecisionT s = std::sin(angle / 2);
+        return {ComplexT<PrecisionT>{c, 0}, ComplexT<PrecisionT>{-s, 0},
+                ComplexT<PrecisionT>{s, 0}, ComplexT<PrecisionT>{c, 0}};
+    }
+};
+
+/**
+ * @brief SingleExcitationMinus gate: a SingleExcitation with a phase
+ * e^{-i angle/2} on |00> and |11>.
+ */
+struct SingleExcitationMinus {
+    constexpr static GateOperation op = GateOperation::SingleExcitationMinus;
+    constexpr static std::size_t num_wires = 2;
+    constexpr static std::size_t num_params = 1;
+    constexpr static std::array<Entry, 6> entries{{{0b00, 0b00},
+                                                   {0b01, 0b01},
+                                                   {0b01, 0b10},
+                                                   {0b10, 0b01},
+                                                   {0b10, 0b10},
+                                                   {0b11, 0b11}}};
+
+    template <template <typename...> class ComplexT, typename PrecisionT>
+    static auto coefficients(PrecisionT angle)
+        -> std::array<ComplexT<PrecisionT>, entries.size()> {
+        const PrecisionT c = std::cos(angle / 2);
+        const PrecisionT s = std::sin(angle / 2);
+        const ComplexT<PrecisionT> e{c, -s};
+        return {e,
+                ComplexT<PrecisionT>{c, 0},
+                ComplexT<PrecisionT>{-s, 0},
+                ComplexT<PrecisionT>{s, 0},
+                ComplexT<PrecisionT>{c, 0},
+                e};
+    }
+};
+
+/**
+ * @brief SingleExcitationPlus gate: a SingleExcitation with a phase
+ * e^{i angle/2} on |00> and |11>.
+ */
+struct SingleExcitationPlus {
+    constexpr static GateOperation op = GateOperation::SingleExcitationPlus;
+    constexpr static std::size_t num_wires = 2;
+    constexpr static std::size_t num_params = 1;
+    constexpr static std::array<Entry, 6> entries =
+        SingleExcitationMinus::entries;
+
+    template <template <typename...> class ComplexT, typename PrecisionT>
+    static auto coefficients(PrecisionT angle)
+        -> std::array<ComplexT<PrecisionT>, entries.size()> {
+        const PrecisionT c = std::cos(angle / 2);
+        const PrecisionT s = std::sin(angle / 2);
+        const ComplexT<PrecisionT> e{c, s};
+        return {e,
+                ComplexT<PrecisionT>{c, 0},
+                ComplexT<PrecisionT>{-s, 0},
+                ComplexT<PrecisionT>{s, 0},
+                ComplexT<PrecisionT>{c, 0},
+                e};
+    }
+};
+
+/**
+ * @brief DoubleExcitation gate: a rotation between |0011> and |1100>, which
+ * touches 2 of the 16 amplitudes of each block.
+ */
+struct DoubleExcitation {
+    constexpr static GateOperation op = GateOperation::DoubleExcitation;
+    constexpr static std::size_t num_wires = 4;
+    constexpr static std::size_t num_params = 1;
+    constexpr static std::array<Entry, 4> entries{{{0b0011, 0b0011},
+                                                   {0b0011, 0b1100},
+                                                   {0b1100, 0b0011},
+                                                   {0b1100, 0b1100}}};
+
+    template <template <typename...> class ComplexT, typename PrecisionT>
+    static auto coefficients(PrecisionT angle)
+        -> std::array<ComplexT<PrecisionT>, entries.size()> {
+        return SingleExcitation::coefficients<ComplexT, PrecisionT>(angle);
+    }
+};
+
+/// @cond DEV
+namespace Internal {
+/**
+ * @brief Entries of a DoubleExcitation with a phase on every other basis
+ * state: the 14 diagonal entries followed by the 2x2 rotation block.
+ */
+constexpr auto doubleExcitationPhaseEntries() -> std::array<Entry, 18> {
+    std::array<Entry, 18> entries{};
+    std::size_t pos = 0;
+    for (std::size_t idx = 0; idx < 16; idx++) {
+        if (idx != 0b0011 && idx != 0b1100) {
+            entries[pos++] = {idx, idx};
+        }
+    }
+    for (const auto &entry : DoubleExcitation::entries) {
+        entries[pos++] = entry;
+    }
+    return entries;
+}
+
+template <template <typename...> class ComplexT, typename PrecisionT>
+auto doubleExcitationPhaseCoefficients(PrecisionT angle,
+                                       const ComplexT<PrecisionT> &phase)
+    -> std::array<ComplexT<PrecisionT>, 18> {
+    std::array<ComplexT<PrecisionT>, 18> coeffs{};
+    for (std::size_t pos = 0; pos < 14; pos++) {
+        coeffs[pos] = phase;
+    }
+    const auto rotation =
+        DoubleExcitation::coefficients<ComplexT, PrecisionT>(angle);
+    for (std::size_t pos = 0; pos < rotation.size(); pos++) {
+        coeffs[14 + pos] = rotation[pos];
+    }
+    return coeffs;
+}
+} // namespace Internal
+/// @endcond
+
+/**
+ * @brief DoubleExcitationMinus gate: a DoubleExcitation with a phase
+ * e^{-i angle/2} on every other basis state.
+ */
+struct DoubleExcitationMinus {
+    constexpr static GateOperation op = GateOperation::DoubleExcitationMinus;
+    constexpr static std::size_t num_wires = 4;
+    constexpr static std::size_t num_params = 1;
+    constexpr static std::array<Entry, 18> entries =
+        Internal::doubleExcitationPhaseEntries();
+
+    template <template <typename...> class ComplexT, typename PrecisionT>
+    static auto coefficients(PrecisionT angle)
+        -> std::array<ComplexT<PrecisionT>, entries.size()> {
+        return Internal::doubleExcitationPhaseCoefficients<ComplexT>(
+            angle, ComplexT<PrecisionT>{std::cos(angle / 2),
+                                        -std::sin(angle / 2)});
+    }
+};
+
+/**
+ * @brief DoubleExcitationPlus gate: a DoubleExcitation with a phase
+ * e^{i angle/2} on every other basis state.
+ */
+struct DoubleExcitationPlus {
+    constexpr static GateOperation op = GateOperation::DoubleExcitationPlus;
+    constexpr static std::size_t num_wires = 4;
+    constexpr static std::size_t num_params = 1;
+    constexpr static std::array<Entry, 18> entries =
+        Internal::doubleExcitationPhaseEntries();
+
+    template <template <typename...> class ComplexT, typename PrecisionT>
+    static auto coefficients(PrecisionT angle)
+        -> std::array<ComplexT<PrecisionT>, entries.size()> {
+        return Internal::doubleExcitationPhaseCoefficients<ComplexT>(
+            angle, ComplexT<PrecisionT>{std::cos(angle / 2),
+                                        std::sin(angle / 2)});
+    }
+};
+} // namespace Pennylane::Gates::Pattern
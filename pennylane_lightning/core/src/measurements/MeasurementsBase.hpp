@@ -17,9 +17,13 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 #include <string>
 #include <vector>
 
+#include "Error.hpp"
 #include "Observables.hpp"
 
 #include "CPUMemoryModel.hpp"
@@ -31,6 +35,20 @@ using namespace Pennylane::Observables;
 /// @endcond
 
 namespace Pennylane::Measures {
+/**
+ * @brief Expectation value estimated from samples.
+ *
+ * @tparam PrecisionT Floating point precision of the estimate.
+ */
+template <class PrecisionT> struct ExpvalEstimate {
+    /// Estimated expectation value
+    PrecisionT value;
+    /// Standard error of the estimate
+    PrecisionT std_error;
+    /// Number of shots spent on each term of the observable
+    std::vector<size_t> shots;
+};
+
 /**
  * @brief Observable's Measurement Class.
  *
@@ -146,8 +164,9 @@ template <class StateVectorT, class Derived> class MeasurementsBase {
             auto coeffs = obs.getCoeffs();
             for (size_t obs_term_idx = 0; obs_term_idx < coeffs.size();
                  obs_term_idx++) {
-                auto obs_samples = measure_with_samples(
-                    obs, num_shots, shot_range, obs_term_idx);
+                auto obs_samples =
+                    static_cast<Derived *>(this)->measure_with_samples(
+                        obs, num_shots, shot_range, obs_term_idx);
                 PrecisionT result_per_term = std::accumulate(
                     obs_samples.begin(), obs_samples.end(), 0.0);
 
@@ -155,7 +174,9 @@ template <class StateVectorT, class Derived> class MeasurementsBase {
                     coeffs[obs_term_idx] * result_per_term / obs_samples.size();
             }
         } else {
-            auto obs_samples = measure_with_samples(obs, num_shots, shot_range);
+            auto obs_samples =
+                static_cast<Derived *>(this)->measure_with_samples(
+                    obs, num_shots, shot_range);
             result =
                 std::accumulate(obs_samples.begin(), obs_samples.end(), 0.0);
             result /= obs_samples.size();
@@ -163,6 +184,244 @@ template <class StateVectorT, class Derived> class MeasurementsBase {
         return result;
     }
 
+    /**
+     * @brief Calculate the expectation value of an observable for each
+     * partition of a shot vector.
+     *
+     * The measured basis of the observable (of each term for a Hamiltonian)
+     * is sampled once with the total number of shots, and the draw is split
+     * into consecutive partitions, instead of sampling again per partition.
+     *
+     * @param obs Observable.
+     * @param shot_vector Number of shots in each partition.
+     *
+     * @return Expectation value for each partition.
+     */
+    auto expval_shot_vector(const Observable<StateVectorT> &obs,
+                            const std::vector<size_t> &shot_vector)
+        -> std::vector<PrecisionT> {
+        const size_t num_shots = totalShots(shot_vector);
+        const std::string obs_name = obs.getObsName();
+
+        PL_ABORT_IF(obs_name.find("SparseHamiltonian") != std::string::npos,
+                    "For SparseHamiltonian Observables, expval calculation is "
+                    "not supported by shots");
+        PL_ABORT_IF(obs_name.find("Hermitian") != std::string::npos,
+                    "For Hermitian Observables, expval calculation is not "
+                    "supported by shots");
+
+        const auto coeffs = (obs_name.find("Hamiltonian") != std::string::npos)
+                                ? obs.getCoeffs()
+                                : std::vector<PrecisionT>{1.0};
+
+        std::vector<PrecisionT> results(shot_vector.size(), 0.0);
+        for (size_t term_idx = 0; term_idx < coeffs.size(); term_idx++) {
+            const auto obs_samples =
+                static_cast<Derived *>(this)->measure_with_samples(
+                    obs, num_shots, std::vector<size_t>{}, term_idx);
+            auto first = obs_samples.begin();
+            for (size_t part = 0; part < shot_vector.size(); part++) {
+                const auto last = first + shot_vector[part];
+                results[part] += coeffs[term_idx] *
+                                 std::accumulate(first, last, PrecisionT{0.0}) /
+                                 static_cast<PrecisionT>(shot_vector[part]);
+                first = last;
+            }
+        }
+        return results;
+    }
+
+    /**
+     * @brief Estimate the expectation value of an observable within a shot
+     * budget, allocating the shots of a Hamiltonian to its terms by their
+     * variance.
+     *
+     * A pilot fraction of the budget is split evenly between the terms to
+     * estimate their standard deviations `sigma_k`. The rest of the shots is
+     * then allocated proportionally to `|c_k| sigma_k`, which minimizes the
+     * variance of the estimate for the given budget. Terms whose pilot samples
+     * all agree are given a standard deviation of `1 / num_pilot`, so that
+     * they still receive some shots.
+     *
+     * @param obs Observable.
+     * @param num_shots Total number of shots.
+     * @param pilot_fraction Fraction of the shots used to estimate the
+     * variances of the terms.
+     *
+     * @return Estimated expectation value, its standard error and the number
+     * of shots spent on each term.
+     */
+    auto expval_adaptive(const Observable<StateVectorT> &obs, size_t num_shots,
+                         PrecisionT pilot_fraction = 0.1)
+        -> ExpvalEstimate<PrecisionT> {
+        const std::string obs_name = obs.getObsName();
+
+        PL_ABORT_IF(obs_name.find("SparseHamiltonian") != std::string::npos,
+                    "For SparseHamiltonian Observables, expval calculation is "
+                    "not supported by shots");
+        PL_ABORT_IF(obs_name.find("Hermitian") != std::string::npos,
+                    "For Hermitian Observables, expval calculation is not "
+                    "supported by shots");
+        PL_ABORT_IF_NOT(pilot_fraction > 0 && pilot_fraction < 1,
+                        "The pilot fraction must be between 0 and 1.");
+
+        const auto coeffs = (obs_name.find("Hamiltonian") != std::string::npos)
+                                ? obs.getCoeffs()
+                                : std::vector<PrecisionT>{1.0};
+        const size_t num_terms = coeffs.size();
+        PL_ABORT_IF(num_terms == 0,
+                    "Cannot estimate the expectation value of a Hamiltonian "
+                    "without terms.");
+        const size_t num_pilot = std::max(
+            size_t{2}, static_cast<size_t>(pilot_fraction *
+                                           static_cast<PrecisionT>(num_shots) /
+                                           static_cast<PrecisionT>(num_terms)));
+        PL_ABORT_IF(num_pilot * num_terms > num_shots,
+                    "The shot budget must allow at least two pilot shots per "
+                    "term of the observable.");
+
+        // Running sums and sums of squares of the samples of each term
+        std::vector<PrecisionT> sums(num_terms, 0.0);
+        std::vector<PrecisionT> squares(num_terms, 0.0);
+        std::vector<size_t> shots(num_terms, 0);
+        auto sample = [&](size_t term_idx, size_t term_shots) {
+            if (term_shots == 0) {
+                return;
+            }
+            const auto obs_samples =
+                static_cast<Derived *>(this)->measure_with_samples(
+                    obs, term_shots, std::vector<size_t>{}, term_idx);
+            for (const auto value : obs_samples) {
+                sums[term_idx] += value;
+                squares[term_idx] += value * value;
+            }
+            shots[term_idx] += term_shots;
+        };
+        auto variance = [&](size_t term_idx) {
+            const auto n = static_cast<PrecisionT>(shots[term_idx]);
+            const PrecisionT mean = sums[term_idx] / n;
+            return std::max(PrecisionT{0.0},
+                            (squares[term_idx] - n * mean * mean) / (n - 1));
+        };
+
+        std::vector<PrecisionT> weights(num_terms);
+        for (size_t term_idx = 0; term_idx < num_terms; term_idx++) {
+            sample(term_idx, num_pilot);
+            const PrecisionT sigma =
+                std::max(std::sqrt(variance(term_idx)),
+                         PrecisionT{1.0} / static_cast<PrecisionT>(num_pilot));
+            weights[term_idx] = std::abs(coeffs[term_idx]) * sigma;
+        }
+        PrecisionT weight_sum =
+            std::accumulate(weights.begin(), weights.end(), PrecisionT{0.0});
+        if (weight_sum == PrecisionT{0.0}) {
+            std::fill(weights.begin(), weights.end(), PrecisionT{1.0});
+            weight_sum = static_cast<PrecisionT>(num_terms);
+        }
+
+        // Split the remaining shots by weight, handing out the shots lost to
+        // rounding to the largest remainders
+        const size_t remaining = num_shots - num_pilot * num_terms;
+        std::vector<size_t> extra(num_terms);
+        std::vector<PrecisionT> remainders(num_terms);
+        for (size_t term_idx = 0; term_idx < num_terms; term_idx++) {
+            const PrecisionT share = static_cast<PrecisionT>(remaining) *
+                                     weights[term_idx] / weight_sum;
+            extra[term_idx] = std::min(static_cast<size_t>(share), remaining);
+            remainders[term_idx] =
+                share - static_cast<PrecisionT>(extra[term_idx]);
+        }
+        std::vector<size_t> order(num_terms);
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::stable_sort(order.begin(), order.end(),
+                         [&remainders](size_t lhs, size_t rhs) {
+                             return remainders[lhs] > remainders[rhs];
+                         });
+        size_t allocated =
+            std::accumulate(extra.begin(), extra.end(), size_t{0});
+        for (size_t idx = 0; allocated < remaining; idx++, allocated++) {
+            extra[order[idx % num_terms]]++;
+        }
+
+        PrecisionT value{0.0};
+        PrecisionT error_variance{0.0};
+        for (size_t term_idx = 0; term_idx < num_terms; term_idx++) {
+            sample(term_idx, extra[term_idx]);
+            const auto n = static_cast<PrecisionT>(shots[term_idx]);
+            value += coeffs[term_idx] * sums[term_idx] / n;
+            error_variance +=
+                coeffs[term_idx] * coeffs[term_idx] * variance(term_idx) / n;
+        }
+        return {value, std::sqrt(error_variance), std::move(shots)};
+    }
+
+    /**
+     * @brief Count the outcomes on a subset of wires for each partition of a
+     * shot vector.
+     *
+     * The total number of shots is drawn once, and the drawn samples are
+     * split into consecutive partitions.
+     *
+     * @param wires Wires to count the outcomes of.
+     * @param shot_vector Number of shots in each partition.
+     *
+     * @return For each partition, the number of occurrences of each basis
+     * state of `wires`, in lexicographic order.
+     */
+    auto counts_shot_vector(const std::vector<size_t> &wires,
+                            const std::vector<size_t> &shot_vector)
+        -> std::vector<std::vector<size_t>> {
+        const size_t num_shots = totalShots(shot_vector);
+        const size_t num_qubits = _statevector.getTotalNumQubits();
+        for (const auto wire : wires) {
+            PL_ABORT_IF_NOT(wire < num_qubits, "Invalid wire index.");
+        }
+        const auto samples =
+            static_cast<Derived *>(this)->generate_samples(num_shots);
+
+        std::vector<std::vector<size_t>> counts(
+            shot_vector.size(),
+            std::vector<size_t>(size_t{1} << wires.size(), 0));
+        size_t shot = 0;
+        for (size_t part = 0; part < shot_vector.size(); part++) {
+            for (size_t i = 0; i < shot_vector[part]; i++, shot++) {
+                size_t idx = 0;
+                for (const auto wire : wires) {
+                    idx = (idx << 1U) | samples[shot * num_qubits + wire];
+                }
+                counts[part][idx]++;
+            }
+        }
+        return counts;
+    }
+
+    /**
+     * @brief Estimate the probabilities of a subset of wires for each
+     * partition of a shot vector.
+     *
+     * @param wires Wires to estimate the probabilities of.
+     * @param shot_vector Number of shots in each partition.
+     *
+     * @return For each partition, the frequency of each basis state of
+     * `wires`, in lexicographic order.
+     */
+    auto probs_shot_vector(const std::vector<size_t> &wires,
+                           const std::vector<size_t> &shot_vector)
+        -> std::vector<std::vector<PrecisionT>> {
+        const auto counts = counts_shot_vector(wires, shot_vector);
+
+        std::vector<std::vector<PrecisionT>> probabilities(counts.size());
+        for (size_t part = 0; part < counts.size(); part++) {
+            probabilities[part].reserve(counts[part].size());
+            for (const auto count : counts[part]) {
+                probabilities[part].push_back(
+                    static_cast<PrecisionT>(count) /
+                    static_cast<PrecisionT>(shot_vector[part]));
+            }
+        }
+        return probabilities;
+    }
+
     /**
      * @brief Calculate the expectation value for a general Observable.
      *
@@ -229,6 +488,21 @@ template <class StateVectorT, class Derived> class MeasurementsBase {
     }
 
   private:
+    /**
+     * @brief Total number of shots of a shot vector.
+     *
+     * @param shot_vector Number of shots in each partition.
+     */
+    static auto totalShots(const std::vector<size_t> &shot_vector) -> size_t {
+        PL_ABORT_IF(shot_vector.empty(), "The shot vector must not be empty.");
+        PL_ABORT_IF(std::find(shot_vector.begin(), shot_vector.end(), 0) !=
+                        shot_vector.end(),
+                    "Each partition of the shot vector must have at least "
+                    "one shot.");
+        return std::accumulate(shot_vector.begin(), shot_vector.end(),
+                               size_t{0});
+    }
+
     /**
      * @brief Return preprocess state with a observable
      *
@@ -721,6 +721,197 @@ TEST_CASE("Expval Shot - HamiltonianObs ", "[MeasurementsBase][Observables]") {
     }
 }
 
+template <typename TypeList> void testShotVector() {
+    if constexpr (!std::is_same_v<TypeList, void>) {
+        using StateVectorT = typename TypeList::Type;
+        using PrecisionT = typename StateVectorT::PrecisionT;
+        using ComplexT = typename StateVectorT::ComplexT;
+
+        // Defining the State Vector that will be measured.
+        std::vector<ComplexT> statevector_data{
+            {0.0, 0.0}, {0.0, 0.1}, {0.1, 0.1}, {0.1, 0.2},
+            {0.2, 0.2}, {0.3, 0.3}, {0.3, 0.4}, {0.4, 0.5}};
+        StateVectorT statevector(statevector_data.data(),
+                                 statevector_data.size());
+
+        // Initializing the measures class.
+        // This object attaches to the statevector allowing several measures.
+        Measurements<StateVectorT> Measurer(statevector);
+
+        const std::vector<size_t> shot_vector{100, 100, 100, 20000};
+
+        DYNAMIC_SECTION("Expval of a Hamiltonian "
+                        << StateVectorToName<StateVectorT>::name) {
+            auto X0 = std::make_shared<NamedObs<StateVectorT>>(
+                "PauliX", std::vector<size_t>{0});
+            auto Z1 = std::make_shared<NamedObs<StateVectorT>>(
+                "PauliZ", std::vector<size_t>{1});
+            auto ob = Hamiltonian<StateVectorT>::create({0.3, 0.5}, {X0, Z1});
+
+            auto res = Measurer.expval_shot_vector(*ob, shot_vector);
+            REQUIRE(res.size() == shot_vector.size());
+            for (const auto value : res) {
+                REQUIRE(std::abs(value) <= PrecisionT{0.8});
+            }
+            REQUIRE(res.back() == Approx(PrecisionT(-0.086)).margin(5e-2));
+        }
+
+        DYNAMIC_SECTION("Counts and probs "
+                        << StateVectorToName<StateVectorT>::name) {
+            const std::vector<size_t> wires{1, 2};
+            auto counts = Measurer.counts_shot_vector(wires, shot_vector);
+            REQUIRE(counts.size() == shot_vector.size());
+            for (size_t part = 0; part < shot_vector.size(); part++) {
+                REQUIRE(counts[part].size() == 4);
+                REQUIRE(std::accumulate(counts[part].begin(),
+                                        counts[part].end(),
+                                        size_t{0}) == shot_vector[part]);
+            }
+
+            auto probabilities = Measurer.probs_shot_vector(wires, shot_vector);
+            REQUIRE_THAT(probabilities.back(),
+                         Catch::Approx(Measurer.probs(wires)).margin(3e-2));
+        }
+
+        DYNAMIC_SECTION("Invalid shot vectors "
+                        << StateVectorToName<StateVectorT>::name) {
+            auto Z0 = std::make_shared<NamedObs<StateVectorT>>(
+                "PauliZ", std::vector<size_t>{0});
+            REQUIRE_THROWS_WITH(
+                Measurer.expval_shot_vector(*Z0, {}),
+                Catch::Matchers::Contains("shot vector must not be empty"));
+            REQUIRE_THROWS_WITH(
+                Measurer.expval_shot_vector(*Z0, {10, 0}),
+                Catch::Matchers::Contains("at least one shot"));
+        }
+
+        DYNAMIC_SECTION("Invalid wires "
+                        << StateVectorToName<StateVectorT>::name) {
+            REQUIRE_THROWS_WITH(
+                Measurer.counts_shot_vector({0, 3}, shot_vector),
+                Catch::Matchers::Contains("Invalid wire index"));
+            REQUIRE_THROWS_WITH(
+                Measurer.probs_shot_vector({3}, shot_vector),
+                Catch::Matchers::Contains("Invalid wire index"));
+        }
+
+        testShotVector<typename TypeList::Next>();
+    }
+}
+
+TEST_CASE("Shot vector", "[MeasurementsBase][Observables]") {
+    if constexpr (BACKEND_FOUND) {
+        testShotVector<TestStateVectorBackends>();
+    }
+}
+
+template <typename TypeList> void testAdaptiveShots() {
+    if constexpr (!std::is_same_v<TypeList, void>) {
+        using StateVectorT = typename TypeList::Type;
+        using PrecisionT = typename StateVectorT::PrecisionT;
+        using ComplexT = typename StateVectorT::ComplexT;
+
+        // Defining the State Vector that will be measured.
+        std::vector<ComplexT> statevector_data{
+            {0.0, 0.0}, {0.0, 0.1}, {0.1, 0.1}, {0.1, 0.2},
+            {0.2, 0.2}, {0.3, 0.3}, {0.3, 0.4}, {0.4, 0.5}};
+        StateVectorT statevector(statevector_data.data(),
+                                 statevector_data.size());
+
+        // Initializing the measures class.
+        // This object attaches to the statevector allowing several measures.
+        Measurements<StateVectorT> Measurer(statevector);
+
+        auto X0 = std::make_shared<NamedObs<StateVectorT>>(
+            "PauliX", std::vector<size_t>{0});
+        auto Z0 = std::make_shared<NamedObs<StateVectorT>>(
+            "PauliZ", std::vector<size_t>{0});
+        auto Z1 = std::make_shared<NamedObs<StateVectorT>>(
+            "PauliZ", std::vector<size_t>{1});
+        auto Z2 = std::make_shared<NamedObs<StateVectorT>>(
+            "PauliZ", std::vector<size_t>{2});
+        auto Z0Z2 = TensorProdObs<StateVectorT>::create({Z0, Z2});
+        const std::vector<PrecisionT> coeffs{10.0, 0.01, 1.0};
+        auto ob = Hamiltonian<StateVectorT>::create({10.0, 0.01, 1.0},
+                                                    {X0, Z1, Z0Z2});
+        const size_t num_shots = 30000;
+
+        // The samples cannot be seeded, so the estimates are checked to
+        // within 6 standard deviations.
+        DYNAMIC_SECTION("Hamiltonian "
+                        << StateVectorToName<StateVectorT>::name) {
+            const auto estimate = Measurer.expval_adaptive(*ob, num_shots);
+
+            // Pilot shots are split evenly, the rest goes to the terms with
+            // the largest |c_k| sigma_k
+            const size_t num_pilot = num_shots / 10 / 3;
+            REQUIRE(estimate.shots.size() == 3);
+            REQUIRE(std::accumulate(estimate.shots.begin(),
+                                    estimate.shots.end(),
+                                    size_t{0}) == num_shots);
+            REQUIRE(estimate.shots[1] < num_pilot + 50);
+            REQUIRE(estimate.shots[0] > 4 * estimate.shots[2]);
+
+            // Standard error from the exact variances of the terms
+            const std::vector<PrecisionT> term_expvals{
+                Measurer.expval(*X0), Measurer.expval(*Z1),
+                Measurer.expval(*Z0Z2)};
+            PrecisionT adaptive_variance{0.0};
+            PrecisionT uniform_variance{0.0};
+            for (size_t k = 0; k < 3; k++) {
+                const PrecisionT term_variance =
+                    coeffs[k] * coeffs[k] *
+                    (1 - term_expvals[k] * term_expvals[k]);
+                adaptive_variance +=
+                    term_variance / static_cast<PrecisionT>(estimate.shots[k]);
+                uniform_variance +=
+                    term_variance / static_cast<PrecisionT>(num_shots / 3);
+            }
+            REQUIRE(estimate.std_error ==
+                    Approx(std::sqrt(adaptive_variance)).epsilon(0.1));
+            REQUIRE(estimate.std_error < 0.8 * std::sqrt(uniform_variance));
+            REQUIRE(estimate.value ==
+                    Approx(Measurer.expval(*ob))
+                        .margin(6 * std::sqrt(adaptive_variance)));
+        }
+
+        DYNAMIC_SECTION("Single observable "
+                        << StateVectorToName<StateVectorT>::name) {
+            const auto estimate = Measurer.expval_adaptive(*Z1, 10000);
+            const PrecisionT expval = Measurer.expval(*Z1);
+            const PrecisionT std_error =
+                std::sqrt((1 - expval * expval) / PrecisionT{10000});
+            REQUIRE(estimate.shots == std::vector<size_t>{10000});
+            REQUIRE(estimate.value == Approx(expval).margin(6 * std_error));
+            REQUIRE(estimate.std_error == Approx(std_error).epsilon(0.1));
+        }
+
+        DYNAMIC_SECTION("Invalid arguments "
+                        << StateVectorToName<StateVectorT>::name) {
+            REQUIRE_THROWS_WITH(
+                Measurer.expval_adaptive(*ob, num_shots, 0.0),
+                Catch::Matchers::Contains("pilot fraction"));
+            REQUIRE_THROWS_WITH(
+                Measurer.expval_adaptive(*ob, num_shots, 1.0),
+                Catch::Matchers::Contains("pilot fraction"));
+            REQUIRE_THROWS_WITH(
+                Measurer.expval_adaptive(*ob, 5),
+                Catch::Matchers::Contains("at least two pilot shots"));
+            auto empty = Hamiltonian<StateVectorT>::create({}, {});
+            REQUIRE_THROWS_WITH(Measurer.expval_adaptive(*empty, num_shots),
+                                Catch::Matchers::Contains("without terms"));
+        }
+
+        testAdaptiveShots<typename TypeList::Next>();
+    }
+}
+
+TEST_CASE("Adaptive shot allocation", "[MeasurementsBase][Observables]") {
+    if constexpr (BACKEND_FOUND) {
+        testAdaptiveShots<TestStateVectorBackends>();
+    }
+}
+
 template <typename TypeList> void testSparseHObsExpvalShot() {
     if constexpr (!std::is_same_v<TypeList, void>) {
         using StateVectorT = typename TypeList::Type;
@@ -16,8 +16,10 @@
 #include <algorithm>
 #include <complex>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "Error.hpp"
@@ -77,6 +79,27 @@ template <class StateVectorT> class Observable {
                                    std::vector<size_t> &ob_wires,
                                    size_t term_idx = 0) const = 0;
 
+    /**
+     * @brief Get the single-qubit observables whose eigenbases are measured
+     * when sampling the observable with shots.
+     *
+     * This provides the same information as `applyInPlaceShots` without
+     * modifying a statevector, so that backends can fuse the basis change
+     * into the sampling kernel.
+     *
+     * @param ob_wires Reference to a std::vector object which stores wires of
+     * the observable.
+     * @param ob_names Reference to a std::vector object which stores the name
+     * of the single-qubit observable acting on each wire.
+     * @param term_idx Index of a Hamiltonian term.
+     */
+    virtual void
+    getShotsBasis([[maybe_unused]] std::vector<size_t> &ob_wires,
+                  [[maybe_unused]] std::vector<std::string> &ob_names,
+                  [[maybe_unused]] size_t term_idx = 0) const {
+        PL_ABORT("The observable does not support the getShotsBasis method.");
+    }
+
     /**
      * @brief Get the name of the observable
      */
@@ -189,6 +212,19 @@ class NamedObsBase : public Observable<StateVectorT> {
                      "PauliZ, Identity and Hadamard.");
         }
     }
+
+    void getShotsBasis(std::vector<size_t> &ob_wires,
+                       std::vector<std::string> &ob_names,
+                       [[maybe_unused]] size_t term_idx = 0) const override {
+        PL_ABORT_IF_NOT(obs_name_ == "PauliX" || obs_name_ == "PauliY" ||
+                            obs_name_ == "PauliZ" || obs_name_ == "Hadamard" ||
+                            obs_name_ == "Identity",
+                        "Provided NamedObs does not supported for shots "
+                        "calculation. Supported NamedObs are PauliX, PauliY, "
+                        "PauliZ, Identity and Hadamard.");
+        ob_wires.assign(1, wires_[0]);
+        ob_names.assign(1, obs_name_);
+    }
 };
 
 /**
@@ -252,6 +288,101 @@ class HermitianObsBase : public Observable<StateVectorT> {
     }
 };
 
+/**
+ * @brief Base class for projectors onto a computational basis state of a set
+ * of wires.
+ *
+ * @tparam StateVectorT State vector class.
+ */
+template <class StateVectorT>
+class ProjectorObsBase : public Observable<StateVectorT> {
+  public:
+    using PrecisionT = typename StateVectorT::PrecisionT;
+
+  protected:
+    std::vector<size_t> state_;
+    std::vector<size_t> wires_;
+
+  private:
+    [[nodiscard]] auto isEqual(const Observable<StateVectorT> &other) const
+        -> bool override {
+        const auto &other_cast =
+            static_cast<const ProjectorObsBase<StateVectorT> &>(other);
+
+        return (state_ == other_cast.state_) && (wires_ == other_cast.wires_);
+    }
+
+  public:
+    /**
+     * @brief Create a projector onto a computational basis state.
+     *
+     * @param state Bit taken by each wire in the basis state.
+     * @param wires Wires the observable applies to.
+     */
+    ProjectorObsBase(std::vector<size_t> state, std::vector<size_t> wires)
+        : state_{std::move(state)}, wires_{std::move(wires)} {
+        PL_ABORT_IF_NOT(state_.size() == wires_.size(),
+                        "The basis state must have one bit per wire.");
+        PL_ABORT_IF_NOT(std::all_of(state_.begin(), state_.end(),
+                                    [](size_t bit) { return bit <= 1; }),
+                        "The basis state must only contain 0 and 1.");
+        PL_ABORT_IF_NOT(
+            std::unordered_set<size_t>(wires_.begin(), wires_.end()).size() ==
+                wires_.size(),
+            "The projector wires must be distinct.");
+    }
+
+    /**
+     * @brief Get the mask of the bits of the projector wires in a basis
+     * state index, and the value these bits take in the projected state.
+     *
+     * @param num_qubits Number of qubits of the state vector.
+     */
+    [[nodiscard]] auto getBitMaskAndValue(size_t num_qubits) const
+        -> std::pair<size_t, size_t> {
+        size_t mask = 0;
+        size_t value = 0;
+        for (size_t idx = 0; idx < wires_.size(); idx++) {
+            PL_ABORT_IF_NOT(wires_[idx] < num_qubits,
+                            "The projector wires must be smaller than the "
+                            "number of qubits.");
+            const size_t bit = num_qubits - 1 - wires_[idx];
+            mask |= size_t{1U} << bit;
+            value |= state_[idx] << bit;
+        }
+        return {mask, value};
+    }
+
+    [[nodiscard]] auto getState() const -> const std::vector<size_t> & {
+        return state_;
+    }
+
+    [[nodiscard]] auto getWires() const -> std::vector<size_t> override {
+        return wires_;
+    }
+
+    [[nodiscard]] auto getObsName() const -> std::string override {
+        using Util::operator<<;
+        std::ostringstream obs_stream;
+        obs_stream << "Projector" << state_ << wires_;
+        return obs_stream.str();
+    }
+
+    void applyInPlace([[maybe_unused]] StateVectorT &sv) const override {
+        PL_ABORT("For Projector observables, the applyInPlace method must be "
+                 "defined at the backend level.");
+    }
+
+    void
+    applyInPlaceShots([[maybe_unused]] StateVectorT &sv,
+                      [[maybe_unused]] std::vector<size_t> &identity_wire,
+                      [[maybe_unused]] std::vector<size_t> &ob_wires,
+                      [[maybe_unused]] size_t term_idx = 0) const override {
+        PL_ABORT("Projector observables do not support applyInPlaceShots "
+                 "method.");
+    }
+};
+
 /**
  * @brief Base class for a tensor product of observables.
  *
@@ -377,6 +508,20 @@ class TensorProdObsBase : public Observable<StateVectorT> {
         }
     }
 
+    void getShotsBasis(std::vector<size_t> &ob_wires,
+                       std::vector<std::string> &ob_names,
+                       [[maybe_unused]] size_t term_idx = 0) const override {
+        ob_wires.clear();
+        ob_names.clear();
+        for (const auto &ob : obs_) {
+            std::vector<size_t> ob_wire;
+            std::vector<std::string> ob_name;
+            ob->getShotsBasis(ob_wire, ob_name);
+            ob_wires.insert(ob_wires.end(), ob_wire.begin(), ob_wire.end());
+            ob_names.insert(ob_names.end(), ob_name.begin(), ob_name.end());
+        }
+    }
+
     [[nodiscard]] auto getObsName() const -> std::string override {
         using Util::operator<<;
         std::ostringstream obs_stream;
@@ -471,6 +616,13 @@ class HamiltonianBase : public Observable<StateVectorT> {
                  "defined at the backend level.");
     }
 
+    void getShotsBasis(std::vector<size_t> &ob_wires,
+                       std::vector<std::string> &ob_names,
+                       size_t term_idx = 0) const override {
+        PL_ABORT_IF_NOT(term_idx < obs_.size(), "Invalid Hamiltonian term.");
+        obs_[term_idx]->getShotsBasis(ob_wires, ob_names);
+    }
+
     [[nodiscard]] auto getWires() const -> std::vector<size_t> override {
         std::unordered_set<size_t> wires;
 
@@ -483,6 +635,14 @@ class HamiltonianBase : public Observable<StateVectorT> {
         return all_wires;
     }
 
+    /**
+     * @brief Get the observables of the Hamiltonian terms.
+     */
+    [[nodiscard]] auto getObs() const
+        -> const std::vector<std::shared_ptr<Observable<StateVectorT>>> & {
+        return obs_;
+    }
+
     [[nodiscard]] auto getObsName() const -> std::string override {
         using Util::operator<<;
         std::ostringstream ss;
@@ -25,7 +25,13 @@
 #endif
 /// @endcond
 
+#include <algorithm>
 #include <complex>
+#include <utility>
+#include <vector>
+
+#include "BitUtil.hpp" // revWireParity
+#include "Error.hpp"
 
 namespace Pennylane {
 /**
@@ -44,6 +50,68 @@ template <class PrecisionT, class Derived> class StateVectorBase {
   protected:
     size_t num_qubits_{0};
 
+    /**
+     * @brief Check the basis-state indices of an amplitude gather.
+     *
+     * @param indices Basis-state indices.
+     */
+    void checkAmplitudeIndices(const std::vector<size_t> &indices) const {
+        const size_t length = getLength();
+        for (const auto idx : indices) {
+            PL_ABORT_IF_NOT(idx < length, "Basis-state index out of range.");
+        }
+    }
+
+    /**
+     * @brief Check a range `[begin, end)` of basis states.
+     *
+     * @param begin First basis-state index.
+     * @param end One past the last basis-state index.
+     */
+    void checkAmplitudeRange(size_t begin, size_t end) const {
+        PL_ABORT_IF_NOT(begin <= end && end <= getLength(),
+                        "Invalid basis-state range.");
+    }
+
+    /**
+     * @brief Check the wires and bit values of an amplitude slice, and
+     * compute the masks to enumerate its basis states.
+     *
+     * @param wires Wires to fix.
+     * @param values Bit value (0 or 1) of each wire.
+     * @return Parity masks of the remaining wires, empty if no wire is fixed,
+     * and the index bits set by the fixed wires.
+     */
+    [[nodiscard]] auto
+    getAmplitudesSliceMasks(const std::vector<size_t> &wires,
+                            const std::vector<size_t> &values) const
+        -> std::pair<std::vector<size_t>, size_t> {
+        PL_ABORT_IF_NOT(wires.size() == values.size(),
+                        "The number of wires and values must be equal.");
+        PL_ABORT_IF_NOT(wires.size() <= num_qubits_,
+                        "The number of wires must not exceed the number of "
+                        "qubits.");
+        if (wires.empty()) {
+            return {{}, 0};
+        }
+
+        std::vector<size_t> rev_wires(wires.size());
+        size_t fixed_mask = 0;
+        for (size_t k = 0; k < wires.size(); k++) {
+            PL_ABORT_IF_NOT(wires[k] < num_qubits_, "Invalid wire index.");
+            PL_ABORT_IF_NOT(values[k] <= 1, "Wire values must be 0 or 1.");
+            rev_wires[k] = num_qubits_ - 1 - wires[k];
+            fixed_mask |= values[k] << rev_wires[k];
+        }
+        auto sorted_wires = rev_wires;
+        std::sort(sorted_wires.begin(), sorted_wires.end());
+        PL_ABORT_IF(std::adjacent_find(sorted_wires.begin(),
+                                       sorted_wires.end()) !=
+                        sorted_wires.end(),
+                    "Wires must be unique.");
+        return {Pennylane::Util::revWireParity(rev_wires), fixed_mask};
+    }
+
   public:
     /**
      * @brief StateVector complex precision type.
@@ -68,7 +68,9 @@ void registerBackendClassSpecificBindingsMPI(PyClass &pyclass) {
         py::array_t<int32_t, py::array::c_style | py::array::forcecast>,
         py::array_t<int64_t, py::array::c_style | py::array::forcecast>>::type;
 
-    registerGatesForStateVector<StateVectorT>(pyclass);
+    // cuStateVec has no QFT kernel, it is applied from its matrix
+    registerGatesForStateVector<StateVectorT>(
+        pyclass, {Pennylane::Gates::GateOperation::QFT});
 
     pyclass
         .def(
@@ -17,10 +17,12 @@
  */
 
 #pragma once
+#include <algorithm>
 #include <complex>
 #include <cstddef>
 #include <cstdlib>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -110,9 +112,6 @@ class StateVectorKokkos final
             data_ = std::make_unique<KokkosVector>("data_", exp2(num_qubits));
             setBasisState(0U);
         }
-
-        init_gates_indices_();
-        init_generators_indices_();
     };
 
     /**
@@ -259,8 +258,11 @@ class StateVectorKokkos final
                         const std::vector<ComplexT> &gate_matrix = {}) {
         if (opName == "Identity") {
             // No op
-        } else if (gates_indices_.contains(opName)) {
+        } else if (gates_indices_().contains(opName)) {
             applyNamedOperation(opName, wires, inverse, params);
+        } else if (opName == "GroverOperator") {
+            // Self-inverse, and serialized without its matrix
+            applyGroverOperator(wires);
         } else {
             KokkosVector matrix("gate_matrix", gate_matrix.size());
             Kokkos::deep_copy(
@@ -329,6 +331,155 @@ class StateVectorKokkos final
         }
     }
 
+    /**
+     * @brief Apply a diagonal operator to the state vector.
+     *
+     * @param diag Kokkos diagonal entries in the device space.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use adjoint of gate.
+     */
+    void applyDiagonalOp(const KokkosVector &diag,
+                         const std::vector<std::size_t> &wires,
+                         bool inverse = false) {
+        KokkosVector diag_ = diag;
+        if (inverse) {
+            diag_ = KokkosVector("diag_conj", diag.size());
+            Kokkos::parallel_for(
+                diag.size(), KOKKOS_LAMBDA(const std::size_t i) {
+                    diag_(i) = conj(diag(i));
+                });
+        }
+        Kokkos::parallel_for(
+            this->getLength(),
+            diagonalOpFunctor<PrecisionT>(*data_, this->getNumQubits(), diag_,
+                                          wires));
+    }
+
+    /**
+     * @brief Apply a diagonal matrix directly to the statevector.
+     *
+     * @param diag Pointer to the diagonal entries, of size 2^(wires.size()).
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    inline void applyDiagonal(const ComplexT *diag,
+                              const std::vector<size_t> &wires,
+                              bool inverse = false) {
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+        size_t n = static_cast<std::size_t>(1U) << wires.size();
+        KokkosVector diag_("diag_", n);
+        Kokkos::deep_copy(diag_, UnmanagedConstComplexHostView(diag, n));
+        applyDiagonalOp(diag_, wires, inverse);
+    }
+
+    /**
+     * @brief Apply a diagonal matrix directly to the statevector.
+     *
+     * @param diag Diagonal entries of the matrix.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    inline void applyDiagonal(const std::vector<ComplexT> &diag,
+                              const std::vector<size_t> &wires,
+                              bool inverse = false) {
+        PL_ABORT_IF(diag.size() != exp2(wires.size()),
+                    "The size of the diagonal does not match with the given "
+                    "number of wires");
+        applyDiagonal(diag.data(), wires, inverse);
+    }
+
+    /**
+     * @brief Apply the reflection `2|s><s| - I` to the state vector.
+     *
+     * @param state Kokkos state |s> in the device space. An empty view
+     * stands for the uniform superposition.
+     * @param wires Wires to apply the reflection to.
+     */
+    void applyReflectionOp(const KokkosVector &state,
+                           const std::vector<std::size_t> &wires) {
+        const size_t num_qubits = this->getNumQubits();
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+        PL_ABORT_IF_NOT(wires.size() <= num_qubits,
+                        "The number of wires must not exceed the number of "
+                        "qubits.");
+        for (const auto wire : wires) {
+            PL_ABORT_IF_NOT(wire < num_qubits, "Invalid wire index.");
+        }
+        auto sorted_wires = wires;
+        std::sort(sorted_wires.begin(), sorted_wires.end());
+        PL_ABORT_IF(std::adjacent_find(sorted_wires.begin(),
+                                       sorted_wires.end()) !=
+                        sorted_wires.end(),
+                    "Wires must be unique.");
+
+        const size_t dim = exp2(wires.size());
+        const size_t num_blocks = exp2(num_qubits - wires.size());
+        const auto functor =
+            reflectionFunctor<PrecisionT>(*data_, num_qubits, state, wires);
+        if (num_blocks > 1) {
+            Kokkos::parallel_for("reflectionFunctor",
+                                 TeamPolicy(num_blocks, Kokkos::AUTO),
+                                 functor);
+            return;
+        }
+        // A single block spans the state: one flat reduction, one flat update
+        ComplexT overlap{0.0, 0.0};
+        Kokkos::parallel_reduce(
+            dim,
+            KOKKOS_LAMBDA(const std::size_t i, ComplexT &sum) {
+                sum += functor.term(0, i);
+            },
+            overlap);
+        overlap *= functor.scale;
+        Kokkos::parallel_for(
+            dim, KOKKOS_LAMBDA(const std::size_t i) {
+                functor.update(0, i, overlap);
+            });
+    }
+
+    /**
+     * @brief Apply the reflection `2|s><s| - I` about a state of the given
+     * wires.
+     *
+     * @param state Pointer to the normalized state |s>, of size
+     * 2^(wires.size()), with `wires[0]` as the most significant bit.
+     * @param wires Wires to apply the reflection to.
+     */
+    inline void applyReflection(const ComplexT *state,
+                                const std::vector<size_t> &wires) {
+        PL_ABORT_IF(state == nullptr, "The reflection state must be given.");
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+        size_t n = static_cast<std::size_t>(1U) << wires.size();
+        KokkosVector state_("state_", n);
+        Kokkos::deep_copy(state_, UnmanagedConstComplexHostView(state, n));
+        applyReflectionOp(state_, wires);
+    }
+
+    /**
+     * @brief Apply the reflection `2|s><s| - I` about a state of the given
+     * wires.
+     *
+     * @param state Normalized state |s> of the wires.
+     * @param wires Wires to apply the reflection to.
+     */
+    inline void applyReflection(const std::vector<ComplexT> &state,
+                                const std::vector<size_t> &wires) {
+        PL_ABORT_IF(state.size() != exp2(wires.size()),
+                    "The size of the state does not match with the given "
+                    "number of wires");
+        applyReflection(state.data(), wires);
+    }
+
+    /**
+     * @brief Apply the Grover diffusion operator `2|s><s| - I` to the given
+     * wires, where |s> is their uniform superposition.
+     *
+     * @param wires Wires to apply the operator to.
+     */
+    inline void applyGroverOperator(const std::vector<size_t> &wires) {
+        applyReflectionOp(KokkosVector{}, wires);
+    }
+
     /**
      * @brief Apply a given matrix directly to the statevector using a
      * raw matrix pointer vector.
@@ -402,7 +553,11 @@ class StateVectorKokkos final
                              const std::vector<size_t> &wires,
                              bool inverse = false,
                              const std::vector<fp_t> &params = {}) {
-        switch (gates_indices_[opName]) {
+        const auto gate_iter = gates_indices_().find(opName);
+        if (gate_iter == gates_indices_().end()) {
+            PL_ABORT(std::string("Operation does not exist for ") + opName);
+        }
+        switch (gate_iter->second) {
         case GateOperation::PauliX:
             applyGateFunctor<pauliXFunctor, 1>(wires, inverse, params);
             return;
@@ -503,6 +658,9 @@ class StateVectorKokkos final
         case GateOperation::MultiRZ:
             applyMultiRZ(wires, inverse, params);
             return;
+        case GateOperation::QFT:
+            applyQFT(wires, inverse);
+            return;
         case GateOperation::CSWAP:
             applyGateFunctor<cSWAPFunctor, 3>(wires, inverse, params);
             return;
@@ -526,10 +684,11 @@ class StateVectorKokkos final
     auto applyGenerator(const std::string &opName,
                         const std::vector<size_t> &wires, bool inverse = false,
                         const std::vector<fp_t> &params = {}) -> fp_t {
-        if (!generators_indices_.contains(opName)) {
+        const auto gntr_iter = generators_indices_().find(opName);
+        if (gntr_iter == generators_indices_().end()) {
             PL_ABORT(std::string("Generator does not exist for ") + opName);
         }
-        switch (generators_indices_[opName]) {
+        switch (gntr_iter->second) {
         case GeneratorOperation::RX:
             applyGateFunctor<pauliXFunctor, 1>(wires, inverse, params);
             return -static_cast<fp_t>(0.5);
@@ -655,6 +814,47 @@ class StateVectorKokkos final
         }
     }
 
+    /**
+     * @brief Apply the quantum Fourier transform to the given wires, with
+     * `wires[0]` as the most significant bit, as a bit-reversal permutation
+     * followed by radix-2 butterflies.
+     *
+     * Up to `qftTeamFunctor::max_wires` wires, each block of amplitudes
+     * sharing the other bits is transformed by one team in scratch memory, in
+     * a single pass over the state vector. Larger blocks take one pass for
+     * the permutation and one per wire.
+     *
+     * @param wires Wires to apply the transform to.
+     * @param inverse Indicates whether to apply the inverse transform.
+     */
+    void applyQFT(const std::vector<size_t> &wires, bool inverse = false) {
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+        const size_t num_qubits = this->getNumQubits();
+        const size_t length = exp2(num_qubits);
+
+        if (wires.size() <= qftTeamFunctor<fp_t>::max_wires) {
+            const size_t dim = exp2(wires.size());
+            const size_t scratch_size = ScratchViewComplex::shmem_size(dim);
+            Kokkos::parallel_for(
+                "qftTeamFunctor",
+                TeamPolicy(length / dim, Kokkos::AUTO)
+                    .set_scratch_size(0, Kokkos::PerTeam(scratch_size)),
+                qftTeamFunctor<fp_t>(*data_, num_qubits, wires, inverse));
+            return;
+        }
+        Kokkos::parallel_for(
+            Kokkos::RangePolicy<KokkosExecSpace>(0, length),
+            qftBitReversalFunctor<fp_t>(*data_, num_qubits, wires));
+        auto butterfly =
+            qftButterflyFunctor<fp_t>(*data_, num_qubits, wires, inverse);
+        for (size_t stage = 0; stage < wires.size(); stage++) {
+            butterfly.stage = stage;
+            Kokkos::parallel_for(
+                Kokkos::RangePolicy<KokkosExecSpace>(0, length / 2),
+                butterfly);
+        }
+    }
+
     /**
      * @brief Apply a MultiRZ generator to the state vector using a matrix
      *
@@ -752,6 +952,101 @@ class StateVectorKokkos final
         return data_;
     }
 
+    /**
+     * @brief Get the amplitudes of the given computational basis states.
+     *
+     * Only the requested amplitudes are gathered on the device and copied to
+     * the host.
+     *
+     * @param indices Basis-state indices.
+     * @return Amplitudes in the order of `indices`.
+     */
+    [[nodiscard]] auto getAmplitudes(const std::vector<size_t> &indices) const
+        -> std::vector<ComplexT> {
+        this->checkAmplitudeIndices(indices);
+        std::vector<ComplexT> amplitudes(indices.size());
+        if (indices.empty()) {
+            return amplitudes;
+        }
+        KokkosSizeTVector d_indices("d_indices", indices.size());
+        KokkosVector d_amplitudes("d_amplitudes", indices.size());
+        Kokkos::deep_copy(d_indices, UnmanagedConstSizeTHostView(
+                                         indices.data(), indices.size()));
+        KokkosVector sv_view =
+            getView(); // circumvent error capturing this with KOKKOS_LAMBDA
+        Kokkos::parallel_for(
+            indices.size(), KOKKOS_LAMBDA(const std::size_t k) {
+                d_amplitudes(k) = sv_view(d_indices(k));
+            });
+        Kokkos::deep_copy(
+            UnmanagedComplexHostView(amplitudes.data(), amplitudes.size()),
+            d_amplitudes);
+        return amplitudes;
+    }
+
+    /**
+     * @brief Get the amplitudes of a contiguous range of basis states.
+     *
+     * @param begin First basis-state index.
+     * @param end One past the last basis-state index.
+     * @return Amplitudes of basis states `[begin, end)`.
+     */
+    [[nodiscard]] auto getAmplitudesRange(size_t begin, size_t end) const
+        -> std::vector<ComplexT> {
+        this->checkAmplitudeRange(begin, end);
+        std::vector<ComplexT> amplitudes(end - begin);
+        Kokkos::deep_copy(
+            UnmanagedComplexHostView(amplitudes.data(), amplitudes.size()),
+            Kokkos::subview(getView(), std::make_pair(begin, end)));
+        return amplitudes;
+    }
+
+    /**
+     * @brief Get the amplitudes of the basis states where the given wires
+     * take fixed values.
+     *
+     * @param wires Wires to fix.
+     * @param values Bit value (0 or 1) of each wire.
+     * @return `2^(n - wires.size())` amplitudes, ordered as basis states of
+     * the remaining wires.
+     */
+    [[nodiscard]] auto
+    getAmplitudesSlice(const std::vector<size_t> &wires,
+                       const std::vector<size_t> &values) const
+        -> std::vector<ComplexT> {
+        std::vector<size_t> parity;
+        size_t fixed_mask{0};
+        std::tie(parity, fixed_mask) =
+            this->getAmplitudesSliceMasks(wires, values);
+        if (wires.empty()) {
+            return getAmplitudesRange(0, this->getLength());
+        }
+
+        const size_t num_amplitudes =
+            exp2(this->getNumQubits() - wires.size());
+        const size_t num_parity = parity.size();
+        KokkosSizeTVector d_parity("d_parity", num_parity);
+        Kokkos::deep_copy(d_parity, UnmanagedConstSizeTHostView(
+                                        parity.data(), parity.size()));
+        KokkosVector d_amplitudes("d_amplitudes", num_amplitudes);
+        KokkosVector sv_view =
+            getView(); // circumvent error capturing this with KOKKOS_LAMBDA
+        Kokkos::parallel_for(
+            num_amplitudes, KOKKOS_LAMBDA(const std::size_t k) {
+                std::size_t idx = (k & d_parity(0));
+                for (std::size_t i = 1; i < num_parity; i++) {
+                    idx |= ((k << i) & d_parity(i));
+                }
+                d_amplitudes(k) = sv_view(idx | fixed_mask);
+            });
+
+        std::vector<ComplexT> amplitudes(num_amplitudes);
+        Kokkos::deep_copy(
+            UnmanagedComplexHostView(amplitudes.data(), amplitudes.size()),
+            d_amplitudes);
+        return amplitudes;
+    }
+
     /**
      * @brief Copy data from the host space to the device space.
      *
@@ -776,78 +1071,149 @@ class StateVectorKokkos final
         Kokkos::deep_copy(*data_, vector_to_copy);
     }
 
-  private:
-    std::unordered_map<std::string, GateOperation> gates_indices_;
-    std::unordered_map<std::string, GeneratorOperation> generators_indices_;
+    /**
+     * @brief Take a snapshot of the state vector on the device.
+     *
+     * The snapshot is a device view allocated without initialisation, as it
+     * is overwritten right away.
+     */
+    [[nodiscard]] auto snapshot() const -> KokkosVector {
+        KokkosVector snap(Kokkos::ViewAllocateWithoutInitializing("snapshot_"),
+                          getLength());
+        Kokkos::deep_copy(snap, *data_);
+        return snap;
+    }
+
+    /**
+     * @brief Take a snapshot of the state vector into an existing device
+     * buffer, which is reallocated only if its size does not match. Reusing
+     * the same buffer across snapshots avoids repeated device allocations.
+     *
+     * @param buffer Device buffer receiving the snapshot.
+     */
+    void snapshot(KokkosVector &buffer) const {
+        if (buffer.size() != getLength()) {
+            buffer = KokkosVector(
+                Kokkos::ViewAllocateWithoutInitializing("snapshot_"),
+                getLength());
+        }
+        Kokkos::deep_copy(buffer, *data_);
+    }
+
+    /**
+     * @brief Restore the state vector from a snapshot.
+     *
+     * @param snap Snapshot taken from a state vector with the same number of
+     * qubits.
+     */
+    void restore(const KokkosVector &snap) {
+        PL_ABORT_IF_NOT(snap.size() == getLength(),
+                        "The snapshot must have the same number of qubits as "
+                        "the state vector.");
+        Kokkos::deep_copy(*data_, snap);
+    }
 
+    /**
+     * @brief Fork the state vector into a new state vector on the device.
+     */
+    [[nodiscard]] auto fork() const -> StateVectorKokkos {
+        return StateVectorKokkos(*this);
+    }
+
+  private:
     size_t num_qubits_;
     std::mutex init_mutex_;
     std::unique_ptr<KokkosVector> data_;
     inline static bool is_exit_reg_ = false;
     // clang-format off
     /**
-    * @brief Register gate operations in the gates_indices_ attribute:
+    * @brief Map from gate names to GateOperation enumeration keywords.
+    *        Built on first use and shared by all statevectors.
+    */
+    static auto gates_indices_()
+        -> const std::unordered_map<std::string, GateOperation> & {
+        static const auto gates_indices = init_gates_indices_();
+        return gates_indices;
+    }
+    /**
+    * @brief Map from generator names to GeneratorOperation enumeration
+    *        keywords. Built on first use and shared by all statevectors.
+    */
+    static auto generators_indices_()
+        -> const std::unordered_map<std::string, GeneratorOperation> & {
+        static const auto generators_indices = init_generators_indices_();
+        return generators_indices;
+    }
+    /**
+    * @brief Build the gate map:
     *        an unordered_map mapping strings to GateOperation enumeration keywords.
     */
-    void init_gates_indices_() {
-        gates_indices_["PauliX"]                = GateOperation::PauliX;
-        gates_indices_["PauliY"]                = GateOperation::PauliY;
-        gates_indices_["PauliZ"]                = GateOperation::PauliZ;
-        gates_indices_["Hadamard"]              = GateOperation::Hadamard;
-        gates_indices_["S"]                     = GateOperation::S;
-        gates_indices_["T"]                     = GateOperation::T;
-        gates_indices_["RX"]                    = GateOperation::RX;
-        gates_indices_["RY"]                    = GateOperation::RY;
-        gates_indices_["RZ"]                    = GateOperation::RZ;
-        gates_indices_["PhaseShift"]            = GateOperation::PhaseShift;
-        gates_indices_["Rot"]                   = GateOperation::Rot;
-        gates_indices_["CY"]                    = GateOperation::CY;
-        gates_indices_["CZ"]                    = GateOperation::CZ;
-        gates_indices_["CNOT"]                  = GateOperation::CNOT;
-        gates_indices_["SWAP"]                  = GateOperation::SWAP;
-        gates_indices_["ControlledPhaseShift"]  = GateOperation::ControlledPhaseShift;
-        gates_indices_["CRX"]                   = GateOperation::CRX;
-        gates_indices_["CRY"]                   = GateOperation::CRY;
-        gates_indices_["CRZ"]                   = GateOperation::CRZ;
-        gates_indices_["CRot"]                  = GateOperation::CRot;
-        gates_indices_["IsingXX"]               = GateOperation::IsingXX;
-        gates_indices_["IsingXY"]               = GateOperation::IsingXY;
-        gates_indices_["IsingYY"]               = GateOperation::IsingYY;
-        gates_indices_["IsingZZ"]               = GateOperation::IsingZZ;
-        gates_indices_["SingleExcitation"]      = GateOperation::SingleExcitation;
-        gates_indices_["SingleExcitationMinus"] = GateOperation::SingleExcitationMinus;
-        gates_indices_["SingleExcitationPlus"]  = GateOperation::SingleExcitationPlus;
-        gates_indices_["DoubleExcitation"]      = GateOperation::DoubleExcitation;
-        gates_indices_["DoubleExcitationMinus"] = GateOperation::DoubleExcitationMinus;
-        gates_indices_["DoubleExcitationPlus"]  = GateOperation::DoubleExcitationPlus;
-        gates_indices_["MultiRZ"]               = GateOperation::MultiRZ;
-        gates_indices_["CSWAP"]                 = GateOperation::CSWAP;
-        gates_indices_["Toffoli"]               = GateOperation::Toffoli;
-    }
-    /**
-    * @brief Register generator operations in the generators_indices_ attribute:
+    static auto init_gates_indices_()
+        -> std::unordered_map<std::string, GateOperation> {
+        std::unordered_map<std::string, GateOperation> gates_indices;
+        gates_indices["PauliX"]                = GateOperation::PauliX;
+        gates_indices["PauliY"]                = GateOperation::PauliY;
+        gates_indices["PauliZ"]                = GateOperation::PauliZ;
+        gates_indices["Hadamard"]              = GateOperation::Hadamard;
+        gates_indices["S"]                     = GateOperation::S;
+        gates_indices["T"]                     = GateOperation::T;
+        gates_indices["RX"]                    = GateOperation::RX;
+        gates_indices["RY"]                    = GateOperation::RY;
+        gates_indices["RZ"]                    = GateOperation::RZ;
+        gates_indices["PhaseShift"]            = GateOperation::PhaseShift;
+        gates_indices["Rot"]                   = GateOperation::Rot;
+        gates_indices["CY"]                    = GateOperation::CY;
+        gates_indices["CZ"]                    = GateOperation::CZ;
+        gates_indices["CNOT"]                  = GateOperation::CNOT;
+        gates_indices["SWAP"]                  = GateOperation::SWAP;
+        gates_indices["ControlledPhaseShift"]  = GateOperation::ControlledPhaseShift;
+        gates_indices["CRX"]                   = GateOperation::CRX;
+        gates_indices["CRY"]                   = GateOperation::CRY;
+        gates_indices["CRZ"]                   = GateOperation::CRZ;
+        gates_indices["CRot"]                  = GateOperation::CRot;
+        gates_indices["IsingXX"]               = GateOperation::IsingXX;
+        gates_indices["IsingXY"]               = GateOperation::IsingXY;
+        gates_indices["IsingYY"]               = GateOperation::IsingYY;
+        gates_indices["IsingZZ"]               = GateOperation::IsingZZ;
+        gates_indices["SingleExcitation"]      = GateOperation::SingleExcitation;
+        gates_indices["SingleExcitationMinus"] = GateOperation::SingleExcitationMinus;
+        gates_indices["SingleExcitationPlus"]  = GateOperation::SingleExcitationPlus;
+        gates_indices["DoubleExcitation"]      = GateOperation::DoubleExcitation;
+        gates_indices["DoubleExcitationMinus"] = GateOperation::DoubleExcitationMinus;
+        gates_indices["DoubleExcitationPlus"]  = GateOperation::DoubleExcitationPlus;
+        gates_indices["MultiRZ"]               = GateOperation::MultiRZ;
+        gates_indices["QFT"]                   = GateOperation::QFT;
+        gates_indices["CSWAP"]                 = GateOperation::CSWAP;
+        gates_indices["Toffoli"]               = GateOperation::Toffoli;
+        return gates_indices;
+    }
+    /**
+    * @brief Build the generator map:
     *        an unordered_map mapping strings to GateOperation enumeration keywords.
     */
-    void init_generators_indices_() {
-        generators_indices_["RX"]                    = GeneratorOperation::RX;
-        generators_indices_["RY"]                    = GeneratorOperation::RY;
-        generators_indices_["RZ"]                    = GeneratorOperation::RZ;
-        generators_indices_["ControlledPhaseShift"]  = GeneratorOperation::ControlledPhaseShift;
-        generators_indices_["CRX"]                   = GeneratorOperation::CRX;
-        generators_indices_["CRY"]                   = GeneratorOperation::CRY;
-        generators_indices_["CRZ"]                   = GeneratorOperation::CRZ;
-        generators_indices_["IsingXX"]               = GeneratorOperation::IsingXX;
-        generators_indices_["IsingXY"]               = GeneratorOperation::IsingXY;
-        generators_indices_["IsingYY"]               = GeneratorOperation::IsingYY;
-        generators_indices_["IsingZZ"]               = GeneratorOperation::IsingZZ;
-        generators_indices_["SingleExcitation"]      = GeneratorOperation::SingleExcitation;
-        generators_indices_["SingleExcitationMinus"] = GeneratorOperation::SingleExcitationMinus;
-        generators_indices_["SingleExcitationPlus"]  = GeneratorOperation::SingleExcitationPlus;
-        generators_indices_["DoubleExcitation"]      = GeneratorOperation::DoubleExcitation;
-        generators_indices_["DoubleExcitationMinus"] = GeneratorOperation::DoubleExcitationMinus;
-        generators_indices_["DoubleExcitationPlus"]  = GeneratorOperation::DoubleExcitationPlus;
-        generators_indices_["PhaseShift"]            = GeneratorOperation::PhaseShift;
-        generators_indices_["MultiRZ"]               = GeneratorOperation::MultiRZ;
+    static auto init_generators_indices_()
+        -> std::unordered_map<std::string, GeneratorOperation> {
+        std::unordered_map<std::string, GeneratorOperation> generators_indices;
+        generators_indices["RX"]                    = GeneratorOperation::RX;
+        generators_indices["RY"]                    = GeneratorOperation::RY;
+        generators_indices["RZ"]                    = GeneratorOperation::RZ;
+        generators_indices["ControlledPhaseShift"]  = GeneratorOperation::ControlledPhaseShift;
+        generators_indices["CRX"]                   = GeneratorOperation::CRX;
+        generators_indices["CRY"]                   = GeneratorOperation::CRY;
+        generators_indices["CRZ"]                   = GeneratorOperation::CRZ;
+        generators_indices["IsingXX"]               = GeneratorOperation::IsingXX;
+        generators_indices["IsingXY"]               = GeneratorOperation::IsingXY;
+        generators_indices["IsingYY"]               = GeneratorOperation::IsingYY;
+        generators_indices["IsingZZ"]               = GeneratorOperation::IsingZZ;
+        generators_indices["SingleExcitation"]      = GeneratorOperation::SingleExcitation;
+        generators_indices["SingleExcitationMinus"] = GeneratorOperation::SingleExcitationMinus;
+        generators_indices["SingleExcitationPlus"]  = GeneratorOperation::SingleExcitationPlus;
+        generators_indices["DoubleExcitation"]      = GeneratorOperation::DoubleExcitation;
+        generators_indices["DoubleExcitationMinus"] = GeneratorOperation::DoubleExcitationMinus;
+        generators_indices["DoubleExcitationPlus"]  = GeneratorOperation::DoubleExcitationPlus;
+        generators_indices["PhaseShift"]            = GeneratorOperation::PhaseShift;
+        generators_indices["MultiRZ"]               = GeneratorOperation::MultiRZ;
+        return generators_indices;
     }
     // clang-format on
 };
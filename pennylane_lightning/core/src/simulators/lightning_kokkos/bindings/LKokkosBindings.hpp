@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #pragma once
+#include <algorithm>
 #include <set>
 #include <sstream>
 #include <string>
@@ -57,10 +58,17 @@ void registerBackendClassSpecificBindings(PyClass &pyclass) {
         typename StateVectorT::PrecisionT; // Statevector's precision
     using ComplexT = typename StateVectorT::ComplexT;
     using ParamT = PrecisionT; // Parameter's data precision
+    using NumpyComplexT = std::complex<ParamT>; // Layout of ComplexT in numpy
     using np_arr_c = py::array_t<std::complex<ParamT>,
                                  py::array::c_style | py::array::forcecast>;
 
     registerGatesForStateVector<StateVectorT>(pyclass);
+    pyclass.def("applyDiagonal", &registerDiagonal<StateVectorT>,
+                "Apply a diagonal matrix, given by its diagonal, to wires.");
+    pyclass.def("applyReflection", &registerReflection<StateVectorT>,
+                "Apply the reflection 2|s><s| - I about a state of wires.");
+    pyclass.def("applyGroverOperator", &StateVectorT::applyGroverOperator,
+                "Apply the Grover diffusion operator to wires.");
 
     pyclass
         .def(py::init([](std::size_t num_qubits) {
@@ -104,6 +112,17 @@ void registerBackendClassSpecificBindings(PyClass &pyclass) {
                 }
             },
             "Synchronize data from the GPU device to host.")
+        .def(
+            "DeviceToHost",
+            [](StateVectorT &device_sv) {
+                py::array_t<std::complex<ParamT>> host_sv(
+                    device_sv.getLength());
+                device_sv.DeviceToHost(
+                    static_cast<ComplexT *>(host_sv.request().ptr),
+                    device_sv.getLength());
+                return host_sv;
+            },
+            "Copy the state vector from the device into a new host array.")
         .def("HostToDevice",
              py::overload_cast<ComplexT *, size_t>(&StateVectorT::HostToDevice),
              "Synchronize data from the host device to GPU.")
@@ -119,6 +138,29 @@ void registerBackendClassSpecificBindings(PyClass &pyclass) {
                 }
             },
             "Synchronize data from the host device to GPU.")
+        .def(
+            "getAmplitudes",
+            [](const StateVectorT &sv, const std::vector<size_t> &indices) {
+                return createNumpyArrayFromVector<ComplexT, NumpyComplexT>(
+                    sv.getAmplitudes(indices));
+            },
+            "Get the amplitudes of the given basis states.")
+        .def(
+            "getAmplitudesRange",
+            [](const StateVectorT &sv, size_t begin, size_t end) {
+                return createNumpyArrayFromVector<ComplexT, NumpyComplexT>(
+                    sv.getAmplitudesRange(begin, end));
+            },
+            "Get the amplitudes of the basis states in [begin, end).")
+        .def(
+            "getAmplitudesSlice",
+            [](const StateVectorT &sv, const std::vector<size_t> &wires,
+               const std::vector<size_t> &values) {
+                return createNumpyArrayFromVector<ComplexT, NumpyComplexT>(
+                    sv.getAmplitudesSlice(wires, values));
+            },
+            "Get the amplitudes of the basis states with the given wires "
+            "fixed to the given bit values.")
         .def(
             "apply",
             [](StateVectorT &sv, const std::string &str,
@@ -266,6 +308,30 @@ void registerBackendSpecificObservables(py::module_ &m) {
                 return self == other_cast;
             },
             "Compare two observables");
+
+    class_name = "ProjectorObsC" + bitsize;
+    py::class_<ProjectorObs<StateVectorT>,
+               std::shared_ptr<ProjectorObs<StateVectorT>>,
+               Observable<StateVectorT>>(m, class_name.c_str(),
+                                         py::module_local())
+        .def(py::init([](const std::vector<size_t> &state,
+                         const std::vector<size_t> &wires) {
+            return ProjectorObs<StateVectorT>(state, wires);
+        }))
+        .def("__repr__", &ProjectorObs<StateVectorT>::getObsName)
+        .def("get_wires", &ProjectorObs<StateVectorT>::getWires,
+             "Get wires of observables")
+        .def(
+            "__eq__",
+            [](const ProjectorObs<StateVectorT> &self,
+               py::handle other) -> bool {
+                if (!py::isinstance<ProjectorObs<StateVectorT>>(other)) {
+                    return false;
+                }
+                auto other_cast = other.cast<ProjectorObs<StateVectorT>>();
+                return self == other_cast;
+            },
+            "Compare two observables");
 }
 
 /**
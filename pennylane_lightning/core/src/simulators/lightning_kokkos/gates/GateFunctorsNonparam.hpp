@@ -13,15 +13,22 @@
 // limitations under the License.
 #pragma once
 
+#include <cmath>
+#include <tuple>
+#include <vector>
+
 #include <Kokkos_Core.hpp>
 #include <Kokkos_StdAlgorithms.hpp>
 
 #include "BitUtil.hpp"
+#include "BitUtilKokkos.hpp"
 
 /// @cond DEV
 namespace {
 using namespace Pennylane::Util;
 using Kokkos::Experimental::swap;
+using Pennylane::LightningKokkos::Util::one;
+using Pennylane::LightningKokkos::Util::wires2Parity;
 } // namespace
 /// @endcond
 
@@ -527,4 +534,185 @@ template <class PrecisionT, bool inverse = false> struct toffoliFunctor {
     }
 };
 
+/**
+ * @brief Amplitudes of the blocks sharing the bits outside a set of wires,
+ * indexed by their block and by their index `j` in the basis of the wires,
+ * with `wires[0]` as the most significant bit of `j`.
+ */
+template <class PrecisionT> struct qftBlocks {
+    Kokkos::View<Kokkos::complex<PrecisionT> *> arr;
+    Kokkos::View<std::size_t *> parity;
+    Kokkos::View<std::size_t *> rev_wire_shifts;
+    std::size_t n_wires;
+
+    qftBlocks(Kokkos::View<Kokkos::complex<PrecisionT> *> &arr_,
+              std::size_t num_qubits, const std::vector<size_t> &wires)
+        : arr{arr_}, n_wires{wires.size()} {
+        std::tie(parity, rev_wire_shifts) = wires2Parity(num_qubits, wires);
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    std::size_t index(const std::size_t k, const std::size_t j) const {
+        std::size_t idx = (k & parity(0));
+        for (std::size_t i = 1; i < parity.size(); i++) {
+            idx |= ((k << i) & parity(i));
+        }
+        for (std::size_t w = 0; w < n_wires; w++) {
+            if ((j & (one << w)) != 0) {
+                idx |= rev_wire_shifts(w);
+            }
+        }
+        return idx;
+    }
+};
+
+/**
+ * @brief Bit-reversal permutation of each block, the first step of the
+ * radix-2 QFT. Work item `i` handles the amplitude `i mod 2^n_wires` of the
+ * block `i / 2^n_wires`.
+ */
+template <class PrecisionT> struct qftBitReversalFunctor {
+    qftBlocks<PrecisionT> blocks;
+
+    qftBitReversalFunctor(Kokkos::View<Kokkos::complex<PrecisionT> *> &arr_,
+                          std::size_t num_qubits,
+                          const std::vector<size_t> &wires)
+        : blocks{arr_, num_qubits, wires} {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const std::size_t i) const {
+        const std::size_t n_wires = blocks.n_wires;
+        const std::size_t k = i >> n_wires;
+        const std::size_t j = i & ((one << n_wires) - 1);
+        std::size_t r = 0;
+        for (std::size_t b = 0; b < n_wires; b++) {
+            r |= ((j >> b) & 1U) << (n_wires - 1 - b);
+        }
+        if (j < r) {
+            swap(blocks.arr(blocks.index(k, j)),
+                 blocks.arr(blocks.index(k, r)));
+        }
+    }
+};
+
+/**
+ * @brief One stage of radix-2 butterflies of the QFT, with twiddles
+ * `exp(+-i pi m / 2^stage)`. The first stage also applies the
+ * normalization. Work item `i` handles the butterfly `i mod 2^(n_wires-1)`
+ * of the block `i / 2^(n_wires-1)`.
+ */
+template <class PrecisionT> struct qftButterflyFunctor {
+    qftBlocks<PrecisionT> blocks;
+    std::size_t stage{0};
+    PrecisionT sign;
+    PrecisionT norm;
+
+    qftButterflyFunctor(Kokkos::View<Kokkos::complex<PrecisionT> *> &arr_,
+                        std::size_t num_qubits,
+                        const std::vector<size_t> &wires, bool inverse)
+        : blocks{arr_, num_qubits, wires}, sign{inverse ? PrecisionT{-1}
+                                                        : PrecisionT{1}},
+          norm{static_cast<PrecisionT>(
+              1.0 / std::sqrt(static_cast<double>(one << wires.size())))} {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const std::size_t i) const {
+        const std::size_t n_half = blocks.n_wires - 1;
+        const std::size_t k = i >> n_half;
+        const std::size_t p = i & ((one << n_half) - 1);
+        const std::size_t half = one << stage;
+        const std::size_t m = p & (half - 1);
+        const std::size_t j0 = ((p >> stage) << (stage + 1)) | m;
+        const std::size_t i0 = blocks.index(k, j0);
+        const std::size_t i1 = blocks.index(k, j0 + half);
+
+        const PrecisionT angle = sign * static_cast<PrecisionT>(M_PI) *
+                                 static_cast<PrecisionT>(m) /
+                                 static_cast<PrecisionT>(half);
+        const Kokkos::complex<PrecisionT> v0 = blocks.arr(i0);
+        const Kokkos::complex<PrecisionT> v1 =
+            Kokkos::complex<PrecisionT>{Kokkos::cos(angle),
+                                        Kokkos::sin(angle)} *
+            blocks.arr(i1);
+        const PrecisionT scale = (stage == 0) ? norm : PrecisionT{1};
+        blocks.arr(i0) = scale * (v0 + v1);
+        blocks.arr(i1) = scale * (v0 - v1);
+    }
+};
+
+/**
+ * @brief Whole QFT of one block per team. The block is gathered in
+ * bit-reversed order into team scratch memory, transformed there by all the
+ * butterfly stages and scattered back, so the state vector is read and
+ * written once.
+ */
+template <class PrecisionT> struct qftTeamFunctor {
+    using ScratchViewComplex =
+        Kokkos::View<Kokkos::complex<PrecisionT> *,
+                     Kokkos::DefaultExecutionSpace::scratch_memory_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+    using MemberType = Kokkos::TeamPolicy<>::member_type;
+
+    /// Largest number of wires whose blocks are transformed in team scratch
+    /// memory; 2^11 double-precision amplitudes fill 32 KiB.
+    static constexpr std::size_t max_wires = 11;
+
+    qftBlocks<PrecisionT> blocks;
+    std::size_t dim;
+    PrecisionT sign;
+    PrecisionT norm;
+
+    qftTeamFunctor(Kokkos::View<Kokkos::complex<PrecisionT> *> &arr_,
+                   std::size_t num_qubits, const std::vector<size_t> &wires,
+                   bool inverse)
+        : blocks{arr_, num_qubits, wires}, dim{one << wires.size()},
+          sign{inverse ? PrecisionT{-1} : PrecisionT{1}},
+          norm{static_cast<PrecisionT>(
+              1.0 / std::sqrt(static_cast<double>(one << wires.size())))} {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const MemberType &teamMember) const {
+        const std::size_t k = teamMember.league_rank();
+        const std::size_t n_wires = blocks.n_wires;
+        ScratchViewComplex block(teamMember.team_scratch(0), dim);
+
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(teamMember, dim), [&](const std::size_t j) {
+                std::size_t r = 0;
+                for (std::size_t b = 0; b < n_wires; b++) {
+                    r |= ((j >> b) & 1U) << (n_wires - 1 - b);
+                }
+                block(r) = norm * blocks.arr(blocks.index(k, j));
+            });
+        teamMember.team_barrier();
+
+        for (std::size_t stage = 0; stage < n_wires; stage++) {
+            const std::size_t half = one << stage;
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(teamMember, dim / 2),
+                [&](const std::size_t p) {
+                    const std::size_t m = p & (half - 1);
+                    const std::size_t j0 = ((p >> stage) << (stage + 1)) | m;
+                    const PrecisionT angle =
+                        sign * static_cast<PrecisionT>(M_PI) *
+                        static_cast<PrecisionT>(m) /
+                        static_cast<PrecisionT>(half);
+                    const Kokkos::complex<PrecisionT> v0 = block(j0);
+                    const Kokkos::complex<PrecisionT> v1 =
+                        Kokkos::complex<PrecisionT>{Kokkos::cos(angle),
+                                                    Kokkos::sin(angle)} *
+                        block(j0 + half);
+                    block(j0) = v0 + v1;
+                    block(j0 + half) = v0 - v1;
+                });
+            teamMember.team_barrier();
+        }
+
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(teamMember, dim),
+                             [&](const std::size_t j) {
+                                 blocks.arr(blocks.index(k, j)) = block(j);
+                             });
+    }
+};
+
 } // namespace Pennylane::LightningKokkos::Functors
\ No newline at end of file
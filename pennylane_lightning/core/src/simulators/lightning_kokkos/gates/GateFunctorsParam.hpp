@@ -107,6 +107,135 @@ template <class Precision> struct multiQubitOpFunctor {
     }
 };
 
+/**
+ * @brief Multiply every amplitude by the diagonal entry selected by the bits
+ * of its index on the target wires.
+ */
+template <class Precision> struct diagonalOpFunctor {
+    using KokkosComplexVector = Kokkos::View<Kokkos::complex<Precision> *>;
+    using KokkosIntVector = Kokkos::View<std::size_t *>;
+
+    KokkosComplexVector arr;
+    KokkosComplexVector diag;
+    KokkosIntVector rev_wire_shifts;
+    std::size_t n_wires;
+
+    diagonalOpFunctor(KokkosComplexVector &arr_, std::size_t num_qubits_,
+                      const KokkosComplexVector &diag_,
+                      const std::vector<std::size_t> &wires_) {
+        arr = arr_;
+        diag = diag_;
+        n_wires = wires_.size();
+        std::tie(std::ignore, rev_wire_shifts) =
+            wires2Parity(num_qubits_, wires_);
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const std::size_t k) const {
+        std::size_t diag_idx = 0;
+        for (std::size_t i = 0; i < n_wires; i++) {
+            if ((k & rev_wire_shifts(i)) != 0) {
+                diag_idx |= (one << i);
+            }
+        }
+        arr(k) *= diag(diag_idx);
+    }
+};
+
+/**
+ * @brief Reflect the amplitudes of the target wires about a state |s>,
+ * applying `2|s><s| - I` to every block of amplitudes sharing the bits
+ * outside the wires.
+ *
+ * As a team functor, each team handles one block: a team reduction computes
+ * the overlap of the block with |s>, then the team updates the block in
+ * place. `term` and `update` let a flat reduction and a flat update handle a
+ * single block spanning the whole state.
+ */
+template <class Precision> struct reflectionFunctor {
+    using ComplexT = Kokkos::complex<Precision>;
+    using KokkosComplexVector = Kokkos::View<ComplexT *>;
+    using KokkosIntVector = Kokkos::View<std::size_t *>;
+    using MemberType = Kokkos::TeamPolicy<>::member_type;
+
+    KokkosComplexVector arr;
+    KokkosComplexVector state;
+    KokkosIntVector parity;
+    KokkosIntVector rev_wire_shifts;
+    std::size_t dim;
+    std::size_t n_wires;
+    bool uniform;
+    /// Scale of the overlap: 2, or 2 / dim for the uniform superposition.
+    Precision scale;
+
+    /**
+     * @param state_ State |s>, with `wires_[0]` as the most significant bit.
+     * An empty view stands for the uniform superposition.
+     */
+    reflectionFunctor(KokkosComplexVector &arr_, std::size_t num_qubits_,
+                      const KokkosComplexVector &state_,
+                      const std::vector<std::size_t> &wires_) {
+        arr = arr_;
+        state = state_;
+        n_wires = wires_.size();
+        dim = one << n_wires;
+        uniform = (state_.size() == 0);
+        scale = uniform ? Precision{2} / static_cast<Precision>(dim)
+                        : Precision{2};
+        std::tie(parity, rev_wire_shifts) = wires2Parity(num_qubits_, wires_);
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    std::size_t blockBase(const std::size_t k) const {
+        std::size_t base = (k & parity(0));
+        for (std::size_t i = 1; i < parity.size(); i++) {
+            base |= ((k << i) & parity(i));
+        }
+        return base;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    std::size_t index(const std::size_t base, const std::size_t i) const {
+        std::size_t idx = base;
+        for (std::size_t w = 0; w < n_wires; w++) {
+            if ((i & (one << w)) != 0) {
+                idx |= rev_wire_shifts(w);
+            }
+        }
+        return idx;
+    }
+
+    /// Contribution of amplitude `i` of a block to its unscaled overlap.
+    KOKKOS_INLINE_FUNCTION
+    ComplexT term(const std::size_t base, const std::size_t i) const {
+        const ComplexT amp = arr(index(base, i));
+        return uniform ? amp : Kokkos::conj(state(i)) * amp;
+    }
+
+    /// Reflect amplitude `i` of a block given its scaled overlap.
+    KOKKOS_INLINE_FUNCTION
+    void update(const std::size_t base, const std::size_t i,
+                const ComplexT &overlap) const {
+        const std::size_t idx = index(base, i);
+        arr(idx) = (uniform ? overlap : state(i) * overlap) - arr(idx);
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const MemberType &teamMember) const {
+        const std::size_t base = blockBase(teamMember.league_rank());
+        ComplexT overlap{0.0, 0.0};
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange(teamMember, dim),
+            [&](const std::size_t i, ComplexT &sum) { sum += term(base, i); },
+            overlap);
+        overlap *= scale;
+        teamMember.team_barrier();
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(teamMember, dim),
+            [&](const std::size_t i) { update(base, i, overlap); });
+    }
+};
+
 template <class PrecisionT, bool inverse = false> struct phaseShiftFunctor {
     Kokkos::View<Kokkos::complex<PrecisionT> *> arr;
 
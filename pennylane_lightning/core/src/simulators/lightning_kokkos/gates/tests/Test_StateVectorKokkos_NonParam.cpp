@@ -12,9 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include <algorithm>
+#include <cmath>
 #include <complex>
 #include <cstddef>
 #include <limits>
+#include <numeric>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -39,6 +41,7 @@ using namespace Pennylane::LightningKokkos;
 using namespace Pennylane::Gates; // getHadamard, getCNOT,
                                   // getToffoli
 using namespace Pennylane::Util;
+using Pennylane::LightningKokkos::Functors::qftTeamFunctor;
 using std::size_t;
 } // namespace
 /// @endcond
@@ -710,6 +713,94 @@ TEMPLATE_TEST_CASE("StateVectorKokkos::applyMultiQubitOp",
     }
 }
 
+TEMPLATE_TEST_CASE("StateVectorKokkos::applyQFT",
+                   "[StateVectorKokkos_Nonparam][Inverse]", float, double) {
+    using ComplexT = StateVectorKokkos<TestType>::ComplexT;
+    const bool inverse = GENERATE(true, false);
+    const size_t num_qubits = 4;
+    using UnmanagedComplexHostView =
+        Kokkos::View<ComplexT *, Kokkos::HostSpace,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    std::vector<ComplexT> init_state(exp2(num_qubits));
+    for (size_t i = 0; i < init_state.size(); i++) {
+        init_state[i] = ComplexT{static_cast<TestType>(0.1 * (i + 1)),
+                                 static_cast<TestType>(0.05 * i)};
+    }
+
+    for (const auto &wires : std::vector<std::vector<size_t>>{
+             {2}, {3, 0}, {0, 2, 1}, {1, 3, 0, 2}}) {
+        DYNAMIC_SECTION("QFT on " << wires.size() << " wires") {
+            // QFT matrix exp(+-2 pi i m n / dim) / sqrt(dim)
+            const size_t dim = exp2(wires.size());
+            const double sign = inverse ? -1.0 : 1.0;
+            std::vector<ComplexT> matrix(dim * dim);
+            for (size_t m = 0; m < dim; m++) {
+                for (size_t n = 0; n < dim; n++) {
+                    const double angle = sign * 2 * M_PI *
+                                         static_cast<double>((m * n) % dim) /
+                                         static_cast<double>(dim);
+                    matrix[m * dim + n] =
+                        ComplexT{static_cast<TestType>(std::cos(angle) /
+                                                       std::sqrt(dim)),
+                                 static_cast<TestType>(std::sin(angle) /
+                                                       std::sqrt(dim))};
+                }
+            }
+
+            StateVectorKokkos<TestType> sv_qft{num_qubits};
+            StateVectorKokkos<TestType> sv_mq{num_qubits};
+            sv_qft.HostToDevice(init_state.data(), init_state.size());
+            sv_mq.HostToDevice(init_state.data(), init_state.size());
+
+            sv_qft.applyOperation("QFT", wires, inverse);
+            auto sv_qft_host = Kokkos::create_mirror_view_and_copy(
+                Kokkos::HostSpace{}, sv_qft.getView());
+
+            Kokkos::View<ComplexT *> device_matrix("device_matrix",
+                                                   matrix.size());
+            Kokkos::deep_copy(device_matrix, UnmanagedComplexHostView(
+                                                 matrix.data(), matrix.size()));
+            sv_mq.applyMultiQubitOp(device_matrix, wires, false);
+            auto sv_mq_host = Kokkos::create_mirror_view_and_copy(
+                Kokkos::HostSpace{}, sv_mq.getView());
+
+            for (size_t j = 0; j < exp2(num_qubits); j++) {
+                CHECK(imag(sv_qft_host[j]) ==
+                      Approx(imag(sv_mq_host[j])).margin(1e-5));
+                CHECK(real(sv_qft_host[j]) ==
+                      Approx(real(sv_mq_host[j])).margin(1e-5));
+            }
+        }
+    }
+
+    SECTION("QFT of a basis state beyond the team scratch size") {
+        // Blocks larger than the team scratch take one pass per stage.
+        const size_t n_wires = qftTeamFunctor<TestType>::max_wires + 1;
+        const size_t dim = exp2(n_wires);
+        const size_t x = 37;
+        std::vector<size_t> wires(n_wires);
+        std::iota(wires.begin(), wires.end(), 0);
+
+        StateVectorKokkos<TestType> sv{n_wires};
+        sv.setBasisState(x);
+        sv.applyOperation("QFT", wires, inverse);
+        auto sv_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{},
+                                                           sv.getView());
+
+        const double sign = inverse ? -1.0 : 1.0;
+        for (size_t y = 0; y < dim; y++) {
+            const double angle = sign * 2 * M_PI *
+                                 static_cast<double>((x * y) % dim) /
+                                 static_cast<double>(dim);
+            CHECK(real(sv_host[y]) ==
+                  Approx(std::cos(angle) / std::sqrt(dim)).margin(1e-5));
+            CHECK(imag(sv_host[y]) ==
+                  Approx(std::sin(angle) / std::sqrt(dim)).margin(1e-5));
+        }
+    }
+}
+
 TEMPLATE_TEST_CASE("StateVectorKokkos::applyCSWAP",
                    "[StateVectorKokkos_Nonparam]", float, double) {
     {
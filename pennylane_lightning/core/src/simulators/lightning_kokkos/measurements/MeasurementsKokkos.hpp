@@ -70,9 +70,7 @@ class Measurements final
 
   public:
     explicit Measurements(const StateVectorT &statevector)
-        : BaseType{statevector} {
-        init_expval_funcs_();
-    };
+        : BaseType{statevector} {};
 
     /**
      * @brief Templated method that returns the expectation value of named
@@ -181,6 +179,10 @@ class Measurements final
      * @return Expectation value with respect to the given observable.
      */
     PrecisionT expval(const Observable<StateVectorT> &ob) {
+        if (const auto *projector =
+                dynamic_cast<const ProjectorObsBase<StateVectorT> *>(&ob)) {
+            return projectorExpval(*projector);
+        }
         StateVectorT ob_sv{this->_statevector};
         ob.applyInPlace(ob_sv);
         return getRealOfComplexInnerProduct(this->_statevector.getView(),
@@ -226,7 +228,13 @@ class Measurements final
      */
     PrecisionT expval(const std::string &operation,
                       const std::vector<size_t> &wires) {
-        switch (expval_funcs_[operation]) {
+        const auto expval_iter = expval_funcs_().find(operation);
+        if (expval_iter == expval_funcs_().end()) {
+            PL_ABORT(
+                std::string("Expval does not exist for named observable ") +
+                operation);
+        }
+        switch (expval_iter->second) {
         case ExpValFunc::Identity:
             return applyExpValNamedFunctor<getExpectationValueIdentityFunctor,
                                            0>(wires);
@@ -337,6 +345,12 @@ class Measurements final
      * @return Variance with respect to the given observable.
      */
     auto var(const Observable<StateVectorT> &ob) -> PrecisionT {
+        if (const auto *projector =
+                dynamic_cast<const ProjectorObsBase<StateVectorT> *>(&ob)) {
+            // A projector squares to itself
+            const PrecisionT expval = projectorExpval(*projector);
+            return expval - expval * expval;
+        }
         StateVectorT ob_sv{this->_statevector};
         ob.applyInPlace(ob_sv);
 
@@ -648,19 +662,74 @@ class Measurements final
     }
 
   private:
-    std::unordered_map<std::string, ExpValFunc> expval_funcs_;
+    /**
+     * @brief Expectation value of a projector onto a computational basis
+     * state.
+     *
+     * This is the squared norm of the 2^(n-k) amplitudes whose bits on the
+     * projector wires match the projected state.
+     *
+     * @param projector Projector observable.
+     */
+    PrecisionT
+    projectorExpval(const ProjectorObsBase<StateVectorT> &projector) {
+        const size_t num_qubits = this->_statevector.getNumQubits();
+        const size_t value = projector.getBitMaskAndValue(num_qubits).second;
+
+        // Bit positions of the projector wires, in ascending order
+        std::vector<size_t> bits;
+        for (const size_t wire : projector.getWires()) {
+            bits.push_back(num_qubits - 1 - wire);
+        }
+        std::sort(bits.begin(), bits.end());
+        const size_t num_bits = bits.size();
+        KokkosSizeTVector d_bits("bits", num_bits);
+        Kokkos::deep_copy(d_bits,
+                          UnmanagedConstSizeTHostView(bits.data(), num_bits));
+
+        const Kokkos::View<ComplexT *> arr_data = this->_statevector.getView();
+        PrecisionT result = 0.0;
+        Kokkos::parallel_reduce(
+            exp2(num_qubits - num_bits),
+            KOKKOS_LAMBDA(const size_t k, PrecisionT &sum) {
+                // Insert the projector bits of the projected state into k
+                size_t idx = k;
+                for (size_t j = 0; j < num_bits; j++) {
+                    const size_t bit = d_bits(j);
+                    const size_t low = idx & ((size_t{1U} << bit) - 1);
+                    idx = ((idx >> bit) << (bit + 1)) | low;
+                }
+                const PrecisionT REAL = arr_data(idx | value).real();
+                const PrecisionT IMAG = arr_data(idx | value).imag();
+                sum += REAL * REAL + IMAG * IMAG;
+            },
+            result);
+        return result;
+    }
 
     // clang-format off
     /**
-    * @brief Register generator operations in the generators_indices_ attribute:
-    *        an unordered_map mapping strings to GateOperation enumeration keywords.
+    * @brief Map from observable names to ExpValFunc enumeration keywords.
+    *        Built on first use and shared by all measurements.
+    */
+    static auto expval_funcs_()
+        -> const std::unordered_map<std::string, ExpValFunc> & {
+        static const auto expval_funcs = init_expval_funcs_();
+        return expval_funcs;
+    }
+    /**
+    * @brief Build the observable map:
+    *        an unordered_map mapping strings to ExpValFunc enumeration keywords.
     */
-    void init_expval_funcs_() {
-        expval_funcs_["Identity"] = ExpValFunc::Identity;
-        expval_funcs_["PauliX"]   = ExpValFunc::PauliX;
-        expval_funcs_["PauliY"]   = ExpValFunc::PauliY;
-        expval_funcs_["PauliZ"]   = ExpValFunc::PauliZ;
-        expval_funcs_["Hadamard"] = ExpValFunc::Hadamard;
+    static auto init_expval_funcs_()
+        -> std::unordered_map<std::string, ExpValFunc> {
+        std::unordered_map<std::string, ExpValFunc> expval_funcs;
+        expval_funcs["Identity"] = ExpValFunc::Identity;
+        expval_funcs["PauliX"]   = ExpValFunc::PauliX;
+        expval_funcs["PauliY"]   = ExpValFunc::PauliY;
+        expval_funcs["PauliZ"]   = ExpValFunc::PauliZ;
+        expval_funcs["Hadamard"] = ExpValFunc::Hadamard;
+        return expval_funcs;
     }
     // clang-format on
 };
@@ -595,3 +595,35 @@ TEMPLATE_TEST_CASE("StateVectorKokkos::Hamiltonian_expval_Sparse",
         REQUIRE(var_values == Approx(var_values_ref).margin(1e-6));
     }
 }
+
+TEMPLATE_TEST_CASE("Test expectation value of basis-state Projector",
+                   "[StateVectorKokkos_Expval]", float, double) {
+    using StateVectorT = StateVectorKokkos<TestType>;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    auto statevector_data = createNonTrivialState<StateVectorT>();
+    StateVectorT statevector(statevector_data.data(), statevector_data.size());
+    Measurements<StateVectorT> Measurer(statevector);
+
+    const std::vector<std::pair<std::vector<size_t>, std::vector<size_t>>>
+        cases{{{1}, {0}}, {{1, 0}, {2, 0}}, {{0, 1, 1}, {0, 1, 2}}};
+
+    for (const auto &[state, wires] : cases) {
+        DYNAMIC_SECTION("Matches HermitianObs - wires = " << wires.size()) {
+            const size_t dim = size_t{1} << wires.size();
+            size_t index = 0;
+            for (size_t bit : state) {
+                index = (index << 1U) | bit;
+            }
+            std::vector<ComplexT> matrix(dim * dim, ComplexT{0.0, 0.0});
+            matrix[index * dim + index] = ComplexT{1.0, 0.0};
+
+            ProjectorObs<StateVectorT> obs(state, wires);
+            HermitianObs<StateVectorT> hermitian(matrix, wires);
+            CHECK(Measurer.expval(obs) ==
+                  Approx(Measurer.expval(hermitian)).margin(1e-6));
+            CHECK(Measurer.var(obs) ==
+                  Approx(Measurer.var(hermitian)).margin(1e-6));
+        }
+    }
+}
@@ -13,6 +13,9 @@
 // limitations under the License.
 #pragma once
 
+#include <algorithm>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include <Kokkos_Core.hpp>
@@ -94,6 +97,49 @@ class HermitianObs final : public HermitianObsBase<StateVectorT> {
         : BaseType{matrix, wires} {}
 };
 
+/**
+ * @brief Final class for projectors onto a computational basis state
+ *
+ * @tparam StateVectorT State vector class.
+ */
+template <class StateVectorT>
+class ProjectorObs final : public ProjectorObsBase<StateVectorT> {
+  private:
+    using BaseType = ProjectorObsBase<StateVectorT>;
+
+  public:
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    /**
+     * @brief Create a projector onto a computational basis state.
+     *
+     * @param state Bit taken by each wire in the basis state.
+     * @param wires Wires the observable applies to.
+     */
+    ProjectorObs(std::vector<size_t> state, std::vector<size_t> wires)
+        : BaseType{std::move(state), std::move(wires)} {}
+
+    /**
+     * @brief Zero the amplitudes of the basis states whose bits on the
+     * projector wires differ from the projected state, in place.
+     *
+     * @param sv The statevector to update
+     */
+    void applyInPlace(StateVectorT &sv) const override {
+        const auto mask_and_value = this->getBitMaskAndValue(sv.getNumQubits());
+        const size_t mask = mask_and_value.first;
+        const size_t value = mask_and_value.second;
+        auto arr_data = sv.getView();
+        Kokkos::parallel_for(
+            sv.getLength(), KOKKOS_LAMBDA(const size_t idx) {
+                if ((idx & mask) != value) {
+                    arr_data(idx) = ComplexT{0.0, 0.0};
+                }
+            });
+    }
+};
+
 /**
  * @brief Final class for TensorProdObs observables
  *
@@ -140,6 +186,66 @@ class TensorProdObs final : public TensorProdObsBase<StateVectorT> {
     }
 };
 
+/// @cond DEV
+namespace detail {
+using Pennylane::LightningKokkos::Util::multiAxpy_Kokkos;
+
+/// Number of Hamiltonian terms accumulated into the result in one pass.
+constexpr size_t hamiltonian_term_group_size = 4;
+
+/// Memory budget of the scratch states of a group of terms, in bytes.
+constexpr size_t hamiltonian_group_memory_budget = size_t{1} << 30U;
+
+// Default implementation
+template <class StateVectorT, bool use_openmp> struct HamiltonianApplyInPlace {
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using KokkosVector = typename StateVectorT::KokkosVector;
+    static void
+    run(const std::vector<PrecisionT> &coeffs,
+        const std::vector<std::shared_ptr<Observable<StateVectorT>>> &terms,
+        StateVectorT &sv) {
+        KokkosVector res("results", sv.getLength());
+        Kokkos::deep_copy(res, ComplexT{0.0, 0.0});
+
+        // One scratch state per term of a group, accumulated into res with
+        // a single multiAxpy_Kokkos pass per group. Large state vectors use
+        // fewer scratch states, down to one.
+        const size_t affordable = std::max<size_t>(
+            hamiltonian_group_memory_budget /
+                (sv.getLength() * sizeof(ComplexT)),
+            1);
+        const size_t group_size = std::min(
+            {hamiltonian_term_group_size, terms.size(), affordable});
+        std::vector<std::unique_ptr<StateVectorT>> tmps;
+        for (size_t idx = 0; idx < group_size; idx++) {
+            tmps.push_back(std::make_unique<StateVectorT>(sv));
+        }
+        Kokkos::Array<ComplexT, hamiltonian_term_group_size> group_coeffs;
+        Kokkos::Array<KokkosVector, hamiltonian_term_group_size> group_data;
+
+        for (size_t group_begin = 0; group_begin < terms.size();
+             group_begin += group_size) {
+            const size_t num_terms =
+                std::min(group_size, terms.size() - group_begin);
+            for (size_t idx = 0; idx < num_terms; idx++) {
+                if (group_begin != 0) {
+                    tmps[idx]->updateData(sv);
+                }
+                terms[group_begin + idx]->applyInPlace(*tmps[idx]);
+                group_coeffs[idx] = ComplexT{coeffs[group_begin + idx], 0.0};
+                group_data[idx] = tmps[idx]->getView();
+            }
+            multiAxpy_Kokkos<PrecisionT, hamiltonian_term_group_size>(
+                group_coeffs, group_data, num_terms, res, sv.getLength());
+        }
+        sv.updateData(res);
+    }
+};
+
+} // namespace detail
+/// @endcond
+
 /**
  * @brief Final class for a general Hamiltonian representation as a sum of
  * observables.
@@ -187,16 +293,8 @@ class Hamiltonian final : public HamiltonianBase<StateVectorT> {
      * @param sv The statevector to update
      */
     void applyInPlace(StateVectorT &sv) const override {
-        StateVectorT buffer{sv.getNumQubits()};
-        buffer.initZeros();
-        for (size_t term_idx = 0; term_idx < this->coeffs_.size(); term_idx++) {
-            StateVectorT tmp{sv};
-            this->obs_[term_idx]->applyInPlace(tmp);
-            LightningKokkos::Util::axpy_Kokkos<PrecisionT>(
-                ComplexT{this->coeffs_[term_idx], 0.0}, tmp.getView(),
-                buffer.getView(), tmp.getLength());
-        }
-        sv.updateData(buffer);
+        detail::HamiltonianApplyInPlace<StateVectorT, false>::run(
+            this->coeffs_, this->obs_, sv);
     }
 
     // to work with
@@ -280,32 +378,4 @@ class SparseHamiltonian final : public SparseHamiltonianBase<StateVectorT> {
     }
 };
 
-/// @cond DEV
-namespace detail {
-using Pennylane::LightningKokkos::Util::axpy_Kokkos;
-// Default implementation
-template <class StateVectorT, bool use_openmp> struct HamiltonianApplyInPlace {
-    using PrecisionT = typename StateVectorT::PrecisionT;
-    using ComplexT = typename StateVectorT::ComplexT;
-    using KokkosVector = typename StateVectorT::KokkosVector;
-    static void
-    run(const std::vector<PrecisionT> &coeffs,
-        const std::vector<std::shared_ptr<Observable<StateVectorT>>> &terms,
-        StateVectorT &sv) {
-        KokkosVector res("results", sv.getLength());
-        Kokkos::deep_copy(res, ComplexT{0.0, 0.0});
-        for (size_t term_idx = 0; term_idx < coeffs.size(); term_idx++) {
-            StateVectorT tmp{sv};
-            terms[term_idx]->applyInPlace(tmp);
-            LightningKokkos::Util::axpy_Kokkos<PrecisionT>(
-                ComplexT{coeffs[term_idx], 0.0}, tmp.getView(), res,
-                tmp.getLength());
-        }
-        sv.updateData(res);
-    }
-};
-
-} // namespace detail
-/// @endcond
-
 } // namespace Pennylane::LightningKokkos::Observables
@@ -91,6 +91,53 @@ TEMPLATE_PRODUCT_TEST_CASE("HermitianObs", "[Observables]", (StateVectorKokkos),
     }
 }
 
+TEMPLATE_PRODUCT_TEST_CASE("ProjectorObs", "[Observables]", (StateVectorKokkos),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using ProjectorObsT = ProjectorObs<StateVectorT>;
+
+    SECTION("Constructibility") {
+        REQUIRE(std::is_constructible_v<ProjectorObsT, std::vector<size_t>,
+                                        std::vector<size_t>>);
+    }
+
+    SECTION("Constructor checks") {
+        PL_REQUIRE_THROWS_MATCHES(ProjectorObsT({0, 1}, {0}),
+                                  LightningException,
+                                  "The basis state must have one bit per "
+                                  "wire.");
+        PL_REQUIRE_THROWS_MATCHES(ProjectorObsT({0, 2}, {0, 1}),
+                                  LightningException,
+                                  "The basis state must only contain 0 and "
+                                  "1.");
+        PL_REQUIRE_THROWS_MATCHES(ProjectorObsT({1, 0}, {1, 1}),
+                                  LightningException,
+                                  "The projector wires must be distinct.");
+    }
+
+    SECTION("ApplyInPlace zeroes non-matching amplitudes") {
+        const size_t num_qubits = 3;
+        std::mt19937 re{1337};
+        auto st_data = createRandomStateVectorData<PrecisionT>(re, num_qubits);
+        StateVectorT state_vector(reinterpret_cast<ComplexT *>(st_data.data()),
+                                  st_data.size());
+
+        ProjectorObsT({1, 0}, {2, 0}).applyInPlace(state_vector);
+
+        // Wire 0 is the most significant bit: wire 0 = 0, wire 2 = 1.
+        const auto result = state_vector.getDataVector();
+        for (size_t idx = 0; idx < st_data.size(); idx++) {
+            const bool kept = (idx == 1 || idx == 3);
+            const auto expected =
+                kept ? st_data[idx] : std::complex<PrecisionT>{0.0, 0.0};
+            CHECK(real(result[idx]) == Approx(real(expected)));
+            CHECK(imag(result[idx]) == Approx(imag(expected)));
+        }
+    }
+}
+
 TEMPLATE_PRODUCT_TEST_CASE("TensorProdObs", "[Observables]",
                            (StateVectorKokkos), (float, double)) {
     using StateVectorT = TestType;
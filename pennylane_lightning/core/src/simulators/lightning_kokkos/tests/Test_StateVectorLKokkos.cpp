@@ -165,6 +165,150 @@ TEMPLATE_PRODUCT_TEST_CASE("StateVectorKokkos::applyMatrix with a pointer",
     }
 }
 
+TEMPLATE_PRODUCT_TEST_CASE("StateVectorKokkos::applyDiagonal",
+                           "[applyDiagonal]", (StateVectorKokkos),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using VectorT = TestVector<std::complex<PrecisionT>>;
+
+    const size_t num_qubits = 4;
+
+    SECTION("Test wrong diagonal size") {
+        std::vector<ComplexT> diag(3, 1.0);
+        VectorT st_data =
+            createRandomStateVectorData<PrecisionT>(re, num_qubits);
+
+        StateVectorT state_vector(reinterpret_cast<ComplexT *>(st_data.data()),
+                                  st_data.size());
+        REQUIRE_THROWS_WITH(
+            state_vector.applyDiagonal(diag, {0, 1}),
+            Catch::Contains(
+                "The size of the diagonal does not match with the given"));
+        REQUIRE_THROWS_WITH(state_vector.applyDiagonal(diag.data(), {}),
+                            Catch::Contains("must be larger than 0"));
+    }
+
+    SECTION("Test against the dense matrix") {
+        const std::vector<size_t> wires{3, 0, 2};
+        const size_t dim = 8;
+        std::vector<ComplexT> diag(dim);
+        std::vector<ComplexT> matrix(dim * dim, 0.0);
+        for (size_t i = 0; i < dim; i++) {
+            diag[i] = Kokkos::polar(PrecisionT{1.0}, PrecisionT{0.3} * i);
+            matrix[i * dim + i] = diag[i];
+        }
+
+        for (const bool inverse : {false, true}) {
+            VectorT st_data_1 =
+                createRandomStateVectorData<PrecisionT>(re, num_qubits);
+            VectorT st_data_2 = st_data_1;
+            StateVectorT state_vector_1(
+                reinterpret_cast<ComplexT *>(st_data_1.data()),
+                st_data_1.size());
+            StateVectorT state_vector_2(
+                reinterpret_cast<ComplexT *>(st_data_2.data()),
+                st_data_2.size());
+
+            state_vector_1.applyDiagonal(diag, wires, inverse);
+            state_vector_2.applyMatrix(matrix, wires, inverse);
+
+            PrecisionT eps = std::numeric_limits<PrecisionT>::epsilon() * 10E3;
+            REQUIRE(isApproxEqual(
+                state_vector_1.getData(), state_vector_1.getLength(),
+                state_vector_2.getData(), state_vector_2.getLength(), eps));
+        }
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("StateVectorKokkos::applyReflection",
+                           "[applyReflection]", (StateVectorKokkos),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using VectorT = TestVector<std::complex<PrecisionT>>;
+
+    const size_t num_qubits = 5;
+    const PrecisionT eps = std::numeric_limits<PrecisionT>::epsilon() * 10E3;
+
+    // Dense matrix of 2|s><s| - I
+    auto reflectionMatrix = [](const std::vector<ComplexT> &s) {
+        const size_t dim = s.size();
+        std::vector<ComplexT> matrix(dim * dim);
+        for (size_t i = 0; i < dim; i++) {
+            for (size_t j = 0; j < dim; j++) {
+                matrix[i * dim + j] =
+                    PrecisionT{2} * s[i] * Kokkos::conj(s[j]);
+            }
+            matrix[i * dim + i] -= 1;
+        }
+        return matrix;
+    };
+
+    SECTION("Test invalid arguments") {
+        VectorT st_data =
+            createRandomStateVectorData<PrecisionT>(re, num_qubits);
+        StateVectorT state_vector(reinterpret_cast<ComplexT *>(st_data.data()),
+                                  st_data.size());
+        const std::vector<ComplexT> state(3, 1.0);
+        REQUIRE_THROWS_WITH(
+            state_vector.applyReflection(state, {0, 1}),
+            Catch::Contains(
+                "The size of the state does not match with the given"));
+        REQUIRE_THROWS_WITH(state_vector.applyGroverOperator({}),
+                            Catch::Contains("must be larger than 0"));
+        REQUIRE_THROWS_WITH(state_vector.applyGroverOperator({1, 1}),
+                            Catch::Contains("Wires must be unique"));
+    }
+
+    for (const auto &wires : std::vector<std::vector<size_t>>{
+             {2}, {3, 0}, {4, 1, 2}, {0, 1, 2, 3, 4}, {3, 0, 4, 2, 1}}) {
+        DYNAMIC_SECTION("Test against the dense matrix - num_wires = "
+                        << wires.size() << ", wires[0] = " << wires[0]) {
+            const size_t dim = size_t{1} << wires.size();
+            const auto state_data = createRandomStateVectorData<PrecisionT>(
+                re, wires.size());
+            const std::vector<ComplexT> state(
+                reinterpret_cast<const ComplexT *>(state_data.data()),
+                reinterpret_cast<const ComplexT *>(state_data.data()) + dim);
+            const std::vector<ComplexT> uniform(
+                dim, ComplexT{1 / std::sqrt(static_cast<PrecisionT>(dim)), 0});
+
+            VectorT st_data_1 =
+                createRandomStateVectorData<PrecisionT>(re, num_qubits);
+            VectorT st_data_2 = st_data_1;
+            VectorT st_data_3 = st_data_1;
+            VectorT st_data_4 = st_data_1;
+            StateVectorT state_vector_1(
+                reinterpret_cast<ComplexT *>(st_data_1.data()),
+                st_data_1.size());
+            StateVectorT state_vector_2(
+                reinterpret_cast<ComplexT *>(st_data_2.data()),
+                st_data_2.size());
+            StateVectorT state_vector_3(
+                reinterpret_cast<ComplexT *>(st_data_3.data()),
+                st_data_3.size());
+            StateVectorT state_vector_4(
+                reinterpret_cast<ComplexT *>(st_data_4.data()),
+                st_data_4.size());
+
+            state_vector_1.applyReflection(state, wires);
+            state_vector_2.applyMatrix(reflectionMatrix(state), wires);
+            state_vector_3.applyGroverOperator(wires);
+            state_vector_4.applyMatrix(reflectionMatrix(uniform), wires);
+
+            REQUIRE(isApproxEqual(
+                state_vector_1.getData(), state_vector_1.getLength(),
+                state_vector_2.getData(), state_vector_2.getLength(), eps));
+            REQUIRE(isApproxEqual(
+                state_vector_3.getData(), state_vector_3.getLength(),
+                state_vector_4.getData(), state_vector_4.getLength(), eps));
+        }
+    }
+}
+
 TEMPLATE_PRODUCT_TEST_CASE("StateVectorKokkos::applyOperations",
                            "[applyOperations invalid arguments]",
                            (StateVectorKokkos), (float, double)) {
@@ -283,4 +427,101 @@ TEMPLATE_TEST_CASE("StateVectorKokkos::StateVectorKokkos",
         REQUIRE(sv.getDataVector() == data_);
         // REQUIRE(sv.getDataVector() == approx(st_data));
     }
-}
\ No newline at end of file
+}
+TEMPLATE_PRODUCT_TEST_CASE("StateVectorKokkos::getAmplitudes",
+                           "[getAmplitudes]", (StateVectorKokkos),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using VectorT = TestVector<std::complex<PrecisionT>>;
+
+    const size_t num_qubits = 5;
+    VectorT st_data = createRandomStateVectorData<PrecisionT>(re, num_qubits);
+    StateVectorT state_vector(reinterpret_cast<ComplexT *>(st_data.data()),
+                              st_data.size());
+    const auto data = state_vector.getDataVector();
+
+    SECTION("Index list") {
+        const std::vector<size_t> indices{31, 0, 7, 7, 16};
+        const auto amps = state_vector.getAmplitudes(indices);
+        REQUIRE(amps.size() == indices.size());
+        for (size_t k = 0; k < indices.size(); k++) {
+            CHECK(amps[k] == data[indices[k]]);
+        }
+        PL_REQUIRE_THROWS_MATCHES(state_vector.getAmplitudes({32}),
+                                  LightningException, "out of range");
+    }
+
+    SECTION("Contiguous range") {
+        const auto amps = state_vector.getAmplitudesRange(3, 11);
+        REQUIRE(amps.size() == 8);
+        for (size_t k = 0; k < amps.size(); k++) {
+            CHECK(amps[k] == data[3 + k]);
+        }
+        PL_REQUIRE_THROWS_MATCHES(state_vector.getAmplitudesRange(4, 33),
+                                  LightningException, "Invalid basis-state");
+    }
+
+    SECTION("Fixed-bitstring slice") {
+        const std::vector<size_t> wires{3, 0};
+        const std::vector<size_t> values{1, 0};
+        const auto amps = state_vector.getAmplitudesSlice(wires, values);
+        REQUIRE(amps.size() == 8);
+
+        // Remaining wires {1, 2, 4}, in order, index the slice.
+        for (size_t k = 0; k < amps.size(); k++) {
+            const size_t b1 = (k >> 2U) & 1U;
+            const size_t b2 = (k >> 1U) & 1U;
+            const size_t b4 = k & 1U;
+            const size_t idx = (b1 << 3U) | (b2 << 2U) | (1U << 1U) | b4;
+            CHECK(amps[k] == data[idx]);
+        }
+
+        PL_REQUIRE_THROWS_MATCHES(
+            state_vector.getAmplitudesSlice({1, 1}, {0, 0}),
+            LightningException, "Wires must be unique");
+        PL_REQUIRE_THROWS_MATCHES(state_vector.getAmplitudesSlice({1}, {2}),
+                                  LightningException, "must be 0 or 1");
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("StateVectorKokkos::snapshot", "[snapshot]",
+                           (StateVectorKokkos), (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using KokkosVector = typename StateVectorT::KokkosVector;
+    using VectorT = TestVector<std::complex<PrecisionT>>;
+
+    const size_t num_qubits = 4;
+    VectorT st_data = createRandomStateVectorData<PrecisionT>(re, num_qubits);
+    StateVectorT state_vector(reinterpret_cast<ComplexT *>(st_data.data()),
+                              st_data.size());
+    const auto expected = state_vector.getDataVector();
+
+    SECTION("Restore") {
+        const auto snap = state_vector.snapshot();
+        state_vector.applyOperation("Hadamard", {0});
+        state_vector.restore(snap);
+        CHECK(state_vector.getDataVector() == expected);
+
+        KokkosVector buffer;
+        state_vector.snapshot(buffer);
+        REQUIRE(buffer.size() == expected.size());
+        state_vector.applyOperation("PauliX", {1});
+        state_vector.restore(buffer);
+        CHECK(state_vector.getDataVector() == expected);
+
+        StateVectorT other(num_qubits - 1);
+        PL_REQUIRE_THROWS_MATCHES(other.restore(snap), LightningException,
+                                  "same number of qubits");
+    }
+
+    SECTION("Fork") {
+        auto child = state_vector.fork();
+        child.applyOperation("PauliX", {0});
+        CHECK(child.getDataVector() != expected);
+        CHECK(state_vector.getDataVector() == expected);
+    }
+}
@@ -61,6 +61,65 @@ inline auto axpy_Kokkos(Kokkos::complex<PrecisionT> alpha,
     Kokkos::parallel_for(length, axpy_KokkosFunctor<PrecisionT>(alpha, x, y));
 }
 
+/**
+ * @brief @rst
+ * Kokkos functor for :math:`y+=\sum_k \alpha_k x_k` operation.
+ * @endrst
+ *
+ * @tparam max_vecs Maximum number of vectors added in one pass.
+ */
+template <class PrecisionT, size_t max_vecs> struct multiAxpy_KokkosFunctor {
+    using KokkosVector = Kokkos::View<Kokkos::complex<PrecisionT> *>;
+
+    Kokkos::Array<Kokkos::complex<PrecisionT>, max_vecs> alpha;
+    Kokkos::Array<KokkosVector, max_vecs> x;
+    KokkosVector y;
+    size_t num_vecs;
+    multiAxpy_KokkosFunctor(
+        const Kokkos::Array<Kokkos::complex<PrecisionT>, max_vecs> &alpha_,
+        const Kokkos::Array<KokkosVector, max_vecs> &x_, size_t num_vecs_,
+        KokkosVector y_) {
+        alpha = alpha_;
+        x = x_;
+        num_vecs = num_vecs_;
+        y = y_;
+    }
+    KOKKOS_INLINE_FUNCTION void operator()(const size_t k) const {
+        Kokkos::complex<PrecisionT> sum = y[k];
+        for (size_t j = 0; j < num_vecs; j++) {
+            sum += alpha[j] * x[j][k];
+        }
+        y[k] = sum;
+    }
+};
+
+/**
+ * @brief @rst
+ * Kokkos implementation of the :math:`y+=\sum_k \alpha_k x_k` operation.
+ * @endrst
+ *
+ * y is read and written once for all the vectors, instead of once per
+ * vector with repeated axpy_Kokkos calls.
+ *
+ * @param alpha Scalars to scale each x_k
+ * @param x Vectors to add
+ * @param num_vecs Number of vectors to add, at most max_vecs
+ * @param y Vector to be added
+ * @param length number of elements in each x_k
+ * */
+template <class PrecisionT, size_t max_vecs>
+inline auto multiAxpy_Kokkos(
+    const Kokkos::Array<Kokkos::complex<PrecisionT>, max_vecs> &alpha,
+    const Kokkos::Array<Kokkos::View<Kokkos::complex<PrecisionT> *>, max_vecs>
+        &x,
+    size_t num_vecs, Kokkos::View<Kokkos::complex<PrecisionT> *> y,
+    size_t length) {
+    PL_ABORT_IF(num_vecs > max_vecs,
+                "The number of vectors must not exceed max_vecs.");
+    Kokkos::parallel_for(length, multiAxpy_KokkosFunctor<PrecisionT, max_vecs>(
+                                     alpha, x, num_vecs, y));
+}
+
 /**
  * @brief @rst
  * Sparse matrix vector multiply functor :math: `y=A*x`.
@@ -117,3 +117,65 @@ TEMPLATE_TEST_CASE("Linear Algebra::axpy_Kokkos", "[Linear Algebra]", float,
         }
     }
 }
+
+TEMPLATE_TEST_CASE("Linear Algebra::multiAxpy_Kokkos", "[Linear Algebra]",
+                   float, double) {
+    using ComplexT = StateVectorKokkos<TestType>::ComplexT;
+    using KokkosVector = StateVectorKokkos<TestType>::KokkosVector;
+
+    std::size_t num_qubits = 3;
+
+    std::size_t data_size = exp2(num_qubits);
+
+    std::vector<ComplexT> v0 = {{0.0, 0.0}, {0.1, -0.1}, {0.1, 0.1},
+                                {0.2, 0.1}, {0.2, 0.2},  {0.3, 0.3},
+                                {0.4, 0.3}, {0.5, 0.4}};
+
+    std::vector<ComplexT> v1 = {{-0.1, 0.2}, {0.2, -0.1}, {0.1, 0.2},
+                                {0.2, 0.1},  {-0.2, 0.7}, {0.6, -0.1},
+                                {0.1, 0.6},  {0.7, 0.2}};
+
+    std::vector<ComplexT> y = {{1.0, 0.0}, {0.0, 1.0}, {1.0, 1.0},
+                               {0.5, 0.0}, {0.0, 0.5}, {0.5, 0.5},
+                               {0.0, 0.0}, {1.0, -1.0}};
+
+    Kokkos::Array<ComplexT, 4> alpha;
+    alpha[0] = {2.0, 0.5};
+    alpha[1] = {-1.0, 0.25};
+
+    std::vector<ComplexT> result_refs(data_size);
+    for (std::size_t j = 0; j < data_size; j++) {
+        result_refs[j] = y[j] + alpha[0] * v0[j] + alpha[1] * v1[j];
+    }
+
+    StateVectorKokkos<TestType> kokkos_v0{num_qubits};
+    StateVectorKokkos<TestType> kokkos_v1{num_qubits};
+    StateVectorKokkos<TestType> kokkos_y{num_qubits};
+
+    kokkos_v0.HostToDevice(v0.data(), v0.size());
+    kokkos_v1.HostToDevice(v1.data(), v1.size());
+    kokkos_y.HostToDevice(y.data(), y.size());
+
+    Kokkos::Array<KokkosVector, 4> x;
+    x[0] = kokkos_v0.getView();
+    x[1] = kokkos_v1.getView();
+
+    SECTION("Testing the sum of two scaled vectors:") {
+        Util::multiAxpy_Kokkos<TestType, 4>(alpha, x, 2, kokkos_y.getView(),
+                                            data_size);
+        std::vector<ComplexT> result(data_size);
+        kokkos_y.DeviceToHost(result.data(), result.size());
+
+        for (std::size_t j = 0; j < exp2(num_qubits); j++) {
+            CHECK(imag(result[j]) == Approx(imag(result_refs[j])));
+            CHECK(real(result[j]) == Approx(real(result_refs[j])));
+        }
+    }
+
+    SECTION("Throws if there are too many vectors:") {
+        PL_REQUIRE_THROWS_MATCHES(
+            (Util::multiAxpy_Kokkos<TestType, 4>(alpha, x, 5,
+                                                 kokkos_y.getView(), data_size)),
+            LightningException, "must not exceed max_vecs");
+    }
+}
@@ -21,18 +21,25 @@
  */
 
 #pragma once
+#include <algorithm>
 #include <complex>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
+#include "BasisPermutation.hpp"
+#include "BitUtil.hpp" // revWireParity
 #include "CPUMemoryModel.hpp"
 #include "GateOperation.hpp"
 #include "KernelMap.hpp"
 #include "KernelType.hpp"
 #include "StateVectorBase.hpp"
+#include "StateVectorLQubitSnapshot.hpp"
 #include "Threading.hpp"
 
 /// @cond DEV
 namespace {
+using Pennylane::LightningQubit::Util::maxThreads;
 using Pennylane::LightningQubit::Util::Threading;
 using Pennylane::Util::CPUMemoryModel;
 using Pennylane::Util::exp2;
@@ -58,6 +65,7 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
   public:
     using ComplexT = std::complex<PrecisionT>;
     using MemoryStorageT = Pennylane::Util::MemoryStorageLocation::Undefined;
+    using SnapshotT = StateVectorLQubitSnapshot<PrecisionT>;
 
   protected:
     const Threading threading_;
@@ -65,14 +73,22 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
 
   private:
     using BaseType = StateVectorBase<PrecisionT, Derived>;
+    /// Minimal number of gathered amplitudes to use OpenMP threads.
+    constexpr static size_t gather_omp_threshold = 1U << 16U;
+    /// Minimal number of amplitudes of a reflection to use OpenMP threads.
+    constexpr static size_t reflection_omp_threshold = 1U << 14U;
+    /// Minimal number of amplitudes of a permutation to use OpenMP threads.
+    constexpr static size_t permutation_omp_threshold = 1U << 14U;
     using GateKernelMap = std::unordered_map<GateOperation, KernelType>;
     using GeneratorKernelMap =
         std::unordered_map<GeneratorOperation, KernelType>;
     using MatrixKernelMap = std::unordered_map<MatrixOperation, KernelType>;
 
-    GateKernelMap kernel_for_gates_;
-    GeneratorKernelMap kernel_for_generators_;
-    MatrixKernelMap kernel_for_matrices_;
+    // Statevectors constructed with LazyKernels build the maps on first use
+    mutable GateKernelMap kernel_for_gates_;
+    mutable GeneratorKernelMap kernel_for_generators_;
+    mutable MatrixKernelMap kernel_for_matrices_;
+    mutable bool kernels_set_{false};
 
     /**
      * @brief Internal function to set kernels for all operations depending on
@@ -83,8 +99,9 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
      * @param memory_model Memory model
      */
     void setKernels(size_t num_qubits, Threading threading,
-                    CPUMemoryModel memory_model) {
+                    CPUMemoryModel memory_model) const {
         using KernelMap::OperationKernelMap;
+        kernels_set_ = true;
         kernel_for_gates_ =
             OperationKernelMap<GateOperation>::getInstance().getKernelMap(
                 num_qubits, threading, memory_model);
@@ -96,6 +113,15 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
                 num_qubits, threading, memory_model);
     }
 
+    /**
+     * @brief Set the kernels if they have not been set yet.
+     */
+    void ensureKernels() const {
+        if (!kernels_set_) {
+            setKernels(this->getNumQubits(), threading_, memory_model_);
+        }
+    }
+
     /**
      * @brief Get a kernel for a gate operation.
      *
@@ -104,6 +130,7 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
      */
     [[nodiscard]] inline auto getKernelForGate(GateOperation gate_op) const
         -> KernelType {
+        ensureKernels();
         return kernel_for_gates_.at(gate_op);
     }
 
@@ -115,6 +142,7 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
      */
     [[nodiscard]] inline auto
     getKernelForGenerator(GeneratorOperation gen_op) const -> KernelType {
+        ensureKernels();
         return kernel_for_generators_.at(gen_op);
     }
 
@@ -126,6 +154,7 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
      */
     [[nodiscard]] inline auto getKernelForMatrix(MatrixOperation mat_op) const
         -> KernelType {
+        ensureKernels();
         return kernel_for_matrices_.at(mat_op);
     }
 
@@ -134,10 +163,12 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
      */
     [[nodiscard]] inline auto
     getGateKernelMap() const & -> const GateKernelMap & {
+        ensureKernels();
         return kernel_for_gates_;
     }
 
     [[nodiscard]] inline auto getGateKernelMap() && -> GateKernelMap {
+        ensureKernels();
         return kernel_for_gates_;
     }
 
@@ -146,10 +177,12 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
      */
     [[nodiscard]] inline auto
     getGeneratorKernelMap() const & -> const GeneratorKernelMap & {
+        ensureKernels();
         return kernel_for_generators_;
     }
 
     [[nodiscard]] inline auto getGeneratorKernelMap() && -> GeneratorKernelMap {
+        ensureKernels();
         return kernel_for_generators_;
     }
 
@@ -158,14 +191,23 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
      */
     [[nodiscard]] inline auto
     getMatrixKernelMap() const & -> const MatrixKernelMap & {
+        ensureKernels();
         return kernel_for_matrices_;
     }
 
     [[nodiscard]] inline auto getMatrixKernelMap() && -> MatrixKernelMap {
+        ensureKernels();
         return kernel_for_matrices_;
     }
 
   protected:
+    /**
+     * @brief Tag of the constructor which defers building the kernel maps to
+     * their first use. The statevector must then not be shared between
+     * threads before its kernel maps are built.
+     */
+    struct LazyKernels {};
+
     explicit StateVectorLQubit(size_t num_qubits, Threading threading,
                                CPUMemoryModel memory_model)
         : BaseType(num_qubits), threading_{threading},
@@ -173,6 +215,12 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
         setKernels(num_qubits, threading, memory_model);
     }
 
+    StateVectorLQubit(size_t num_qubits, Threading threading,
+                      CPUMemoryModel memory_model,
+                      [[maybe_unused]] LazyKernels lazy)
+        : BaseType(num_qubits), threading_{threading},
+          memory_model_{memory_model} {}
+
   public:
     /**
      * @brief Get the statevector's memory model.
@@ -240,6 +288,23 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
                                   params);
     }
 
+    /**
+     * @brief Apply a single gate, given by its gate operation, to the
+     * state-vector. This skips the lookup of the gate name.
+     *
+     * @param gate_op Gate operation to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(GateOperation gate_op, const std::vector<size_t> &wires,
+                        bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        DynamicDispatcher<PrecisionT>::getInstance().applyOperation(
+            getKernelForGate(gate_op), this->getData(), this->getNumQubits(),
+            gate_op, wires, inverse, params);
+    }
+
     /**
      * @brief Apply a single gate to the state-vector.
      *
@@ -258,6 +323,9 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
         auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
         if (dispatcher.hasGateOp(opName)) {
             applyOperation(opName, wires, inverse, params);
+        } else if (opName == "GroverOperator") {
+            // Self-inverse, and serialized without its matrix
+            applyGroverOperator(wires);
         } else {
             applyMatrix(matrix, wires, inverse);
         }
@@ -385,5 +453,575 @@ class StateVectorLQubit : public StateVectorBase<PrecisionT, Derived> {
 
         applyMatrix(matrix.data(), wires, inverse);
     }
+
+    /**
+     * @brief Apply a diagonal matrix directly to the statevector.
+     *
+     * The matrix is given by its diagonal only, so the cost is a single pass
+     * over the statevector regardless of the number of wires.
+     *
+     * @param diag Pointer to the diagonal entries, of size 2^(wires.size()).
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    inline void applyDiagonal(const ComplexT *diag,
+                              const std::vector<size_t> &wires,
+                              bool inverse = false) {
+        using Pennylane::Gates::MatrixOperation;
+        const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+
+        dispatcher.applyDiagonal(
+            getKernelForMatrix(MatrixOperation::DiagonalOp), this->getData(),
+            this->getNumQubits(), diag, wires, inverse);
+    }
+
+    /**
+     * @brief Apply a diagonal matrix directly to the statevector.
+     *
+     * @param diag Diagonal entries of the matrix.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    template <typename Alloc>
+    inline void applyDiagonal(const std::vector<ComplexT, Alloc> &diag,
+                              const std::vector<size_t> &wires,
+                              bool inverse = false) {
+        PL_ABORT_IF(diag.size() != exp2(wires.size()),
+                    "The size of the diagonal does not match with the given "
+                    "number of wires");
+
+        applyDiagonal(diag.data(), wires, inverse);
+    }
+
+    /**
+     * @brief Apply the reflection `2|s><s| - I` about a state of the given
+     * wires.
+     *
+     * Each block of amplitudes sharing the bits outside the wires costs one
+     * overlap with |s> and one update, instead of a dense `2^k x 2^k`
+     * matrix. The reflection is its own inverse.
+     *
+     * @param state Pointer to the normalized state |s>, of size
+     * 2^(wires.size()), with `wires[0]` as the most significant bit.
+     * @param wires Wires to apply the reflection to.
+     */
+    inline void applyReflection(const ComplexT *state,
+                                const std::vector<size_t> &wires) {
+        PL_ABORT_IF(state == nullptr, "The reflection state must be given.");
+        applyReflectionImpl(state, wires);
+    }
+
+    /**
+     * @brief Apply the reflection `2|s><s| - I` about a state of the given
+     * wires.
+     *
+     * @param state Normalized state |s> of the wires.
+     * @param wires Wires to apply the reflection to.
+     */
+    template <typename Alloc>
+    inline void applyReflection(const std::vector<ComplexT, Alloc> &state,
+                                const std::vector<size_t> &wires) {
+        PL_ABORT_IF(state.size() != exp2(wires.size()),
+                    "The size of the state does not match with the given "
+                    "number of wires");
+        applyReflectionImpl(state.data(), wires);
+    }
+
+    /**
+     * @brief Apply the Grover diffusion operator `2|s><s| - I` to the given
+     * wires, where |s> is their uniform superposition.
+     *
+     * @param wires Wires to apply the operator to. Work wires of the
+     * decomposition are not needed.
+     */
+    inline void applyGroverOperator(const std::vector<size_t> &wires) {
+        applyReflectionImpl(nullptr, wires);
+    }
+
+    /**
+     * @brief Apply a permutation of the basis states of the given wires.
+     *
+     * The permutation is applied independently to every block of amplitudes
+     * sharing the bits outside the wires. When there are enough blocks to
+     * keep the threads busy, or when `in_place` is set, the cycles of the
+     * permutation are rotated in place, which moves each amplitude once
+     * without any scratch memory. Otherwise, each block is scattered in
+     * parallel into a buffer of `2^k` amplitudes and copied back.
+     *
+     * @param perm Permutation table of size 2^(wires.size()), mapping |x>
+     * to |perm[x]>, with `wires[0]` as the most significant bit.
+     * @param wires Wires to apply the permutation to.
+     * @param in_place Always use the in-place cycle-following kernel.
+     */
+    void applyPermutation(const std::vector<size_t> &perm,
+                          const std::vector<size_t> &wires,
+                          bool in_place = false) {
+        PL_ABORT_IF(perm.size() != exp2(wires.size()),
+                    "The size of the permutation table does not match with "
+                    "the given number of wires");
+        const size_t num_qubits = this->getNumQubits();
+        const size_t n_wires = wires.size();
+        const auto rev_wires = checkedRevWires(wires);
+        auto cycles = Pennylane::LightningQubit::Util::permutationCycles(perm);
+        if (cycles.numCycles() == 0) {
+            return;
+        }
+
+        const auto parity = Pennylane::Util::revWireParity(rev_wires);
+        const size_t num_parity = parity.size();
+        auto offsetOf = [&rev_wires, n_wires](size_t x) {
+            size_t offset = 0;
+            for (size_t k = 0; k < n_wires; k++) {
+                if (((x >> (n_wires - 1 - k)) & 1U) != 0) {
+                    offset |= size_t{1} << rev_wires[k];
+                }
+            }
+            return offset;
+        };
+
+        ComplexT *arr = this->getData();
+        const size_t num_blocks = exp2(num_qubits - n_wires);
+        const bool parallel = this->getLength() > permutation_omp_threshold;
+
+        if (!in_place && num_blocks < maxThreads()) {
+            const size_t dim = perm.size();
+            std::vector<size_t> offsets(dim);
+            std::vector<ComplexT> buffer(dim);
+            for (size_t x = 0; x < dim; x++) {
+                offsets[x] = offsetOf(x);
+            }
+            for (size_t k = 0; k < num_blocks; k++) {
+                size_t base = (k & parity[0]);
+                for (size_t i = 1; i < num_parity; i++) {
+                    base |= ((k << i) & parity[i]);
+                }
+                // clang-format off
+                #if defined(_OPENMP)
+                    #pragma omp parallel default(none)                         \
+                        shared(arr, base, perm, offsets, buffer, dim)          \
+                        if (parallel)
+                #endif
+                // clang-format on
+                {
+                    // clang-format off
+                    #if defined(_OPENMP)
+                        #pragma omp for
+                    #endif
+                    // clang-format on
+                    for (size_t x = 0; x < dim; x++) {
+                        buffer[perm[x]] = arr[base | offsets[x]];
+                    }
+                    // clang-format off
+                    #if defined(_OPENMP)
+                        #pragma omp for
+                    #endif
+                    // clang-format on
+                    for (size_t x = 0; x < dim; x++) {
+                        arr[base | offsets[x]] = buffer[x];
+                    }
+                }
+            }
+            return;
+        }
+
+        for (auto &x : cycles.elements) {
+            x = offsetOf(x);
+        }
+        const auto &elements = cycles.elements;
+        const auto &cycle_offsets = cycles.offsets;
+        const size_t num_cycles = cycles.numCycles();
+
+        if (num_blocks < maxThreads()) {
+            for (size_t k = 0; k < num_blocks; k++) {
+                size_t base = (k & parity[0]);
+                for (size_t i = 1; i < num_parity; i++) {
+                    base |= ((k << i) & parity[i]);
+                }
+                // clang-format off
+                #if defined(_OPENMP)
+                    #pragma omp parallel for default(none)                     \
+                        shared(arr, base, elements, cycle_offsets, num_cycles) \
+                        if (parallel)
+                #endif
+                // clang-format on
+                for (size_t c = 0; c < num_cycles; c++) {
+                    rotateCycle(arr, base, elements, cycle_offsets[c],
+                                cycle_offsets[c + 1]);
+                }
+            }
+            return;
+        }
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none)                             \
+                shared(arr, parity, elements, cycle_offsets, num_cycles,       \
+                       num_blocks, num_parity)                                 \
+                if (parallel)
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < num_blocks; k++) {
+            size_t base = (k & parity[0]);
+            for (size_t i = 1; i < num_parity; i++) {
+                base |= ((k << i) & parity[i]);
+            }
+            for (size_t c = 0; c < num_cycles; c++) {
+                rotateCycle(arr, base, elements, cycle_offsets[c],
+                            cycle_offsets[c + 1]);
+            }
+        }
+    }
+
+    /**
+     * @brief Apply the oracle `|x>|y> -> |x>|y XOR f(x)>`.
+     *
+     * @param f Values of the function, one per basis state of `x_wires`,
+     * with `x_wires[0]` as the most significant bit. Each value is a basis
+     * state of `y_wires`, with `y_wires[0]` as the most significant bit.
+     * @param x_wires Input wires.
+     * @param y_wires Output wires.
+     */
+    void applyOracle(const std::vector<size_t> &f,
+                     const std::vector<size_t> &x_wires,
+                     const std::vector<size_t> &y_wires) {
+        auto wires = x_wires;
+        wires.insert(wires.end(), y_wires.begin(), y_wires.end());
+        static_cast<void>(checkedRevWires(wires));
+        PL_ABORT_IF(f.size() != exp2(x_wires.size()),
+                    "The number of function values does not match with the "
+                    "given number of input wires");
+        applyPermutation(
+            Pennylane::LightningQubit::Util::oracleTable(f, y_wires.size()),
+            wires);
+    }
+
+    /**
+     * @brief Apply `|x> -> |x + a mod 2^k>` to the given wires, with
+     * `wires[0]` as the most significant bit.
+     *
+     * @param a Constant to add.
+     * @param wires Wires of the register.
+     */
+    void applyModularAdd(size_t a, const std::vector<size_t> &wires) {
+        static_cast<void>(checkedRevWires(wires));
+        applyPermutation(
+            Pennylane::LightningQubit::Util::modularAddTable(wires.size(), a),
+            wires);
+    }
+
+    /**
+     * @brief Apply `|x> -> |a x mod N>` to the basis states `x < N` of the
+     * given wires, with `wires[0]` as the most significant bit. The other
+     * basis states are left unchanged.
+     *
+     * @param a Multiplier, coprime to `N`.
+     * @param N Modulus, at most `2^k`.
+     * @param wires Wires of the register.
+     */
+    void applyModularMultiply(size_t a, size_t N,
+                              const std::vector<size_t> &wires) {
+        static_cast<void>(checkedRevWires(wires));
+        applyPermutation(Pennylane::LightningQubit::Util::modularMultiplyTable(
+                             wires.size(), a, N),
+                         wires);
+    }
+
+    /**
+     * @brief Take a snapshot of the state vector.
+     *
+     * @param chunk_qubits Number of qubits addressed within a chunk.
+     * @return Snapshot that can later be restored into any state vector with
+     * the same number of qubits.
+     */
+    [[nodiscard]] auto
+    snapshot(size_t chunk_qubits = SnapshotT::default_chunk_qubits) const
+        -> SnapshotT {
+        return {this->getData(), this->getNumQubits(), chunk_qubits};
+    }
+
+    /**
+     * @brief Take a snapshot of the state vector, sharing the chunks that
+     * are unchanged since a base snapshot.
+     *
+     * @param base Earlier snapshot of this state vector or of its parent.
+     */
+    [[nodiscard]] auto snapshot(const SnapshotT &base) const -> SnapshotT {
+        return {this->getData(), this->getNumQubits(), base};
+    }
+
+    /**
+     * @brief Restore the state vector from a snapshot.
+     *
+     * @param snap Snapshot to restore.
+     */
+    void restore(const SnapshotT &snap) {
+        PL_ABORT_IF_NOT(snap.getNumQubits() == this->getNumQubits(),
+                        "The snapshot must have the same number of qubits as "
+                        "the state vector.");
+        snap.copyTo(this->getData());
+    }
+
+    /**
+     * @brief Get the amplitudes of the given computational basis states.
+     *
+     * @param indices Basis-state indices.
+     * @return Amplitudes in the order of `indices`.
+     */
+    [[nodiscard]] auto getAmplitudes(const std::vector<size_t> &indices) const
+        -> std::vector<ComplexT> {
+        this->checkAmplitudeIndices(indices);
+        const ComplexT *arr = this->getData();
+        const size_t num_indices = indices.size();
+        std::vector<ComplexT> amplitudes(num_indices);
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none)                             \
+                shared(arr, indices, amplitudes, num_indices)                  \
+                if (num_indices > gather_omp_threshold)
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < num_indices; k++) {
+            amplitudes[k] = arr[indices[k]];
+        }
+        return amplitudes;
+    }
+
+    /**
+     * @brief Get the amplitudes of a contiguous range of basis states.
+     *
+     * @param begin First basis-state index.
+     * @param end One past the last basis-state index.
+     * @return Amplitudes of basis states `[begin, end)`.
+     */
+    [[nodiscard]] auto getAmplitudesRange(size_t begin, size_t end) const
+        -> std::vector<ComplexT> {
+        this->checkAmplitudeRange(begin, end);
+        const ComplexT *arr = this->getData();
+        return {arr + begin, arr + end};
+    }
+
+    /**
+     * @brief Get the amplitudes of the basis states where the given wires
+     * take fixed values.
+     *
+     * @param wires Wires to fix.
+     * @param values Bit value (0 or 1) of each wire.
+     * @return `2^(n - wires.size())` amplitudes, ordered as basis states of
+     * the remaining wires.
+     */
+    [[nodiscard]] auto
+    getAmplitudesSlice(const std::vector<size_t> &wires,
+                       const std::vector<size_t> &values) const
+        -> std::vector<ComplexT> {
+        std::vector<size_t> parity;
+        size_t fixed_mask{0};
+        std::tie(parity, fixed_mask) =
+            this->getAmplitudesSliceMasks(wires, values);
+        if (wires.empty()) {
+            return getAmplitudesRange(0, this->getLength());
+        }
+
+        const ComplexT *arr = this->getData();
+        const size_t num_amplitudes =
+            exp2(this->getNumQubits() - wires.size());
+        const size_t num_parity = parity.size();
+        std::vector<ComplexT> amplitudes(num_amplitudes);
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none)                             \
+                shared(arr, parity, amplitudes, fixed_mask, num_amplitudes,    \
+                       num_parity)                                             \
+                if (num_amplitudes > gather_omp_threshold)
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < num_amplitudes; k++) {
+            size_t idx = (k & parity[0]);
+            for (size_t i = 1; i < num_parity; i++) {
+                idx |= ((k << i) & parity[i]);
+            }
+            amplitudes[k] = arr[idx | fixed_mask];
+        }
+        return amplitudes;
+    }
+
+  private:
+    /**
+     * @brief Check that wires are unique and valid, and return their bit
+     * positions in the index of an amplitude.
+     *
+     * @param wires Wires of an operation.
+     */
+    [[nodiscard]] auto checkedRevWires(const std::vector<size_t> &wires) const
+        -> std::vector<size_t> {
+        const size_t num_qubits = this->getNumQubits();
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+        PL_ABORT_IF_NOT(wires.size() <= num_qubits,
+                        "The number of wires must not exceed the number of "
+                        "qubits.");
+
+        std::vector<size_t> rev_wires(wires.size());
+        for (size_t k = 0; k < wires.size(); k++) {
+            PL_ABORT_IF_NOT(wires[k] < num_qubits, "Invalid wire index.");
+            rev_wires[k] = num_qubits - 1 - wires[k];
+        }
+        auto sorted_wires = rev_wires;
+        std::sort(sorted_wires.begin(), sorted_wires.end());
+        PL_ABORT_IF(std::adjacent_find(sorted_wires.begin(),
+                                       sorted_wires.end()) !=
+                        sorted_wires.end(),
+                    "Wires must be unique.");
+        return rev_wires;
+    }
+
+    /**
+     * @brief Rotate one cycle of a permutation in a block of amplitudes.
+     *
+     * @param arr Statevector data.
+     * @param base Index of the first amplitude of the block.
+     * @param elements Offsets of the cycle elements within a block.
+     * @param first Position of the first element of the cycle.
+     * @param last Position past the last element of the cycle.
+     */
+    static void rotateCycle(ComplexT *arr, size_t base,
+                            const std::vector<size_t> &elements, size_t first,
+                            size_t last) {
+        const ComplexT tmp = arr[base | elements[last - 1]];
+        for (size_t i = last - 1; i > first; i--) {
+            arr[base | elements[i]] = arr[base | elements[i - 1]];
+        }
+        arr[base | elements[first]] = tmp;
+    }
+
+    /**
+     * @brief Reflect the amplitudes of one block about |s>.
+     *
+     * The offset of amplitude `i` of the block is
+     * `offsets_hi[i >> lo_bits] | offsets_lo[i & (2^lo_bits - 1)]`, so that
+     * the offset tables only take `O(2^(k/2))` memory for `k` wires.
+     *
+     * @param arr Statevector data.
+     * @param base Index of the first amplitude of the block.
+     * @param offsets_hi Offsets of the leading wires.
+     * @param offsets_lo Offsets of the trailing `lo_bits` wires.
+     * @param lo_bits Number of trailing wires.
+     * @param state State |s>, or nullptr for the uniform superposition.
+     * @param parallel Use OpenMP threads within the block.
+     */
+    static void reflectBlock(ComplexT *arr, size_t base,
+                             const std::vector<size_t> &offsets_hi,
+                             const std::vector<size_t> &offsets_lo,
+                             size_t lo_bits, const ComplexT *state,
+                             [[maybe_unused]] bool parallel) {
+        const size_t dim = offsets_hi.size() * offsets_lo.size();
+        const size_t lo_mask = offsets_lo.size() - 1;
+        PrecisionT overlap_re = 0;
+        PrecisionT overlap_im = 0;
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none)                             \
+                shared(arr, base, offsets_hi, offsets_lo, lo_bits, lo_mask,    \
+                       state, dim)                                             \
+                reduction(+ : overlap_re, overlap_im) if (parallel)
+        #endif
+        // clang-format on
+        for (size_t i = 0; i < dim; i++) {
+            const ComplexT amp =
+                arr[base | offsets_hi[i >> lo_bits] | offsets_lo[i & lo_mask]];
+            const ComplexT prod =
+                (state == nullptr) ? amp : std::conj(state[i]) * amp;
+            overlap_re += std::real(prod);
+            overlap_im += std::imag(prod);
+        }
+        // For the uniform superposition, both factors 1/sqrt(dim) of
+        // |s><s| are folded into the overlap.
+        const PrecisionT scale =
+            (state == nullptr) ? PrecisionT{2} / static_cast<PrecisionT>(dim)
+                               : PrecisionT{2};
+        const ComplexT overlap{scale * overlap_re, scale * overlap_im};
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none)                             \
+                shared(arr, base, offsets_hi, offsets_lo, lo_bits, lo_mask,    \
+                       state, dim, overlap)                                    \
+                if (parallel)
+        #endif
+        // clang-format on
+        for (size_t i = 0; i < dim; i++) {
+            ComplexT &amp =
+                arr[base | offsets_hi[i >> lo_bits] | offsets_lo[i & lo_mask]];
+            amp = ((state == nullptr) ? overlap : state[i] * overlap) - amp;
+        }
+    }
+
+    /**
+     * @brief Reflect every block of amplitudes of the given wires about |s>.
+     *
+     * Blocks are processed in parallel when there are enough of them to keep
+     * the threads busy, and one after another, each split between the
+     * threads, otherwise.
+     *
+     * @param state State |s>, or nullptr for the uniform superposition.
+     * @param wires Wires to apply the reflection to.
+     */
+    void applyReflectionImpl(const ComplexT *state,
+                             const std::vector<size_t> &wires) {
+        const size_t num_qubits = this->getNumQubits();
+        const size_t n_wires = wires.size();
+        const auto rev_wires = checkedRevWires(wires);
+        const auto parity = Pennylane::Util::revWireParity(rev_wires);
+
+        // Entry i of an offset table sets the bits of `count` consecutive
+        // wires, starting at `first`, to the bits of i, with the first of
+        // these wires as the most significant bit.
+        auto offsetTable = [&rev_wires](size_t first, size_t count) {
+            std::vector<size_t> offsets(exp2(count), 0);
+            for (size_t k = 0; k < count; k++) {
+                const size_t half = size_t{1} << k;
+                const size_t shift = size_t{1}
+                                     << rev_wires[first + count - 1 - k];
+                for (size_t i = 0; i < half; i++) {
+                    offsets[half + i] = offsets[i] | shift;
+                }
+            }
+            return offsets;
+        };
+        const size_t lo_bits = n_wires / 2;
+        const auto offsets_hi = offsetTable(0, n_wires - lo_bits);
+        const auto offsets_lo = offsetTable(n_wires - lo_bits, lo_bits);
+
+        ComplexT *arr = this->getData();
+        const size_t num_blocks = exp2(num_qubits - n_wires);
+        const size_t num_parity = parity.size();
+        const bool parallel = this->getLength() > reflection_omp_threshold;
+
+        if (num_blocks < maxThreads()) {
+            for (size_t k = 0; k < num_blocks; k++) {
+                size_t base = (k & parity[0]);
+                for (size_t i = 1; i < num_parity; i++) {
+                    base |= ((k << i) & parity[i]);
+                }
+                reflectBlock(arr, base, offsets_hi, offsets_lo, lo_bits, state,
+                             parallel);
+            }
+            return;
+        }
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none)                             \
+                shared(arr, parity, offsets_hi, offsets_lo, lo_bits, state,    \
+                       num_blocks, num_parity)                                 \
+                if (parallel)
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < num_blocks; k++) {
+            size_t base = (k & parity[0]);
+            for (size_t i = 1; i < num_parity; i++) {
+                base |= ((k << i) & parity[i]);
+            }
+            reflectBlock(arr, base, offsets_hi, offsets_lo, lo_bits, state,
+                         false);
+        }
+    }
 };
 } // namespace Pennylane::LightningQubit
\ No newline at end of file
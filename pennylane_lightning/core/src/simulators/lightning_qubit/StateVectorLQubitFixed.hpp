@@ -0,0 +1,358 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file
+ * Statevector simulator with a compile-time number of qubits, storing its
+ * data inline.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CPUMemoryModel.hpp" // bestCPUMemoryModel
+#include "Constant.hpp"
+#include "ConstantUtil.hpp" // lookup
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "GateOperation.hpp"
+#include "OpToMemberFuncPtr.hpp"
+#include "StateVectorLQubit.hpp"
+#include "cpu_kernels/GateImplementationsLM.hpp"
+
+/// @cond DEV
+namespace {
+using Pennylane::Gates::GateOperation;
+using Pennylane::LightningQubit::Gates::GateImplementationsLM;
+using Pennylane::LightningQubit::Util::Threading;
+using Pennylane::Util::bestCPUMemoryModel;
+using Pennylane::Util::CPUMemoryModel;
+} // namespace
+/// @endcond
+
+namespace Pennylane::LightningQubit {
+/**
+ * @brief StateVector class with a compile-time number of qubits, whose data
+ * is stored inline in the object.
+ *
+ * This class is meant for circuits on a few qubits, where allocating the
+ * statevector and dispatching each gate through the kernel maps cost more
+ * than the gates themselves. Gates implemented by the LM kernels are
+ * dispatched through a table of function pointers built at compile time, with
+ * the number of qubits as a constant, and `applyGate` selects the kernel at
+ * compile time. Everything else falls back to `StateVectorLQubit`, so the
+ * class can be used with the measurements and observables of Lightning-Qubit.
+ * The kernel maps of `StateVectorLQubit` are only built by the first fallback,
+ * so neither constructing the statevector nor applying LM gates to it
+ * allocates memory.
+ *
+ * @tparam fp_t Precision data type
+ * @tparam num_qubits_ Number of qubits
+ */
+template <class fp_t, size_t num_qubits_>
+class StateVectorLQubitFixed final
+    : public StateVectorLQubit<fp_t,
+                               StateVectorLQubitFixed<fp_t, num_qubits_>> {
+  public:
+    using PrecisionT = fp_t;
+    using ComplexT = std::complex<PrecisionT>;
+    using CFP_t = ComplexT;
+    using MemoryStorageT = Pennylane::Util::MemoryStorageLocation::Internal;
+
+    /// Number of qubits
+    constexpr static size_t num_qubits = num_qubits_;
+    /// Number of amplitudes
+    constexpr static size_t length = size_t{1} << num_qubits;
+
+    static_assert(num_qubits > 0 && num_qubits <= 12,
+                  "StateVectorLQubitFixed stores at most 12 qubits inline. "
+                  "Use StateVectorLQubitManaged for larger statevectors.");
+
+  private:
+    using BaseType =
+        StateVectorLQubit<PrecisionT,
+                          StateVectorLQubitFixed<PrecisionT, num_qubits>>;
+    using GateFuncT = void (*)(ComplexT *, const std::vector<size_t> &, bool,
+                               const std::vector<PrecisionT> &);
+
+    alignas(64) std::array<ComplexT, length> data_{};
+
+    template <GateOperation gate_op>
+    static void applyGateFunc(ComplexT *arr, const std::vector<size_t> &wires,
+                              bool inverse,
+                              const std::vector<PrecisionT> &params) {
+        constexpr auto func_ptr =
+            Gates::GateOpToMemberFuncPtr<PrecisionT, PrecisionT,
+                                         GateImplementationsLM, gate_op>::value;
+        PL_ASSERT(params.size() ==
+                  Pennylane::Util::lookup(
+                      Pennylane::Gates::Constant::gate_num_params, gate_op));
+        Gates::callGateOps(func_ptr, arr, num_qubits, wires, inverse, params);
+    }
+
+    template <size_t... gate_idx>
+    constexpr static auto makeGateTable(std::index_sequence<gate_idx...>) {
+        constexpr auto &gates = GateImplementationsLM::implemented_gates;
+        std::array<GateFuncT, static_cast<size_t>(GateOperation::END)>
+            table{};
+        ((table[static_cast<size_t>(gates[gate_idx])] =
+              &applyGateFunc<gates[gate_idx]>),
+         ...);
+        return table;
+    }
+
+    /**
+     * @brief Get the LM kernel of a gate operation, or nullptr if the LM
+     * kernels do not implement it.
+     */
+    [[nodiscard]] static auto getGateFunc(GateOperation gate_op)
+        -> GateFuncT {
+        constexpr static size_t num_gates =
+            GateImplementationsLM::implemented_gates.size();
+        constexpr static auto table =
+            makeGateTable(std::make_index_sequence<num_gates>{});
+        return table[static_cast<size_t>(gate_op)];
+    }
+
+  public:
+    /**
+     * @brief Create a new statevector in the computational basis state |0...0>
+     *
+     * @param threading Threading option the statevector to use
+     * @param memory_model Memory model the statevector will use
+     */
+    explicit StateVectorLQubitFixed(
+        Threading threading = Threading::SingleThread,
+        CPUMemoryModel memory_model = bestCPUMemoryModel())
+        : BaseType{num_qubits, threading, memory_model,
+                   typename BaseType::LazyKernels{}} {
+        data_[0] = {1, 0};
+    }
+
+    /**
+     * @brief Construct a statevector from data pointer
+     *
+     * @param other_data Data pointer to construct the statevector from.
+     * @param other_size Size of the data
+     * @param threading Threading option the statevector to use
+     * @param memory_model Memory model the statevector will use
+     */
+    StateVectorLQubitFixed(const ComplexT *other_data, size_t other_size,
+                           Threading threading = Threading::SingleThread,
+                           CPUMemoryModel memory_model = bestCPUMemoryModel())
+        : BaseType{num_qubits, threading, memory_model,
+                   typename BaseType::LazyKernels{}} {
+        updateData(other_data, other_size);
+    }
+
+    /**
+     * @brief Construct a statevector from a data vector
+     *
+     * @tparam Alloc Allocator type of std::vector to use for constructing
+     * statevector.
+     * @param other Data to construct the statevector from
+     * @param threading Threading option the statevector to use
+     * @param memory_model Memory model the statevector will use
+     */
+    template <class Alloc>
+    explicit StateVectorLQubitFixed(
+        const std::vector<ComplexT, Alloc> &other,
+        Threading threading = Threading::SingleThread,
+        CPUMemoryModel memory_model = bestCPUMemoryModel())
+        : StateVectorLQubitFixed(other.data(), other.size(), threading,
+                                 memory_model) {}
+
+    using BaseType::applyOperation;
+
+    /**
+     * @brief Apply a single gate to the state-vector.
+     *
+     * Besides the gate operations, `GroverOperator` is applied by its native
+     * kernel, as in the dynamic statevector. Any other name is rejected.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(const std::string &opName,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+        if (dispatcher.hasGateOp(opName)) {
+            applyOperation(dispatcher.strToGateOp(opName), wires, inverse,
+                           params);
+        } else if (opName == "GroverOperator") {
+            // Self-inverse
+            this->applyGroverOperator(wires);
+        } else {
+            PL_ABORT("The operation " + opName +
+                     " is not supported by StateVectorLQubitFixed.");
+        }
+    }
+
+    /**
+     * @brief Apply a single gate, given by its gate operation, to the
+     * state-vector. Gates implemented by the LM kernels skip the kernel maps.
+     *
+     * @param gate_op Gate operation to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(GateOperation gate_op, const std::vector<size_t> &wires,
+                        bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        if (const auto func = getGateFunc(gate_op)) {
+            func(data_.data(), wires, inverse, params);
+        } else {
+            BaseType::applyOperation(gate_op, wires, inverse, params);
+        }
+    }
+
+    /**
+     * @brief Apply a gate selected at compile time.
+     *
+     * @tparam gate_op Gate operation to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Parameters of the gate.
+     */
+    template <GateOperation gate_op, class... ParamT>
+    void applyGate(const std::vector<size_t> &wires, bool inverse,
+                   ParamT... params) {
+        static_assert(Pennylane::Util::array_has_elem(
+                          GateImplementationsLM::implemented_gates, gate_op),
+                      "The LM kernels do not implement the gate.");
+        static_assert(sizeof...(ParamT) ==
+                          Pennylane::Util::lookup(
+                              Pennylane::Gates::Constant::gate_num_params,
+                              gate_op),
+                      "Wrong number of parameters for the gate.");
+        constexpr auto func_ptr =
+            Gates::GateOpToMemberFuncPtr<PrecisionT, PrecisionT,
+                                         GateImplementationsLM, gate_op>::value;
+        func_ptr(data_.data(), num_qubits, wires, inverse,
+                 static_cast<PrecisionT>(params)...);
+    }
+
+    [[nodiscard]] auto getData() -> ComplexT * { return data_.data(); }
+
+    [[nodiscard]] auto getData() const -> const ComplexT * {
+        return data_.data();
+    }
+
+    /**
+     * @brief Get underlying data array
+     */
+    [[nodiscard]] auto getDataArray() -> std::array<ComplexT, length> & {
+        return data_;
+    }
+
+    [[nodiscard]] auto getDataArray() const
+        -> const std::array<ComplexT, length> & {
+        return data_;
+    }
+
+    /**
+     * @brief Reset the statevector to the computational basis state |0...0>.
+     */
+    void resetStateVector() {
+        data_.fill(ComplexT{0.0, 0.0});
+        data_[0] = {1, 0};
+    }
+
+    /**
+     * @brief Update data of the class to new_data
+     *
+     * @param new_data data pointer to new data.
+     * @param new_size size of underlying data storage.
+     */
+    void updateData(const ComplexT *new_data, size_t new_size) {
+        PL_ABORT_IF_NOT(new_size == length,
+                        "The size of provided data must match the number of "
+                        "qubits of the statevector.");
+        std::copy(new_data, new_data + new_size, data_.data());
+    }
+
+    /**
+     * @brief Update data of the class to new_data
+     *
+     * @tparam Alloc Allocator type of std::vector to use for updating data.
+     * @param new_data std::vector contains data.
+     */
+    template <class Alloc>
+    void updateData(const std::vector<ComplexT, Alloc> &new_data) {
+        updateData(new_data.data(), new_data.size());
+    }
+};
+
+/**
+ * @brief Run many circuits on fixed-size statevectors.
+ *
+ * Each thread creates a single statevector, which is reset to |0...0> before
+ * every circuit, so no statevector is allocated per circuit. For every index
+ * in `[0, num_circuits)`, `circuit(index, sv)` applies the operations of the
+ * circuit to `sv` and stores its results. Circuits are distributed over the
+ * OpenMP threads, and the first exception thrown by a circuit is rethrown once
+ * all threads are done.
+ *
+ * @tparam PrecisionT Floating point precision of the statevectors.
+ * @tparam num_qubits Number of qubits of the circuits.
+ * @tparam CircuitFunc Callable as `void(size_t,
+ * StateVectorLQubitFixed<PrecisionT, num_qubits> &)`.
+ * @param num_circuits Number of circuits.
+ * @param circuit Function running the circuit of a given index.
+ */
+template <class PrecisionT, size_t num_qubits, class CircuitFunc>
+void runBatched(size_t num_circuits, CircuitFunc &&circuit) {
+    using StateVectorT = StateVectorLQubitFixed<PrecisionT, num_qubits>;
+    std::exception_ptr ex = nullptr;
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel default(none) shared(circuit, ex, num_circuits)
+    #endif
+    {
+        StateVectorT sv;
+        #if defined(_OPENMP)
+            #pragma omp for
+        #endif
+        for (size_t idx = 0; idx < num_circuits; idx++) {
+            try {
+                sv.resetStateVector();
+                circuit(idx, sv);
+            } catch (...) {
+                #if defined(_OPENMP)
+                    #pragma omp critical
+                #endif
+                {
+                    if (!ex) {
+                        ex = std::current_exception();
+                    }
+                }
+            }
+        }
+    }
+    // clang-format on
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+} // namespace Pennylane::LightningQubit
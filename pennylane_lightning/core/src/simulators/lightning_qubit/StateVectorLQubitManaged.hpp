@@ -19,7 +19,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <complex>
+#include <utility>
 #include <vector>
 
 #include "BitUtil.hpp"        // log2PerfectPower, isPerfectPowerOf2
@@ -28,6 +30,7 @@
 #include "KernelType.hpp"
 #include "Memory.hpp"
 #include "StateVectorLQubit.hpp"
+#include "StateVectorLQubitSnapshot.hpp"
 #include "Threading.hpp"
 #include "Util.hpp" // exp2
 
@@ -61,6 +64,17 @@ class StateVectorLQubitManaged final
     using BaseType =
         StateVectorLQubit<PrecisionT, StateVectorLQubitManaged<PrecisionT>>;
     std::vector<ComplexT, AlignedAllocator<ComplexT>> data_;
+    bool pooled_{false};
+
+    /**
+     * @brief Construct a statevector owning a buffer taken from the
+     * AmplitudeBufferPool. The buffer returns to the pool on destruction.
+     */
+    StateVectorLQubitManaged(
+        size_t num_qubits, Threading threading, CPUMemoryModel memory_model,
+        std::vector<ComplexT, AlignedAllocator<ComplexT>> &&buffer)
+        : BaseType{num_qubits, threading, memory_model},
+          data_{std::move(buffer)}, pooled_{true} {}
 
   public:
     /**
@@ -137,7 +151,29 @@ class StateVectorLQubitManaged final
     StateVectorLQubitManaged &
     operator=(StateVectorLQubitManaged &&) noexcept = default;
 
-    ~StateVectorLQubitManaged() = default;
+    ~StateVectorLQubitManaged() {
+        if (pooled_) {
+            AmplitudeBufferPool<PrecisionT>::getInstance().release(
+                std::move(data_));
+        }
+    }
+
+    /**
+     * @brief Fork the statevector.
+     *
+     * The copy is written into a buffer from the AmplitudeBufferPool, so
+     * repeatedly forking and discarding branches reuses memory that is
+     * already mapped. The buffer returns to the pool when the fork is
+     * destroyed.
+     */
+    [[nodiscard]] auto fork() const -> StateVectorLQubitManaged {
+        auto buffer = AmplitudeBufferPool<PrecisionT>::getInstance().acquire(
+            data_.size(), this->memoryModel());
+        std::copy(data_.begin(), data_.end(), buffer.begin());
+        return StateVectorLQubitManaged(this->getNumQubits(),
+                                        this->threading(),
+                                        this->memoryModel(), std::move(buffer));
+    }
 
     [[nodiscard]] auto getData() -> ComplexT * { return data_.data(); }
 
@@ -0,0 +1,294 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Snapshots of Lightning qubit state vectors, stored in chunks taken from a
+ * pool of reusable buffers.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "CPUMemoryModel.hpp" // getAlignment, getAllocator, bestCPUMemoryModel
+#include "Error.hpp"
+#include "Memory.hpp"
+#include "Util.hpp" // exp2
+
+/// @cond DEV
+namespace {
+using Pennylane::Util::AlignedAllocator;
+using Pennylane::Util::bestCPUMemoryModel;
+using Pennylane::Util::CPUMemoryModel;
+using Pennylane::Util::exp2;
+} // namespace
+/// @endcond
+
+namespace Pennylane::LightningQubit {
+/**
+ * @brief Pool of aligned amplitude buffers.
+ *
+ * Released buffers are kept per size and handed out again, so snapshots and
+ * forks reuse memory that is already mapped instead of faulting in new pages.
+ * The number of pooled amplitudes is bounded by a capacity, by default that of
+ * a few 20-qubit state vectors; buffers released beyond it are freed. A
+ * capacity of 0 disables pooling.
+ *
+ * @tparam PrecisionT Floating point precision of the amplitudes.
+ */
+template <class PrecisionT> class AmplitudeBufferPool {
+  public:
+    using ComplexT = std::complex<PrecisionT>;
+    using BufferT = std::vector<ComplexT, AlignedAllocator<ComplexT>>;
+
+    /// Default maximum number of pooled amplitudes.
+    constexpr static size_t default_capacity = size_t{1} << 22U;
+
+  private:
+    mutable std::mutex mutex_;
+    std::unordered_map<size_t, std::vector<BufferT>> free_buffers_;
+    size_t num_pooled_amplitudes_{0};
+    size_t capacity_{default_capacity};
+
+    AmplitudeBufferPool() = default;
+
+  public:
+    AmplitudeBufferPool(const AmplitudeBufferPool &) = delete;
+    AmplitudeBufferPool(AmplitudeBufferPool &&) = delete;
+    AmplitudeBufferPool &operator=(const AmplitudeBufferPool &) = delete;
+    AmplitudeBufferPool &operator=(AmplitudeBufferPool &&) = delete;
+    ~AmplitudeBufferPool() = default;
+
+    /**
+     * @brief Get the singleton instance
+     */
+    static auto getInstance() -> AmplitudeBufferPool & {
+        static AmplitudeBufferPool instance;
+        return instance;
+    }
+
+    /**
+     * @brief Get a buffer of the given size. Its content is unspecified.
+     *
+     * @param size Number of amplitudes.
+     * @param memory_model Memory model the buffer is allocated with.
+     */
+    auto acquire(size_t size,
+                 CPUMemoryModel memory_model = bestCPUMemoryModel())
+        -> BufferT {
+        const auto alignment =
+            Pennylane::Util::getAlignment<ComplexT>(memory_model);
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            auto iter = free_buffers_.find(size);
+            if (iter != free_buffers_.end()) {
+                auto &buffers = iter->second;
+                auto match = std::find_if(
+                    buffers.begin(), buffers.end(), [=](const auto &buffer) {
+                        return buffer.get_allocator().alignment() == alignment;
+                    });
+                if (match != buffers.end()) {
+                    BufferT buffer = std::move(*match);
+                    buffers.erase(match);
+                    num_pooled_amplitudes_ -= size;
+                    return buffer;
+                }
+            }
+        }
+        return BufferT(size,
+                       Pennylane::Util::getAllocator<ComplexT>(memory_model));
+    }
+
+    /**
+     * @brief Return a buffer to the pool.
+     *
+     * @param buffer Buffer to return.
+     */
+    void release(BufferT &&buffer) {
+        const size_t size = buffer.size();
+        if (size == 0) {
+            return;
+        }
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (num_pooled_amplitudes_ + size > capacity_) {
+            return;
+        }
+        free_buffers_[size].push_back(std::move(buffer));
+        num_pooled_amplitudes_ += size;
+    }
+
+    /**
+     * @brief Set the maximum number of amplitudes kept by the pool.
+     *
+     * @param capacity Number of amplitudes.
+     */
+    void setCapacity(size_t capacity) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = capacity;
+        if (num_pooled_amplitudes_ > capacity_) {
+            free_buffers_.clear();
+            num_pooled_amplitudes_ = 0;
+        }
+    }
+
+    /**
+     * @brief Free all pooled buffers.
+     */
+    void clear() {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        free_buffers_.clear();
+        num_pooled_amplitudes_ = 0;
+    }
+
+    /**
+     * @brief Number of amplitudes currently held by the pool.
+     */
+    [[nodiscard]] auto getNumPooledAmplitudes() const -> size_t {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return num_pooled_amplitudes_;
+    }
+};
+
+/**
+ * @brief Immutable copy of a state vector, stored as fixed-size chunks.
+ *
+ * Chunks are reference counted and never modified once taken, so snapshots
+ * that derive from a common base share every chunk that did not change.
+ * Chunk buffers return to the AmplitudeBufferPool when the last snapshot
+ * holding them is destroyed.
+ *
+ * @tparam PrecisionT Floating point precision of the amplitudes.
+ */
+template <class PrecisionT> class StateVectorLQubitSnapshot {
+  public:
+    using ComplexT = std::complex<PrecisionT>;
+    using PoolT = AmplitudeBufferPool<PrecisionT>;
+    using BufferT = typename PoolT::BufferT;
+
+    /// Default number of qubits addressed within a chunk.
+    constexpr static size_t default_chunk_qubits = 14;
+
+  private:
+    size_t num_qubits_;
+    size_t chunk_size_;
+    std::vector<std::shared_ptr<const BufferT>> chunks_;
+
+    static auto makeChunk(const ComplexT *data, size_t size)
+        -> std::shared_ptr<const BufferT> {
+        std::shared_ptr<BufferT> chunk(
+            new BufferT(PoolT::getInstance().acquire(size)),
+            [](BufferT *buffer) {
+                PoolT::getInstance().release(std::move(*buffer));
+                delete buffer;
+            });
+        std::copy(data, data + size, chunk->data());
+        return chunk;
+    }
+
+  public:
+    /**
+     * @brief Take a snapshot of amplitude data.
+     *
+     * @param data Amplitudes to copy.
+     * @param num_qubits Number of qubits.
+     * @param chunk_qubits Number of qubits addressed within a chunk.
+     */
+    StateVectorLQubitSnapshot(const ComplexT *data, size_t num_qubits,
+                              size_t chunk_qubits = default_chunk_qubits)
+        : num_qubits_{num_qubits},
+          chunk_size_{exp2(std::min(num_qubits, chunk_qubits))} {
+        const size_t length = exp2(num_qubits);
+        chunks_.reserve(length / chunk_size_);
+        for (size_t offset = 0; offset < length; offset += chunk_size_) {
+            chunks_.push_back(makeChunk(data + offset, chunk_size_));
+        }
+    }
+
+    /**
+     * @brief Take a snapshot of amplitude data, sharing the chunks that are
+     * unchanged since a base snapshot.
+     *
+     * @param data Amplitudes to copy.
+     * @param num_qubits Number of qubits.
+     * @param base Earlier snapshot of the same state vector, or of a state
+     * vector forked from it.
+     */
+    StateVectorLQubitSnapshot(const ComplexT *data, size_t num_qubits,
+                              const StateVectorLQubitSnapshot &base)
+        : num_qubits_{num_qubits}, chunk_size_{base.chunk_size_} {
+        PL_ABORT_IF_NOT(base.num_qubits_ == num_qubits,
+                        "The base snapshot must have the same number of "
+                        "qubits.");
+        chunks_.reserve(base.chunks_.size());
+        for (size_t idx = 0; idx < base.chunks_.size(); idx++) {
+            const ComplexT *chunk_data = data + idx * chunk_size_;
+            const auto &base_chunk = base.chunks_[idx];
+            if (std::equal(chunk_data, chunk_data + chunk_size_,
+                           base_chunk->data())) {
+                chunks_.push_back(base_chunk);
+            } else {
+                chunks_.push_back(makeChunk(chunk_data, chunk_size_));
+            }
+        }
+    }
+
+    /**
+     * @brief Copy the snapshot into amplitude data.
+     *
+     * @param data Destination with 2^num_qubits amplitudes.
+     */
+    void copyTo(ComplexT *data) const {
+        for (size_t idx = 0; idx < chunks_.size(); idx++) {
+            std::copy(chunks_[idx]->begin(), chunks_[idx]->end(),
+                      data + idx * chunk_size_);
+        }
+    }
+
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    [[nodiscard]] auto getLength() const -> size_t {
+        return chunk_size_ * chunks_.size();
+    }
+
+    [[nodiscard]] auto getNumChunks() const -> size_t {
+        return chunks_.size();
+    }
+
+    /**
+     * @brief Number of chunks stored in the same buffer as in another
+     * snapshot.
+     *
+     * @param other Another snapshot.
+     */
+    [[nodiscard]] auto
+    getNumSharedChunks(const StateVectorLQubitSnapshot &other) const
+        -> size_t {
+        if (other.chunks_.size() != chunks_.size()) {
+            return 0;
+        }
+        size_t num_shared = 0;
+        for (size_t idx = 0; idx < chunks_.size(); idx++) {
+            num_shared += (chunks_[idx] == other.chunks_[idx]) ? 1 : 0;
+        }
+        return num_shared;
+    }
+};
+} // namespace Pennylane::LightningQubit
@@ -18,15 +18,18 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <span>
 #include <type_traits>
 #include <vector>
 
 #include "AdjointJacobianBase.hpp"
+#include "BitUtil.hpp" // log2PerfectPower
 #include "JacobianData.hpp"
 #include "LinearAlgebra.hpp" // innerProdC, Transpose
 #include "StateVectorLQubitManaged.hpp"
 #include "StateVectorLQubitRaw.hpp"
+#include "Threading.hpp" // maxThreads, numSegments, partitionThreads
 
 // using namespace Pennylane;
 /// @cond DEV
@@ -34,8 +37,14 @@ namespace {
 using namespace Pennylane::Algorithms;
 using namespace Pennylane::Util::MemoryStorageLocation;
 
+using Pennylane::LightningQubit::Util::maxThreads;
+using Pennylane::LightningQubit::Util::numSegments;
+using Pennylane::LightningQubit::Util::partitionThreads;
+using Pennylane::LightningQubit::Util::ThreadPartition;
+
 using Pennylane::LightningQubit::Util::innerProdC;
 using Pennylane::LightningQubit::Util::Transpose;
+using Pennylane::Util::log2PerfectPower;
 
 } // namespace
 /// @endcond
@@ -54,6 +63,111 @@ class AdjointJacobian final
     using PrecisionT = typename StateVectorT::PrecisionT;
     using BaseType =
         AdjointJacobianBase<StateVectorT, AdjointJacobian<StateVectorT>>;
+    using ChunkStateVectorT = StateVectorLQubitRaw<PrecisionT>;
+
+    /**
+     * @brief Minimal number of qubits of a statevector chunk handled by a
+     * single thread.
+     */
+    constexpr static size_t min_chunk_qubits = 14;
+
+    /**
+     * @brief Per-call state of a backward pass. It is local to each call, so
+     * that an instance can be shared by concurrent calls.
+     */
+    struct BackwardWorkspace {
+        /// Thread partition of the backward pass.
+        ThreadPartition partition{1, 1, 0};
+        /// Views on the amplitude chunks of the backward states; one row of
+        /// `2^partition.chunk_qubits` chunks per observable, then |lambda>.
+        std::vector<ChunkStateVectorT> chunks;
+    };
+
+    /**
+     * @brief Default memory budget of the boundary states kept by a
+     * segmented backward pass, in bytes.
+     */
+    constexpr static size_t default_segment_memory_budget = size_t{1} << 30U;
+
+    /// Memory budget of the boundary states of a segmented backward pass.
+    size_t segment_memory_budget_ = default_segment_memory_budget;
+
+    /**
+     * @brief Choose the number of segments of a backward pass from the idle
+     * threads and the segment memory budget.
+     *
+     * @param partition Thread partition of the backward pass.
+     * @param num_trainable Number of trainable parameters.
+     * @param num_observables Number of observables.
+     * @param length Length of the statevector.
+     */
+    [[nodiscard]] auto chooseNumSegments(const ThreadPartition &partition,
+                                         size_t num_trainable,
+                                         size_t num_observables,
+                                         size_t length) const -> size_t {
+        return numSegments(maxThreads(),
+                           partition.state_threads *
+                               partition.amplitude_threads,
+                           num_trainable,
+                           (num_observables + 2) * length * sizeof(ComplexT),
+                           segment_memory_budget_);
+    }
+
+    /**
+     * @brief Choose the thread partition for the backward pass and split
+     * the backward states into chunks accordingly.
+     *
+     * @param states Vector of all statevectors; 1 per observable
+     * @param lambda Statevector |lambda>
+     * @return Workspace of the backward pass.
+     */
+    template <class RefStateVectorT>
+    static auto partitionStates(std::vector<StateVectorT> &states,
+                                RefStateVectorT &lambda)
+        -> BackwardWorkspace {
+        BackwardWorkspace workspace{
+            getThreadPartition(states.size(), lambda.getNumQubits()), {}};
+        if (workspace.partition.chunk_qubits == 0) {
+            return workspace;
+        }
+        const size_t num_chunks = size_t{1} << workspace.partition.chunk_qubits;
+        const size_t chunk_length = lambda.getLength() / num_chunks;
+        auto addChunks = [&](ComplexT *data) {
+            for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+                workspace.chunks.emplace_back(data + chunk * chunk_length,
+                                              chunk_length);
+            }
+        };
+        for (auto &state : states) {
+            addChunks(state.getData());
+        }
+        addChunks(lambda.getData());
+        return workspace;
+    }
+
+    /**
+     * @brief Check whether wires leave the leading `chunk_qubits` qubits
+     * untouched, in which case an operation acts on each chunk separately.
+     */
+    [[nodiscard]] static auto isChunkLocal(const std::vector<size_t> &wires,
+                                           size_t chunk_qubits) -> bool {
+        return std::all_of(
+            wires.begin(), wires.end(),
+            [chunk_qubits](size_t wire) { return wire >= chunk_qubits; });
+    }
+
+    /**
+     * @brief Wires relative to a chunk whose leading `offset` qubits are
+     * fixed.
+     */
+    [[nodiscard]] static auto shiftWires(const std::vector<size_t> &wires,
+                                         size_t offset)
+        -> std::vector<size_t> {
+        std::vector<size_t> shifted(wires.size());
+        std::transform(wires.begin(), wires.end(), shifted.begin(),
+                       [offset](size_t wire) { return wire - offset; });
+        return shifted;
+    }
 
     /**
      * @brief Utility method to update the Jacobian at a given index by
@@ -149,25 +263,495 @@ class AdjointJacobian final
      * @param operations Operations list.
      * @param op_idx Index of given operation within operations list to take
      * adjoint of.
+     * @param workspace Workspace of the backward pass.
+     *
+     * When the operation leaves the leading qubits untouched and spare
+     * threads are available, each statevector is processed chunk by chunk.
      */
     inline void applyOperationsAdj(std::vector<StateVectorT> &states,
                                    const OpsData<StateVectorT> &operations,
-                                   size_t op_idx) {
+                                   size_t op_idx,
+                                   BackwardWorkspace &workspace) {
+        const auto &partition = workspace.partition;
+        auto &chunks = workspace.chunks;
+        const size_t chunk_qubits =
+            isChunkLocal(operations.getOpsWires()[op_idx],
+                         partition.chunk_qubits)
+                ? partition.chunk_qubits
+                : 0;
+        const size_t num_chunks = size_t{1} << chunk_qubits;
+        const size_t num_tasks = states.size() * num_chunks;
+        const size_t num_threads =
+            partition.state_threads *
+            (chunk_qubits > 0 ? partition.amplitude_threads : 1);
+        const std::vector<size_t> chunk_wires =
+            shiftWires(operations.getOpsWires()[op_idx], chunk_qubits);
+
         // clang-format off
         // Globally scoped exception value to be captured within OpenMP block.
         // See the following for OpenMP design decisions:
         // https://www.openmp.org/wp-content/uploads/openmp-examples-4.5.0.pdf
         std::exception_ptr ex = nullptr;
-        size_t num_states = states.size();
         #if defined(_OPENMP)
-            #pragma omp parallel default(none)                                 \
-                shared(states, operations, op_idx, ex, num_states)
+            #pragma omp parallel default(none) num_threads(num_threads)       \
+                shared(states, operations, op_idx, ex, num_tasks,              \
+                       chunk_qubits, chunk_wires, chunks)
         {
             #pragma omp for
         #endif
-            for (size_t st_idx = 0; st_idx < num_states; st_idx++) {
+            for (size_t task = 0; task < num_tasks; task++) {
+                try {
+                    if (chunk_qubits > 0) {
+                        chunks[task].applyOperation(
+                            operations.getOpsName()[op_idx], chunk_wires,
+                            !operations.getOpsInverses()[op_idx],
+                            operations.getOpsParams()[op_idx],
+                            operations.getOpsMatrices()[op_idx]);
+                    } else {
+                        this->applyOperationAdj(states[task], operations,
+                                                op_idx);
+                    }
+                } catch (...) {
+                    #if defined(_OPENMP)
+                        #pragma omp critical
+                    #endif
+                    ex = std::current_exception();
+                    #if defined(_OPENMP)
+                        #pragma omp cancel for
+                    #endif
+                }
+            }
+        #if defined(_OPENMP)
+            if (ex) {
+                #pragma omp cancel parallel
+            }
+        }
+        #endif
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
+        // clang-format on
+    }
+
+    /**
+     * @brief Adjoint of one or more consecutive operations. A single
+     * operation is applied through its own kernel, while several operations
+     * are fused into one dense matrix.
+     */
+    struct FusedOperation {
+        std::vector<size_t> op_indices;
+        std::vector<size_t> wires;
+        std::vector<ComplexT> matrix;
+    };
+
+    /**
+     * @brief Maximum number of wires of a fused block of constant operations.
+     */
+    constexpr static size_t max_fused_wires = 2;
+
+    /**
+     * @brief Build the dense matrix of the adjoint of a block of operations.
+     *
+     * @param operations Operations list.
+     * @param block Block whose operation indices are in order of application.
+     * Its wires and matrix are set by this function.
+     */
+    void fuseOperationsAdj(const OpsData<StateVectorT> &operations,
+                           FusedOperation &block) {
+        const size_t num_wires = block.wires.size();
+        const size_t dim = Pennylane::Util::exp2(num_wires);
+        block.matrix.assign(dim * dim, ComplexT{0.0, 0.0});
+
+        std::vector<std::vector<size_t>> local_wires;
+        for (const auto op_idx : block.op_indices) {
+            std::vector<size_t> op_wires;
+            for (const auto wire : operations.getOpsWires()[op_idx]) {
+                op_wires.push_back(static_cast<size_t>(
+                    std::find(block.wires.begin(), block.wires.end(), wire) -
+                    block.wires.begin()));
+            }
+            local_wires.push_back(std::move(op_wires));
+        }
+
+        StateVectorLQubitManaged<PrecisionT> column(num_wires);
+        for (size_t col = 0; col < dim; col++) {
+            std::fill(column.getData(), column.getData() + dim,
+                      ComplexT{0.0, 0.0});
+            column.getData()[col] = ComplexT{1.0, 0.0};
+            for (size_t i = 0; i < block.op_indices.size(); i++) {
+                const size_t op_idx = block.op_indices[i];
+                column.applyOperation(operations.getOpsName()[op_idx],
+                                      local_wires[i],
+                                      !operations.getOpsInverses()[op_idx],
+                                      operations.getOpsParams()[op_idx],
+                                      operations.getOpsMatrices()[op_idx]);
+            }
+            for (size_t row = 0; row < dim; row++) {
+                block.matrix[row * dim + col] = column.getData()[row];
+            }
+        }
+    }
+
+    /**
+     * @brief Group the adjoints of a segment of constant operations into
+     * blocks acting on at most `max_fused_wires` wires.
+     *
+     * @param operations Operations list.
+     * @param op_indices Operation indices in order of application.
+     * @return Blocks in order of application.
+     */
+    auto fuseSegmentAdj(const OpsData<StateVectorT> &operations,
+                        const std::vector<size_t> &op_indices)
+        -> std::vector<FusedOperation> {
+        std::vector<FusedOperation> blocks;
+        for (const auto op_idx : op_indices) {
+            const auto &op_wires = operations.getOpsWires()[op_idx];
+            if (!blocks.empty() && !blocks.back().wires.empty()) {
+                auto &block = blocks.back();
+                std::vector<size_t> wires = block.wires;
+                for (const auto wire : op_wires) {
+                    if (std::find(wires.begin(), wires.end(), wire) ==
+                        wires.end()) {
+                        wires.push_back(wire);
+                    }
+                }
+                if (wires.size() <= max_fused_wires) {
+                    block.op_indices.push_back(op_idx);
+                    block.wires = std::move(wires);
+                    continue;
+                }
+            }
+            FusedOperation block{{op_idx}, {}, {}};
+            if (!op_wires.empty() && op_wires.size() <= max_fused_wires) {
+                block.wires = op_wires;
+            }
+            blocks.push_back(std::move(block));
+        }
+        for (auto &block : blocks) {
+            if (block.op_indices.size() > 1) {
+                fuseOperationsAdj(operations, block);
+            }
+        }
+        return blocks;
+    }
+
+    /**
+     * @brief Apply a list of fused blocks to a statevector.
+     *
+     * @tparam UpdatedStateVectorT updated state vector type.
+     * @param state Statevector to be updated.
+     * @param operations Operations list.
+     * @param blocks Blocks in order of application.
+     * @param wire_offset Number of leading qubits fixed in `state` when it is
+     * a chunk of a larger statevector.
+     */
+    template <class UpdatedStateVectorT>
+    inline void applyFusedOperations(UpdatedStateVectorT &state,
+                                     const OpsData<StateVectorT> &operations,
+                                     const std::vector<FusedOperation> &blocks,
+                                     size_t wire_offset = 0) {
+        for (const auto &block : blocks) {
+            if (block.op_indices.size() > 1) {
+                state.applyMatrix(block.matrix,
+                                  shiftWires(block.wires, wire_offset));
+            } else if (wire_offset == 0) {
+                this->applyOperationAdj(state, operations,
+                                        block.op_indices[0]);
+            } else {
+                const size_t op_idx = block.op_indices[0];
+                state.applyOperation(
+                    operations.getOpsName()[op_idx],
+                    shiftWires(operations.getOpsWires()[op_idx], wire_offset),
+                    !operations.getOpsInverses()[op_idx],
+                    operations.getOpsParams()[op_idx],
+                    operations.getOpsMatrices()[op_idx]);
+            }
+        }
+    }
+
+    /**
+     * @brief Check whether every block leaves the leading `chunk_qubits`
+     * qubits untouched.
+     */
+    [[nodiscard]] static auto
+    isChunkLocal(const OpsData<StateVectorT> &operations,
+                 const std::vector<FusedOperation> &blocks,
+                 size_t chunk_qubits) -> bool {
+        return std::all_of(
+            blocks.begin(), blocks.end(), [&](const FusedOperation &block) {
+                return isChunkLocal(
+                    block.op_indices.size() > 1
+                        ? block.wires
+                        : operations.getOpsWires()[block.op_indices[0]],
+                    chunk_qubits);
+            });
+    }
+
+    /**
+     * @brief OpenMP accelerated application of a segment of constant adjoint
+     * operations to `lambda` and all observable-applied statevectors.
+     *
+     * Each thread applies the whole segment to one statevector, or to one
+     * chunk of a statevector when the segment leaves the leading qubits
+     * untouched and spare threads are available. The backward pass thus
+     * enters a single parallel region per segment rather than one per
+     * operation.
+     *
+     * @param states Vector of all statevectors; 1 per observable
+     * @param lambda Statevector |lambda>
+     * @param operations Operations list.
+     * @param blocks Fused blocks of the segment in order of application.
+     * @param workspace Workspace of the backward pass.
+     */
+    template <class RefStateVectorT>
+    inline void applySegmentAdj(std::vector<StateVectorT> &states,
+                                RefStateVectorT &lambda,
+                                const OpsData<StateVectorT> &operations,
+                                const std::vector<FusedOperation> &blocks,
+                                BackwardWorkspace &workspace) {
+        // clang-format off
+        // Globally scoped exception value to be captured within OpenMP block.
+        // See the following for OpenMP design decisions:
+        // https://www.openmp.org/wp-content/uploads/openmp-examples-4.5.0.pdf
+        std::exception_ptr ex = nullptr;
+        const size_t num_states = states.size();
+        const auto &partition = workspace.partition;
+        auto &chunks = workspace.chunks;
+        const size_t chunk_qubits =
+            isChunkLocal(operations, blocks, partition.chunk_qubits)
+                ? partition.chunk_qubits
+                : 0;
+        const size_t num_tasks = (num_states + 1) << chunk_qubits;
+        const size_t num_threads =
+            partition.state_threads *
+            (chunk_qubits > 0 ? partition.amplitude_threads : 1);
+        #if defined(_OPENMP)
+            #pragma omp parallel default(none) num_threads(num_threads)       \
+                shared(states, lambda, operations, blocks, ex, num_states,     \
+                       num_tasks, chunk_qubits, chunks)
+        {
+            #pragma omp for
+        #endif
+            for (size_t st_idx = 0; st_idx < num_tasks; st_idx++) {
+                try {
+                    if (chunk_qubits > 0) {
+                        applyFusedOperations(chunks[st_idx], operations,
+                                             blocks, chunk_qubits);
+                    } else if (st_idx == num_states) {
+                        applyFusedOperations(lambda, operations, blocks);
+                    } else {
+                        applyFusedOperations(states[st_idx], operations,
+                                             blocks);
+                    }
+                } catch (...) {
+                    #if defined(_OPENMP)
+                        #pragma omp critical
+                    #endif
+                    ex = std::current_exception();
+                    #if defined(_OPENMP)
+                        #pragma omp cancel for
+                    #endif
+                }
+            }
+        #if defined(_OPENMP)
+            if (ex) {
+                #pragma omp cancel parallel
+            }
+        }
+        #endif
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
+        // clang-format on
+    }
+
+    /**
+     * @brief Indices of the trainable operations, in order of application.
+     *
+     * @param operations Operations list.
+     * @param tp Sorted trainable parameter indices.
+     */
+    [[nodiscard]] static auto
+    trainableOperations(const OpsData<StateVectorT> &operations,
+                        const std::vector<size_t> &tp) -> std::vector<size_t> {
+        std::vector<size_t> trainable_ops;
+        trainable_ops.reserve(tp.size());
+        auto tp_it = tp.begin();
+        size_t param_idx = 0;
+        for (size_t op_idx = 0;
+             op_idx < operations.getOpsName().size() && tp_it != tp.end();
+             op_idx++) {
+            if (!operations.hasParams(op_idx)) {
+                continue;
+            }
+            if (param_idx == *tp_it) {
+                trainable_ops.push_back(op_idx);
+                ++tp_it;
+            }
+            param_idx++;
+        }
+        return trainable_ops;
+    }
+
+    /**
+     * @brief Sequential backward sweep over one segment of operations.
+     *
+     * @param jac Jacobian receiving the rows of the segment, one row of
+     * `bras.size()` values per trainable operation.
+     * @param operations Operations list.
+     * @param trainable_ops Indices of the trainable operations.
+     * @param first Position in `trainable_ops` of the first trainable
+     * operation of the segment.
+     * @param last Position in `trainable_ops` past the last trainable
+     * operation of the segment.
+     * @param bras Observable-applied states at the end of the segment.
+     * @param ket State |lambda> at the end of the segment.
+     */
+    template <class BraStateVectorT>
+    void sweepSegment(std::span<PrecisionT> jac,
+                      const OpsData<StateVectorT> &operations,
+                      const std::vector<size_t> &trainable_ops, size_t first,
+                      size_t last, std::vector<BraStateVectorT> &bras,
+                      StateVectorLQubitManaged<PrecisionT> &ket) {
+        const size_t num_observables = bras.size();
+        StateVectorLQubitManaged<PrecisionT> mu(ket.getNumQubits());
+
+        size_t tp_pos = last;
+        for (size_t op_idx = trainable_ops[last - 1] + 1;
+             op_idx-- > trainable_ops[first];) {
+            if (isStatePrep(operations, op_idx)) {
+                continue;
+            }
+            if (op_idx != trainable_ops[tp_pos - 1]) {
+                this->applyOperationAdj(ket, operations, op_idx);
+                for (auto &bra : bras) {
+                    this->applyOperationAdj(bra, operations, op_idx);
+                }
+                continue;
+            }
+            tp_pos--;
+            mu.updateData(ket.getData(), ket.getLength());
+            this->applyOperationAdj(ket, operations, op_idx);
+
+            const PrecisionT scalingFactor =
+                mu.applyGenerator(operations.getOpsName()[op_idx],
+                                  operations.getOpsWires()[op_idx],
+                                  !operations.getOpsInverses()[op_idx]) *
+                (operations.getOpsInverses()[op_idx] ? -1 : 1);
+            for (size_t obs_idx = 0; obs_idx < num_observables; obs_idx++) {
+                jac[tp_pos * num_observables + obs_idx] =
+                    -2 * scalingFactor *
+                    std::imag(innerProdC(bras[obs_idx].getData(),
+                                         mu.getData(), mu.getLength()));
+                this->applyOperationAdj(bras[obs_idx], operations, op_idx);
+            }
+        }
+    }
+
+    /**
+     * @brief Time-parallel backward pass.
+     *
+     * The trainable operations are split into `num_segments` consecutive
+     * segments. A first sequential sweep transports |lambda> and the
+     * observable-applied states from the end of the circuit to the end of
+     * each segment, keeping a copy of them at every boundary. The segments
+     * are then swept concurrently, one thread per segment, each with its
+     * own states and |mu>.
+     *
+     * @param jac Jacobian receiving one row per trainable parameter.
+     * @param operations Operations list.
+     * @param tp Sorted trainable parameter indices.
+     * @param states Observable-applied states at the end of the circuit.
+     * @param lambda State |lambda> at the end of the circuit.
+     * @param num_segments Number of segments.
+     * @param workspace Workspace of the backward pass.
+     */
+    void segmentedBackwardPass(std::span<PrecisionT> jac,
+                               const OpsData<StateVectorT> &operations,
+                               const std::vector<size_t> &tp,
+                               std::vector<StateVectorT> &states,
+                               StateVectorLQubitManaged<PrecisionT> &lambda,
+                               size_t num_segments,
+                               BackwardWorkspace &workspace) {
+        const auto trainable_ops = trainableOperations(operations, tp);
+        const size_t num_trainable = trainable_ops.size();
+        PL_ABORT_IF_NOT(num_trainable == tp.size(),
+                        "Trainable parameter indices must refer to parametric "
+                        "operations.");
+        for (size_t op_idx = trainable_ops.front();
+             op_idx < operations.getOpsName().size(); op_idx++) {
+            PL_ABORT_IF(operations.getOpsParams()[op_idx].size() > 1,
+                        "The operation is not supported using the adjoint "
+                        "differentiation method");
+        }
+
+        // Segment s holds the trainable operations at positions
+        // [bounds[s], bounds[s + 1]) of trainable_ops.
+        std::vector<size_t> bounds(num_segments + 1);
+        for (size_t seg = 0; seg <= num_segments; seg++) {
+            bounds[seg] = seg * num_trainable / num_segments;
+        }
+
+        struct BoundaryStates {
+            StateVectorLQubitManaged<PrecisionT> ket;
+            std::vector<StateVectorLQubitManaged<PrecisionT>> bras;
+        };
+        std::vector<BoundaryStates> boundaries;
+        boundaries.reserve(num_segments - 1);
+
+        // Transport the states to the end of each segment, last first.
+        size_t op_end = operations.getOpsName().size();
+        for (size_t seg = num_segments; seg-- > 0;) {
+            const size_t seg_end = trainable_ops[bounds[seg + 1] - 1] + 1;
+            std::vector<size_t> segment;
+            for (size_t op_idx = op_end; op_idx-- > seg_end;) {
+                if (!isStatePrep(operations, op_idx)) {
+                    segment.push_back(op_idx);
+                }
+            }
+            applySegmentAdj(states, lambda, operations,
+                            fuseSegmentAdj(operations, segment), workspace);
+            op_end = seg_end;
+            if (seg == 0) {
+                break;
+            }
+            BoundaryStates boundary{
+                StateVectorLQubitManaged<PrecisionT>(lambda.getData(),
+                                                     lambda.getLength()),
+                {}};
+            boundary.bras.reserve(states.size());
+            for (const auto &state : states) {
+                boundary.bras.emplace_back(state.getData(),
+                                           state.getLength());
+            }
+            boundaries.push_back(std::move(boundary));
+        }
+
+        // clang-format off
+        // Globally scoped exception value to be captured within OpenMP block.
+        // See the following for OpenMP design decisions:
+        // https://www.openmp.org/wp-content/uploads/openmp-examples-4.5.0.pdf
+        std::exception_ptr ex = nullptr;
+        #if defined(_OPENMP)
+            #pragma omp parallel default(none)                                 \
+                num_threads(static_cast<int>(num_segments))                    \
+                shared(jac, operations, trainable_ops, bounds, boundaries,     \
+                       states, lambda, ex, num_segments)
+        {
+            #pragma omp for schedule(static, 1)
+        #endif
+            for (size_t seg = 0; seg < num_segments; seg++) {
                 try {
-                    this->applyOperationAdj(states[st_idx], operations, op_idx);
+                    if (seg == 0) {
+                        sweepSegment(jac, operations, trainable_ops,
+                                     bounds[0], bounds[1], states, lambda);
+                    } else {
+                        // Boundaries were stored from the last segment.
+                        auto &boundary = boundaries[num_segments - 1 - seg];
+                        sweepSegment(jac, operations, trainable_ops,
+                                     bounds[seg], bounds[seg + 1],
+                                     boundary.bras, boundary.ket);
+                    }
                 } catch (...) {
                     #if defined(_OPENMP)
                         #pragma omp critical
@@ -190,7 +774,59 @@ class AdjointJacobian final
         // clang-format on
     }
 
+    [[nodiscard]] static auto
+    isStatePrep(const OpsData<StateVectorT> &operations, size_t op_idx)
+        -> bool {
+        const auto &name = operations.getOpsName()[op_idx];
+        return (name == "QubitStateVector") || (name == "StatePrep") ||
+               (name == "BasisState");
+    }
+
   public:
+    /**
+     * @brief Get the thread partition of a backward pass with the current
+     * maximal number of threads.
+     *
+     * @param num_observables Number of observables.
+     * @param num_qubits Number of qubits of the statevector.
+     * @return ThreadPartition
+     */
+    [[nodiscard]] static auto getThreadPartition(size_t num_observables,
+                                                 size_t num_qubits)
+        -> ThreadPartition {
+        return partitionThreads(num_observables + 1, num_qubits, maxThreads(),
+                                min_chunk_qubits);
+    }
+
+    /**
+     * @brief Get the number of segments `adjointJacobian` uses for a tape
+     * with the current maximal number of threads.
+     *
+     * @param jd JacobianData represents the QuantumTape to differentiate.
+     * @return Number of segments, 1 for a sequential backward pass.
+     */
+    [[nodiscard]] auto
+    getNumSegments(const JacobianData<StateVectorT> &jd) const -> size_t {
+        const size_t num_qubits = log2PerfectPower(jd.getSizeStateVec());
+        const size_t num_observables = jd.getObservables().size();
+        const size_t tp_size = jd.getTrainableParams().size();
+        return std::clamp<size_t>(
+            chooseNumSegments(getThreadPartition(num_observables, num_qubits),
+                              tp_size, num_observables, jd.getSizeStateVec()),
+            1, std::max<size_t>(tp_size, 1));
+    }
+
+    /**
+     * @brief Set the memory available for the boundary states of a
+     * segmented backward pass.
+     *
+     * @param bytes Memory budget in bytes. A budget of 0 disables segmented
+     * backward passes.
+     */
+    void setSegmentMemoryBudget(size_t bytes) {
+        segment_memory_budget_ = bytes;
+    }
+
     /**
      * @brief Calculates the Jacobian for the statevector for the selected set
      * of parametric gates.
@@ -209,11 +845,54 @@ class AdjointJacobian final
      * @param jd JacobianData represents the QuantumTape to differentiate.
      * @param apply_operations Indicate whether to apply operations to tape.psi
      * prior to calculation.
+     * @param expvals Optional preallocated vector receiving the expectation
+     * value of each observable, read from the states of the backward sweep.
      */
     void adjointJacobian(std::span<PrecisionT> jac,
                          const JacobianData<StateVectorT> &jd,
                          [[maybe_unused]] const StateVectorT &ref_data = {0},
-                         bool apply_operations = false) {
+                         bool apply_operations = false,
+                         std::span<PrecisionT> expvals = {}) {
+        adjointJacobianImpl(jac, jd, apply_operations, expvals);
+    }
+
+    /**
+     * @brief Calculates the Jacobian with a time-parallel backward pass
+     * over a given number of segments.
+     *
+     * `adjointJacobian` chooses the number of segments from the number of
+     * idle threads and the segment memory budget. This method forces it.
+     * The result equals the one of the sequential backward pass.
+     *
+     * @param jac Preallocated vector for Jacobian data results.
+     * @param jd JacobianData represents the QuantumTape to differentiate.
+     * @param num_segments Number of segments, at least 1. It is reduced to
+     * the number of trainable parameters when larger.
+     * @param apply_operations Indicate whether to apply operations to tape.psi
+     * prior to calculation.
+     */
+    void adjointJacobianSegmented(std::span<PrecisionT> jac,
+                                  const JacobianData<StateVectorT> &jd,
+                                  size_t num_segments,
+                                  bool apply_operations = false) {
+        PL_ABORT_IF(num_segments == 0,
+                    "The number of segments must be at least one.");
+        adjointJacobianImpl(jac, jd, apply_operations, {}, num_segments);
+    }
+
+  private:
+    /**
+     * @brief Implementation of `adjointJacobian`, which does not require a
+     * reference statevector.
+     *
+     * @param num_segments Number of segments of the backward pass; 0 chooses
+     * it from the idle threads and the segment memory budget.
+     */
+    void adjointJacobianImpl(std::span<PrecisionT> jac,
+                             const JacobianData<StateVectorT> &jd,
+                             bool apply_operations,
+                             std::span<PrecisionT> expvals,
+                             size_t num_segments = 0) {
         const OpsData<StateVectorT> &ops = jd.getOperations();
         const std::vector<std::string> &ops_name = ops.getOpsName();
 
@@ -225,7 +904,7 @@ class AdjointJacobian final
         const size_t tp_size = tp.size();
         const size_t num_param_ops = ops.getNumParOps();
 
-        if (!jd.hasTrainableParams()) {
+        if (!jd.hasTrainableParams() && expvals.empty()) {
             return;
         }
 
@@ -234,6 +913,9 @@ class AdjointJacobian final
             "The size of preallocated jacobian must be same as "
             "the number of trainable parameters times the number of "
             "observables provided.");
+        PL_ABORT_IF_NOT(expvals.empty() || expvals.size() == num_observables,
+                        "The size of preallocated expectation values must be "
+                        "the number of observables provided.");
 
         // Track positions within par and non-par operations
         size_t trainableParamNumber = tp_size - 1;
@@ -284,62 +966,175 @@ class AdjointJacobian final
 
         StateVectorLQubitManaged<PrecisionT> mu(lambda_qubits);
 
+        auto workspace = partitionStates(*H_lambda, lambda);
         applyObservables(*H_lambda, lambda, obs);
 
-        for (int op_idx = static_cast<int>(ops_name.size() - 1); op_idx >= 0;
-             op_idx--) {
-            PL_ABORT_IF(ops.getOpsParams()[op_idx].size() > 1,
-                        "The operation is not supported using the adjoint "
-                        "differentiation method");
-            if ((ops_name[op_idx] == "QubitStateVector") ||
-                (ops_name[op_idx] == "StatePrep") ||
-                (ops_name[op_idx] == "BasisState")) {
-                continue; // Ignore them
-            }
+        for (size_t obs_idx = 0; obs_idx < expvals.size(); obs_idx++) {
+            expvals[obs_idx] = std::real(
+                innerProdC(lambda.getData(), (*H_lambda)[obs_idx].getData(),
+                           lambda.getLength()));
+        }
 
-            if (tp_it == tp_rend) {
-                break; // All done
-            }
-            mu.updateData(lambda.getData(), lambda.getLength());
-            this->applyOperationAdj(lambda, ops, op_idx);
-
-            if (ops.hasParams(op_idx)) {
-                if (current_param_idx == *tp_it) {
-                    // if current parameter is a trainable parameter
-                    const PrecisionT scalingFactor =
-                        mu.applyGenerator(ops_name[op_idx],
-                                          ops.getOpsWires()[op_idx],
-                                          !ops.getOpsInverses()[op_idx]) *
-                        (ops.getOpsInverses()[op_idx] ? -1 : 1);
-
-                    const size_t mat_row_idx =
-                        trainableParamNumber * num_observables;
-
-                    // clang-format off
-
-                #if defined(_OPENMP)
-                #pragma omp parallel for default(none)                         \
-                    shared(H_lambda, jac, mu, scalingFactor, mat_row_idx,      \
-                            num_observables)
-                #endif
-                    // clang-format on
-
-                    for (size_t obs_idx = 0; obs_idx < num_observables;
-                         obs_idx++) {
-                        updateJacobian(*H_lambda, mu, jac, scalingFactor,
-                                       obs_idx, mat_row_idx);
+        // Only the expectation values were requested
+        if (tp_size == 0) {
+            return;
+        }
+
+        if (num_segments == 0) {
+            num_segments =
+                chooseNumSegments(workspace.partition, tp_size,
+                                  num_observables, lambda.getLength());
+        }
+        num_segments = std::clamp<size_t>(num_segments, 1, tp_size);
+        if (num_segments > 1) {
+            segmentedBackwardPass(jac, ops, tp, *H_lambda, lambda,
+                                  num_segments, workspace);
+        } else {
+            auto is_state_prep = [&ops](size_t op_idx) {
+                return isStatePrep(ops, op_idx);
+            };
+
+            int op_idx = static_cast<int>(ops_name.size() - 1);
+            while (op_idx >= 0 && tp_it != tp_rend) {
+                const auto idx = static_cast<size_t>(op_idx);
+                PL_ABORT_IF(ops.getOpsParams()[idx].size() > 1,
+                            "The operation is not supported using the adjoint "
+                            "differentiation method");
+                if (is_state_prep(idx)) {
+                    op_idx--;
+                    continue; // Ignore them
+                }
+
+                if (!ops.hasParams(idx) || current_param_idx != *tp_it) {
+                    // Collect the maximal segment of constant operations and
+                    // apply it to all states at once.
+                    std::vector<size_t> segment;
+                    while (op_idx >= 0) {
+                        const auto seg_idx = static_cast<size_t>(op_idx);
+                        PL_ABORT_IF(ops.getOpsParams()[seg_idx].size() > 1,
+                                    "The operation is not supported using the "
+                                    "adjoint differentiation method");
+                        if (ops.hasParams(seg_idx)) {
+                            if (current_param_idx == *tp_it) {
+                                break;
+                            }
+                            current_param_idx--;
+                        }
+                        if (!is_state_prep(seg_idx)) {
+                            segment.push_back(seg_idx);
+                        }
+                        op_idx--;
                     }
-                    trainableParamNumber--;
-                    ++tp_it;
+                    applySegmentAdj(*H_lambda, lambda, ops,
+                                    fuseSegmentAdj(ops, segment), workspace);
+                    continue;
                 }
+
+                // if current parameter is a trainable parameter
+                mu.updateData(lambda.getData(), lambda.getLength());
+                this->applyOperationAdj(lambda, ops, idx);
+
+                const PrecisionT scalingFactor =
+                    mu.applyGenerator(ops_name[idx], ops.getOpsWires()[idx],
+                                      !ops.getOpsInverses()[idx]) *
+                    (ops.getOpsInverses()[idx] ? -1 : 1);
+
+                const size_t mat_row_idx =
+                    trainableParamNumber * num_observables;
+                // With spare threads, the overlaps are computed one after
+                // another, each of them in parallel over the amplitudes.
+                const bool parallel_obs =
+                    workspace.partition.amplitude_threads == 1;
+
+                // clang-format off
+
+            #if defined(_OPENMP)
+            #pragma omp parallel for default(none) if (parallel_obs)           \
+                shared(H_lambda, jac, mu, scalingFactor, mat_row_idx,          \
+                        num_observables)
+            #endif
+                // clang-format on
+
+                for (size_t obs_idx = 0; obs_idx < num_observables;
+                     obs_idx++) {
+                    updateJacobian(*H_lambda, mu, jac, scalingFactor,
+                                   obs_idx, mat_row_idx);
+                }
+                trainableParamNumber--;
+                ++tp_it;
                 current_param_idx--;
+
+                applyOperationsAdj(*H_lambda, ops, idx, workspace);
+                op_idx--;
             }
-            applyOperationsAdj(*H_lambda, ops, static_cast<size_t>(op_idx));
         }
         const auto jac_transpose = Transpose(std::span<const PrecisionT>{jac},
                                              tp_size, num_observables);
         std::copy(std::begin(jac_transpose), std::end(jac_transpose),
                   std::begin(jac));
     }
+
+  public:
+    /**
+     * @brief Calculates the Jacobian of every term of a Hamiltonian together
+     * with the term expectation values.
+     *
+     * The terms are kept as separate backward states. At most `max_states`
+     * of them are held at once; larger Hamiltonians are processed in batches
+     * of terms, each costing one forward and one backward sweep. The Jacobian
+     * of the Hamiltonian is `sum_k c_k jac[k, :]`, and its derivative with
+     * respect to the coefficient `c_k` is `term_expvals[k]`.
+     *
+     * @param jac Preallocated row-major vector of shape `(num_terms,
+     * jd.getTrainableParams().size())` receiving the Jacobian of each term.
+     * @param term_expvals Preallocated vector of size `num_terms` receiving
+     * the expectation value of each term.
+     * @param jd JacobianData whose only observable is a Hamiltonian.
+     * @param max_states Maximum number of term states held simultaneously.
+     * @param apply_operations Indicate whether to apply operations to tape.psi
+     * prior to calculation.
+     */
+    void adjointJacobianTerms(std::span<PrecisionT> jac,
+                              std::span<PrecisionT> term_expvals,
+                              const JacobianData<StateVectorT> &jd,
+                              size_t max_states, bool apply_operations = false) {
+        const auto &obs = jd.getObservables();
+        PL_ABORT_IF_NOT(obs.size() == 1,
+                        "Term-resolved Jacobians require a single Hamiltonian "
+                        "observable.");
+        const auto *ham = dynamic_cast<
+            const Pennylane::Observables::HamiltonianBase<StateVectorT> *>(
+            obs[0].get());
+        PL_ABORT_IF(ham == nullptr, "Term-resolved Jacobians require a single "
+                                    "Hamiltonian observable.");
+        PL_ABORT_IF(max_states == 0, "The state budget must be at least one.");
+
+        const auto &terms = ham->getObs();
+        const size_t num_terms = terms.size();
+        const size_t tp_size = jd.getTrainableParams().size();
+        PL_ABORT_IF_NOT(jac.size() == num_terms * tp_size,
+                        "The size of preallocated jacobian must be same as "
+                        "the number of trainable parameters times the number "
+                        "of Hamiltonian terms.");
+        PL_ABORT_IF_NOT(term_expvals.size() == num_terms,
+                        "The size of preallocated expectation values must be "
+                        "the number of Hamiltonian terms.");
+
+        for (size_t begin = 0; begin < num_terms; begin += max_states) {
+            const size_t end = std::min(begin + max_states, num_terms);
+            const std::vector<std::shared_ptr<Observable<StateVectorT>>>
+                batch(terms.begin() + begin, terms.begin() + end);
+            const JacobianData<StateVectorT> batch_jd{jd.getNumParams(),
+                                                      jd.getSizeStateVec(),
+                                                      jd.getPtrStateVec(),
+                                                      batch,
+                                                      jd.getOperations(),
+                                                      jd.getTrainableParams()};
+            adjointJacobianImpl(
+                jac.subspan(begin * tp_size, (end - begin) * tp_size),
+                batch_jd, apply_operations,
+                term_expvals.subspan(begin, end - begin));
+        }
+    }
 };
 } // namespace Pennylane::LightningQubit::Algorithms
\ No newline at end of file
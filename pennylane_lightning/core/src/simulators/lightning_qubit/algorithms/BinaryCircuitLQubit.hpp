@@ -0,0 +1,215 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Execution of binary circuits on Lightning-Qubit state vectors.
+ */
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "BinaryCircuit.hpp"
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "GateOperation.hpp"
+#include "JacobianData.hpp"
+#include "Observables.hpp"
+#include "ObservablesLQubit.hpp"
+
+/// @cond DEV
+namespace {
+using Pennylane::Algorithms::OpsData;
+using Pennylane::Gates::GateOperation;
+using Pennylane::LightningQubit::DynamicDispatcher;
+using Pennylane::Observables::Observable;
+using Pennylane::Util::BinaryCircuitView;
+} // namespace
+/// @endcond
+
+namespace Pennylane::LightningQubit::Algorithms {
+/**
+ * @brief Binary circuit ready to be applied to state vectors.
+ *
+ * The names of the circuit are resolved to gate operations once, when the
+ * circuit is loaded. Applying the circuit then reads the operations in place
+ * from the buffer and only reuses a few scratch vectors, so no memory is
+ * allocated per operation. Operations without a gate kernel are applied from
+ * their matrix.
+ *
+ * @tparam StateVectorT State vector type.
+ */
+template <class StateVectorT> class BinaryCircuit {
+  private:
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using ObsPtrT = std::shared_ptr<Observable<StateVectorT>>;
+
+    BinaryCircuitView view_;
+    std::vector<std::optional<GateOperation>> gate_ops_; // one per name
+
+    template <class T>
+    static auto toVector(std::span<const T> values) -> std::vector<size_t> {
+        return {values.begin(), values.end()};
+    }
+
+    static auto toMatrix(std::span<const std::complex<double>> matrix)
+        -> std::vector<ComplexT> {
+        return {matrix.begin(), matrix.end()};
+    }
+
+    [[nodiscard]] auto createFactor(size_t item) const -> ObsPtrT {
+        auto wires = toVector(view_.itemWires(item));
+        const auto matrix = view_.itemMatrix(item);
+        if (!matrix.empty()) {
+            return std::make_shared<Observables::HermitianObs<StateVectorT>>(
+                toMatrix(matrix), std::move(wires));
+        }
+        return std::make_shared<Observables::NamedObs<StateVectorT>>(
+            std::string{view_.itemName(item)}, std::move(wires));
+    }
+
+  public:
+    /**
+     * @brief Load a binary circuit.
+     *
+     * @param buffer Binary circuit, which must outlive this object.
+     */
+    explicit BinaryCircuit(std::span<const std::byte> buffer)
+        : view_{buffer} {
+        const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+        gate_ops_.reserve(view_.numNames());
+        for (size_t idx = 0; idx < view_.numNames(); idx++) {
+            const std::string name{view_.getName(idx)};
+            if (dispatcher.hasGateOp(name)) {
+                gate_ops_.emplace_back(dispatcher.strToGateOp(name));
+            } else {
+                gate_ops_.emplace_back(std::nullopt);
+            }
+        }
+        for (size_t op = 0; op < view_.numOperations(); op++) {
+            PL_ABORT_IF(!gate_ops_[view_.itemNameIndex(op)] &&
+                            view_.itemMatrix(op).empty() &&
+                            view_.itemName(op) != "GroverOperator",
+                        "An operation of the binary circuit has neither a "
+                        "gate kernel nor a matrix.");
+        }
+    }
+
+    [[nodiscard]] auto getView() const -> const BinaryCircuitView & {
+        return view_;
+    }
+
+    /**
+     * @brief Apply the operations of the circuit to a state vector.
+     */
+    void applyTo(StateVectorT &sv) const {
+        PL_ABORT_IF_NOT(sv.getNumQubits() == view_.getNumQubits(),
+                        "The circuit and the state vector have different "
+                        "numbers of qubits.");
+        std::vector<size_t> wires;
+        std::vector<PrecisionT> params;
+        std::vector<ComplexT> matrix;
+        for (size_t op = 0; op < view_.numOperations(); op++) {
+            const auto op_wires = view_.itemWires(op);
+            const auto op_params = view_.opParams(op);
+            wires.assign(op_wires.begin(), op_wires.end());
+            params.assign(op_params.begin(), op_params.end());
+            const bool inverse = view_.isInverse(op);
+
+            if (const auto &gate_op = gate_ops_[view_.itemNameIndex(op)]) {
+                sv.applyOperation(*gate_op, wires, inverse, params);
+                continue;
+            }
+            const auto op_matrix = view_.itemMatrix(op);
+            if (op_matrix.empty()) {
+                sv.applyGroverOperator(wires);
+            } else if constexpr (std::is_same_v<ComplexT,
+                                                std::complex<double>>) {
+                sv.applyMatrix(op_matrix.data(), wires, inverse);
+            } else {
+                matrix.assign(op_matrix.begin(), op_matrix.end());
+                sv.applyMatrix(matrix.data(), wires, inverse);
+            }
+        }
+    }
+
+    /**
+     * @brief Create the observables of the circuit.
+     */
+    [[nodiscard]] auto createObservables() const -> std::vector<ObsPtrT> {
+        std::vector<ObsPtrT> observables;
+        for (size_t obs = 0; obs < view_.numObservables(); obs++) {
+            const auto [term_begin, term_end] = view_.observableTerms(obs);
+            std::vector<PrecisionT> coeffs;
+            std::vector<ObsPtrT> terms;
+            for (size_t term = term_begin; term < term_end; term++) {
+                const auto [factor_begin, factor_end] = view_.termFactors(term);
+                std::vector<ObsPtrT> factors;
+                for (size_t f = factor_begin; f < factor_end; f++) {
+                    factors.push_back(createFactor(f));
+                }
+                coeffs.push_back(
+                    static_cast<PrecisionT>(view_.termCoeff(term)));
+                terms.push_back(
+                    (factors.size() == 1)
+                        ? factors[0]
+                        : Observables::TensorProdObs<StateVectorT>::create(
+                              std::move(factors)));
+            }
+            if (terms.size() == 1 && coeffs[0] == PrecisionT{1.0}) {
+                observables.push_back(terms[0]);
+            } else {
+                observables.push_back(
+                    std::make_shared<Observables::Hamiltonian<StateVectorT>>(
+                        std::move(coeffs), std::move(terms)));
+            }
+        }
+        return observables;
+    }
+
+    /**
+     * @brief Copy the operations of the circuit, e.g. to differentiate them.
+     */
+    [[nodiscard]] auto toOpsData() const -> OpsData<StateVectorT> {
+        const size_t num_ops = view_.numOperations();
+        std::vector<std::string> names;
+        std::vector<std::vector<PrecisionT>> params;
+        std::vector<std::vector<size_t>> wires;
+        std::vector<bool> inverses;
+        std::vector<std::vector<ComplexT>> matrices;
+        names.reserve(num_ops);
+        params.reserve(num_ops);
+        wires.reserve(num_ops);
+        inverses.reserve(num_ops);
+        matrices.reserve(num_ops);
+        for (size_t op = 0; op < num_ops; op++) {
+            const auto op_params = view_.opParams(op);
+            names.emplace_back(view_.itemName(op));
+            params.emplace_back(op_params.begin(), op_params.end());
+            wires.push_back(toVector(view_.itemWires(op)));
+            inverses.push_back(view_.isInverse(op));
+            matrices.push_back(toMatrix(view_.itemMatrix(op)));
+        }
+        return {std::move(names), params, std::move(wires),
+                std::move(inverses), std::move(matrices)};
+    }
+};
+} // namespace Pennylane::LightningQubit::Algorithms
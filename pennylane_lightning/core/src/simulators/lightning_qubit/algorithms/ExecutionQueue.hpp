@@ -0,0 +1,144 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Asynchronous execution of circuit workloads on a background thread.
+ */
+#pragma once
+
+#include <future>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "AdjointJacobianLQubit.hpp"
+#include "JacobianData.hpp"
+#include "JobQueue.hpp"
+#include "MeasurementsLQubit.hpp"
+#include "Observables.hpp"
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::Algorithms;
+using Pennylane::LightningQubit::Measures::Measurements;
+using Pennylane::Observables::Observable;
+using Pennylane::Util::JobQueue;
+} // namespace
+/// @endcond
+
+namespace Pennylane::LightningQubit::Algorithms {
+/**
+ * @brief Queue of circuit workloads executed on a background thread.
+ *
+ * Each call enqueues a job and returns immediately with a `std::future`.
+ * Jobs run in submission order, so a sequence of calls on the same
+ * statevector behaves as if executed synchronously. The caller must keep the
+ * statevector alive, and must not modify it from another thread, until the
+ * returned future is ready. Operations and observables are copied into the
+ * job.
+ *
+ * @tparam StateVectorT State vector type.
+ */
+template <class StateVectorT> class ExecutionQueue {
+  private:
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ObsPtrT = std::shared_ptr<Observable<StateVectorT>>;
+
+    JobQueue queue_;
+
+  public:
+    /**
+     * @brief Apply a sequence of operations to the statevector.
+     *
+     * @param sv Statevector to update.
+     * @param ops Operations to apply.
+     */
+    auto applyOperations(StateVectorT &sv, OpsData<StateVectorT> ops)
+        -> std::future<void> {
+        return queue_.submit([&sv, ops = std::move(ops)]() {
+            for (size_t op_idx = 0; op_idx < ops.getSize(); op_idx++) {
+                sv.applyOperation(ops.getOpsName()[op_idx],
+                                  ops.getOpsWires()[op_idx],
+                                  ops.getOpsInverses()[op_idx],
+                                  ops.getOpsParams()[op_idx],
+                                  ops.getOpsMatrices()[op_idx]);
+            }
+        });
+    }
+
+    /**
+     * @brief Compute the expectation value of each observable.
+     *
+     * @param sv Statevector to measure.
+     * @param observables Observables to measure.
+     * @return Future to a vector with one expectation value per observable.
+     */
+    auto expval(const StateVectorT &sv, std::vector<ObsPtrT> observables)
+        -> std::future<std::vector<PrecisionT>> {
+        return queue_.submit([&sv, observables = std::move(observables)]() {
+            Measurements<StateVectorT> measure{sv};
+            std::vector<PrecisionT> result(observables.size());
+            for (size_t idx = 0; idx < observables.size(); idx++) {
+                result[idx] = measure.expval(*observables[idx]);
+            }
+            return result;
+        });
+    }
+
+    /**
+     * @brief Compute the Jacobian with the adjoint method.
+     *
+     * @param sv Final statevector of the circuit.
+     * @param observables Observables for which to compute the Jacobian.
+     * @param ops Operations used to prepare the statevector.
+     * @param trainable_params Sorted list of trainable parameter indices.
+     * @return Future to the row-major Jacobian of shape
+     * `(observables.size(), trainable_params.size())`.
+     */
+    auto adjointJacobian(const StateVectorT &sv,
+                         std::vector<ObsPtrT> observables,
+                         OpsData<StateVectorT> ops,
+                         std::vector<size_t> trainable_params)
+        -> std::future<std::vector<PrecisionT>> {
+        return queue_.submit([&sv, observables = std::move(observables),
+                              ops = std::move(ops),
+                              trainable_params =
+                                  std::move(trainable_params)]() {
+            std::vector<PrecisionT> jac(
+                observables.size() * trainable_params.size(), PrecisionT{0.0});
+            const JacobianData<StateVectorT> jd{ops.getTotalNumParams(),
+                                                sv.getLength(),
+                                                sv.getData(),
+                                                observables,
+                                                ops,
+                                                trainable_params};
+            AdjointJacobian<StateVectorT> adj;
+            adj.adjointJacobian(std::span{jac}, jd, sv);
+            return jac;
+        });
+    }
+
+    /**
+     * @brief Block until all submitted jobs have completed.
+     */
+    void synchronize() { queue_.synchronize(); }
+
+    /**
+     * @brief Number of submitted jobs waiting to be started.
+     */
+    [[nodiscard]] auto getNumPendingJobs() -> size_t {
+        return queue_.getNumPending();
+    }
+};
+} // namespace Pennylane::LightningQubit::Algorithms
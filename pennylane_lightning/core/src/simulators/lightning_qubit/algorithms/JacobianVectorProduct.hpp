@@ -0,0 +1,220 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Define forward-mode jvp algorithm for a statevector
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "AdjointJacobianBase.hpp"
+#include "JacobianData.hpp"
+#include "LinearAlgebra.hpp" // innerProdC, scaleAndAdd
+#include "StateVectorLQubitManaged.hpp"
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::Algorithms;
+using Pennylane::LightningQubit::Util::innerProdC;
+using Pennylane::LightningQubit::Util::scaleAndAdd;
+} // namespace
+/// @endcond
+
+namespace Pennylane::LightningQubit::Algorithms {
+/**
+ * @brief Jacobian Vector Product (JVP) functor.
+ *
+ * Forward-mode differentiation: a tangent statevector
+ * :math:`\sum_j t_j \partial_{\theta_j} \psi` is propagated alongside the
+ * primal statevector while the operations are applied, so the directional
+ * derivative of every output is obtained from one pass over the tape,
+ * independently of the number of outputs.
+ *
+ * The JacobianData passed to each method holds the input state of the tape;
+ * its operations are always applied.
+ *
+ * @tparam StateVectorT State vector type.
+ */
+template <class StateVectorT>
+class JacobianVectorProduct final
+    : public AdjointJacobianBase<StateVectorT,
+                                 JacobianVectorProduct<StateVectorT>> {
+  private:
+    using ComplexT = typename StateVectorT::ComplexT;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using StateVectorManagedT = StateVectorLQubitManaged<PrecisionT>;
+
+    /**
+     * @brief Apply the tape to the primal and tangent statevectors.
+     *
+     * @param jd Jacobian data.
+     * @param tangent Tangent vector, one entry per trainable parameter.
+     * @return Pair of the final primal and tangent statevectors.
+     */
+    auto propagate(const JacobianData<StateVectorT> &jd,
+                   std::span<const PrecisionT> tangent)
+        -> std::pair<StateVectorManagedT, StateVectorManagedT> {
+        const OpsData<StateVectorT> &ops = jd.getOperations();
+        const std::vector<std::string> &ops_name = ops.getOpsName();
+        const auto &trainable_params = jd.getTrainableParams();
+
+        PL_ABORT_IF_NOT(tangent.size() == trainable_params.size(),
+                        "The size of the tangent vector must be the number "
+                        "of trainable parameters.");
+
+        StateVectorManagedT psi(jd.getPtrStateVec(), jd.getSizeStateVec());
+        StateVectorManagedT dpsi(psi.getNumQubits());
+        dpsi.getDataVector()[0] = ComplexT{0.0, 0.0};
+        StateVectorManagedT gen_psi(psi.getNumQubits());
+
+        auto tp_it = trainable_params.begin();
+        size_t current_param_idx = 0;
+        size_t trainable_param_idx = 0;
+
+        for (size_t op_idx = 0; op_idx < ops_name.size(); op_idx++) {
+            PL_ABORT_IF(ops.getOpsParams()[op_idx].size() > 1,
+                        "The operation is not supported using the forward "
+                        "differentiation method");
+            if ((ops_name[op_idx] == "QubitStateVector") ||
+                (ops_name[op_idx] == "StatePrep") ||
+                (ops_name[op_idx] == "BasisState")) {
+                continue; // ignore them
+            }
+
+            const bool is_trainable = ops.hasParams(op_idx) &&
+                                      tp_it != trainable_params.end() &&
+                                      current_param_idx == *tp_it;
+            const bool inverse = ops.getOpsInverses()[op_idx];
+
+            psi.applyOperation(ops_name[op_idx], ops.getOpsWires()[op_idx],
+                               inverse, ops.getOpsParams()[op_idx],
+                               ops.getOpsMatrices()[op_idx]);
+            if (trainable_param_idx > 0) {
+                dpsi.applyOperation(
+                    ops_name[op_idx], ops.getOpsWires()[op_idx], inverse,
+                    ops.getOpsParams()[op_idx], ops.getOpsMatrices()[op_idx]);
+            }
+
+            if (is_trainable) {
+                // d/dθ U(θ)|ψ> = i s G U(θ)|ψ>
+                gen_psi.updateData(psi.getDataVector());
+                const PrecisionT scalingFactor =
+                    gen_psi.applyGenerator(ops_name[op_idx],
+                                           ops.getOpsWires()[op_idx],
+                                           !inverse) *
+                    (inverse ? -1 : 1);
+                scaleAndAdd(dpsi.getLength(),
+                            ComplexT{0.0, scalingFactor *
+                                              tangent[trainable_param_idx]},
+                            gen_psi.getData(), dpsi.getData());
+                ++trainable_param_idx;
+                ++tp_it;
+            }
+            if (ops.hasParams(op_idx)) {
+                ++current_param_idx;
+            }
+        }
+        return {std::move(psi), std::move(dpsi)};
+    }
+
+  public:
+    /**
+     * @brief Compute the Jacobian vector product of the final statevector.
+     *
+     * @rst
+     * Returns :math:`\sum_j t_j \partial_{\theta_j} \psi_{\pmb{\theta}}`.
+     * @endrst
+     *
+     * @param jvp Preallocated vector of size 2^n receiving the tangent
+     * statevector.
+     * @param jd Jacobian data.
+     * @param tangent Tangent vector, one entry per trainable parameter.
+     */
+    void operator()(std::span<ComplexT> jvp,
+                    const JacobianData<StateVectorT> &jd,
+                    std::span<const PrecisionT> tangent) {
+        PL_ABORT_IF_NOT(jvp.size() == jd.getSizeStateVec(),
+                        "The size of preallocated jvp must be the size of "
+                        "the statevector.");
+        const auto [psi, dpsi] = propagate(jd, tangent);
+        std::copy(dpsi.getData(), dpsi.getData() + dpsi.getLength(),
+                  jvp.begin());
+    }
+
+    /**
+     * @brief Compute the Jacobian vector product of the computational basis
+     * probabilities.
+     *
+     * @rst
+     * Returns :math:`2 \mathrm{Re}(\psi_i^* \dot{\psi}_i)` for every basis
+     * state :math:`i`.
+     * @endrst
+     *
+     * @param jvp Preallocated vector of size 2^n.
+     * @param jd Jacobian data.
+     * @param tangent Tangent vector, one entry per trainable parameter.
+     */
+    void probs(std::span<PrecisionT> jvp, const JacobianData<StateVectorT> &jd,
+               std::span<const PrecisionT> tangent) {
+        PL_ABORT_IF_NOT(jvp.size() == jd.getSizeStateVec(),
+                        "The size of preallocated jvp must be the size of "
+                        "the statevector.");
+        const auto [psi, dpsi] = propagate(jd, tangent);
+        const ComplexT *psi_data = psi.getData();
+        const ComplexT *dpsi_data = dpsi.getData();
+        for (size_t i = 0; i < jvp.size(); i++) {
+            jvp[i] = 2 * std::real(std::conj(psi_data[i]) * dpsi_data[i]);
+        }
+    }
+
+    /**
+     * @brief Compute the Jacobian vector product of the expectation values of
+     * the observables in `jd`.
+     *
+     * @rst
+     * Returns :math:`2 \mathrm{Re}\langle \psi | O_k | \dot{\psi} \rangle`
+     * for every observable :math:`O_k`. Observables are applied one after
+     * another to a single scratch statevector.
+     * @endrst
+     *
+     * @param jvp Preallocated vector with one entry per observable.
+     * @param jd Jacobian data.
+     * @param tangent Tangent vector, one entry per trainable parameter.
+     */
+    void expval(std::span<PrecisionT> jvp, const JacobianData<StateVectorT> &jd,
+                std::span<const PrecisionT> tangent) {
+        const auto &obs = jd.getObservables();
+        PL_ABORT_IF_NOT(jvp.size() == obs.size(),
+                        "The size of preallocated jvp must be the number of "
+                        "observables.");
+        const auto [psi, dpsi] = propagate(jd, tangent);
+
+        std::vector<ComplexT> obs_data(psi.getData(),
+                                       psi.getData() + psi.getLength());
+        StateVectorT obs_psi(obs_data.data(), obs_data.size());
+        for (size_t obs_idx = 0; obs_idx < obs.size(); obs_idx++) {
+            obs_psi.updateData(psi.getData(), psi.getLength());
+            obs[obs_idx]->applyInPlace(obs_psi);
+            jvp[obs_idx] =
+                2 * std::real(innerProdC(obs_psi.getData(), dpsi.getData(),
+                                         dpsi.getLength()));
+        }
+    }
+};
+} // namespace Pennylane::LightningQubit::Algorithms
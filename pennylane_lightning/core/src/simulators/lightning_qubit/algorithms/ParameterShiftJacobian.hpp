@@ -0,0 +1,370 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Parameter-shift and finite-difference Jacobians reusing prefix states.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <memory>
+#include <numbers>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "AdjointJacobianBase.hpp"
+#include "Error.hpp"
+#include "JacobianData.hpp"
+#include "LinearAlgebra.hpp" // innerProdC
+#include "MeasurementsLQubit.hpp"
+#include "StateVectorLQubitManaged.hpp"
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::Algorithms;
+using namespace Pennylane::Util::MemoryStorageLocation;
+using Pennylane::LightningQubit::Measures::Measurements;
+using Pennylane::LightningQubit::Util::innerProdC;
+using Pennylane::Observables::Observable;
+using Pennylane::Observables::ProjectorObsBase;
+} // namespace
+/// @endcond
+
+namespace Pennylane::LightningQubit::Algorithms {
+/**
+ * @brief Jacobian of expectation values by shifted circuit evaluations.
+ *
+ * The tape is walked forward once from the input state. The state right
+ * before each trainable gate is kept as a snapshot, and every shifted
+ * evaluation only re-applies the shifted gate and the remaining suffix of the
+ * tape. For `P` trainable parameters in a depth-`L` tape, this replaces the
+ * `O(P L)` gate applications of independent shifted tapes by `O(L)` plus the
+ * suffixes.
+ *
+ * At most `max_snapshots` prefix states are held at once. Each one is paired
+ * with a branch state and a scratch state the observables are applied to, so
+ * memory is bounded by `3 * max_snapshots + 1` statevectors. Observables whose
+ * `applyInPlace` allocates its own temporaries (e.g. Hamiltonians) add those
+ * on top, once per snapshot evaluated concurrently. Snapshots of one batch are
+ * evaluated in parallel with OpenMP.
+ *
+ * @tparam StateVectorT State vector type.
+ */
+template <class StateVectorT> class ParameterShiftJacobian {
+  private:
+    using ComplexT = typename StateVectorT::ComplexT;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using SnapshotT = StateVectorLQubitManaged<PrecisionT>;
+
+    /// Gates with two distinct generator eigenvalues separated by one.
+    static constexpr std::array<std::string_view, 9> two_term_gates{
+        "RX",     "RY",      "RZ",      "PhaseShift",          "IsingXX",
+        "IsingYY", "IsingZZ", "MultiRZ", "ControlledPhaseShift"};
+
+    /**
+     * @brief Shifted evaluations of a single parameter.
+     *
+     * The derivative is `base_coeff * f(theta) + sum_i coeffs[i] *
+     * f(theta + shifts[i])`.
+     */
+    struct ShiftRule {
+        std::vector<PrecisionT> shifts;
+        std::vector<PrecisionT> coeffs;
+        PrecisionT base_coeff;
+    };
+
+    /**
+     * @brief Allocate statevectors of type StateVectorT.
+     *
+     * @param num_states Number of statevectors.
+     * @param num_qubits Number of qubits of each statevector.
+     * @param storage Backing storage used when StateVectorT does not own its
+     * data.
+     */
+    static auto createStates(size_t num_states, size_t num_qubits,
+                             std::vector<std::vector<ComplexT>> &storage)
+        -> std::vector<StateVectorT> {
+        std::vector<StateVectorT> states;
+        states.reserve(num_states);
+        if constexpr (std::is_same_v<typename StateVectorT::MemoryStorageT,
+                                     MemoryStorageLocation::Internal>) {
+            for (size_t ind = 0; ind < num_states; ind++) {
+                states.emplace_back(num_qubits);
+            }
+        } else if constexpr (std::is_same_v<
+                                 typename StateVectorT::MemoryStorageT,
+                                 MemoryStorageLocation::External>) {
+            storage.assign(num_states,
+                           std::vector<ComplexT>(size_t{1U} << num_qubits));
+            for (auto &data : storage) {
+                states.emplace_back(data.data(), data.size());
+            }
+        } else {
+            /// LCOV_EXCL_START
+            PL_ABORT("Undefined memory storage location for StateVectorT.");
+            /// LCOV_EXCL_STOP
+        }
+        return states;
+    }
+
+    /**
+     * @brief Apply operations `[first, ops.getSize())` to a statevector.
+     */
+    template <class OtherStateVectorT>
+    static void applySuffix(OtherStateVectorT &sv,
+                            const OpsData<StateVectorT> &ops, size_t first) {
+        for (size_t op_idx = first; op_idx < ops.getSize(); op_idx++) {
+            if (isStatePrep(ops.getOpsName()[op_idx])) {
+                continue;
+            }
+            sv.applyOperation(ops.getOpsName()[op_idx],
+                              ops.getOpsWires()[op_idx],
+                              ops.getOpsInverses()[op_idx],
+                              ops.getOpsParams()[op_idx],
+                              ops.getOpsMatrices()[op_idx]);
+        }
+    }
+
+    static auto isStatePrep(const std::string &name) -> bool {
+        return name == "QubitStateVector" || name == "StatePrep" ||
+               name == "BasisState";
+    }
+
+    /**
+     * @brief Expectation value of an observable, applying it to a scratch
+     * statevector instead of a fresh copy of the state. Projectors are
+     * evaluated without applying them.
+     *
+     * @param ob Observable.
+     * @param sv Statevector.
+     * @param scratch Scratch statevector of the same size as `sv`.
+     */
+    static auto expval(const Observable<StateVectorT> &ob,
+                       const StateVectorT &sv, StateVectorT &scratch)
+        -> PrecisionT {
+        if (dynamic_cast<const ProjectorObsBase<StateVectorT> *>(&ob)) {
+            return Measurements<StateVectorT>{sv}.expval(ob);
+        }
+        scratch.updateData(sv.getData(), sv.getLength());
+        ob.applyInPlace(scratch);
+        return std::real(
+            innerProdC(scratch.getData(), sv.getData(), sv.getLength()));
+    }
+
+    /**
+     * @brief Accumulate the shifted evaluations of one trainable gate.
+     *
+     * @param jac Row-major (observables, trainable parameters) Jacobian.
+     * @param snapshot State right before the trainable gate.
+     * @param branch Scratch statevector the shifted suffix is applied to.
+     * @param scratch Scratch statevector the observables are applied to.
+     * @param jd Jacobian data.
+     * @param rule Shift rule.
+     * @param op_idx Index of the trainable gate.
+     * @param tp_idx Index of the trainable parameter.
+     */
+    static void evaluateShifts(std::span<PrecisionT> jac,
+                               const SnapshotT &snapshot, StateVectorT &branch,
+                               StateVectorT &scratch,
+                               const JacobianData<StateVectorT> &jd,
+                               const ShiftRule &rule, size_t op_idx,
+                               size_t tp_idx) {
+        const auto &ops = jd.getOperations();
+        const auto &obs = jd.getObservables();
+        const size_t tp_size = jd.getTrainableParams().size();
+        const PrecisionT theta = ops.getOpsParams()[op_idx][0];
+
+        for (size_t term = 0; term < rule.shifts.size(); term++) {
+            branch.updateData(snapshot.getData(), snapshot.getLength());
+            branch.applyOperation(ops.getOpsName()[op_idx],
+                                  ops.getOpsWires()[op_idx],
+                                  ops.getOpsInverses()[op_idx],
+                                  {theta + rule.shifts[term]},
+                                  ops.getOpsMatrices()[op_idx]);
+            applySuffix(branch, ops, op_idx + 1);
+
+            for (size_t obs_idx = 0; obs_idx < obs.size(); obs_idx++) {
+                jac[obs_idx * tp_size + tp_idx] +=
+                    rule.coeffs[term] * expval(*obs[obs_idx], branch, scratch);
+            }
+        }
+    }
+
+    /**
+     * @brief Evaluate the shifted branches of a batch of snapshots.
+     */
+    static void evaluateBatch(std::span<PrecisionT> jac,
+                              const std::vector<SnapshotT> &snapshots,
+                              std::vector<StateVectorT> &branches,
+                              std::vector<StateVectorT> &scratches,
+                              const std::vector<std::pair<size_t, size_t>> &batch,
+                              const JacobianData<StateVectorT> &jd,
+                              const ShiftRule &rule) {
+        std::exception_ptr ex = nullptr;
+        size_t num_batch = batch.size();
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none)                             \
+                shared(jac, snapshots, branches, scratches, batch, jd, rule,   \
+                       ex, num_batch)
+        #endif
+        for (size_t b_idx = 0; b_idx < num_batch; b_idx++) {
+            try {
+                evaluateShifts(jac, snapshots[b_idx], branches[b_idx],
+                               scratches[b_idx], jd, rule, batch[b_idx].first,
+                               batch[b_idx].second);
+            } catch (...) {
+                #if defined(_OPENMP)
+                    #pragma omp critical
+                #endif
+                ex = std::current_exception();
+            }
+        }
+        // clang-format on
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
+    }
+
+    void computeJacobian(std::span<PrecisionT> jac,
+                         const JacobianData<StateVectorT> &jd,
+                         const ShiftRule &rule, size_t max_snapshots,
+                         bool two_term_only) {
+        const auto &ops = jd.getOperations();
+        const auto &obs = jd.getObservables();
+        const auto &tp = jd.getTrainableParams();
+        const size_t tp_size = tp.size();
+
+        if (!jd.hasTrainableParams()) {
+            return;
+        }
+        PL_ABORT_IF_NOT(
+            jac.size() == tp_size * obs.size(),
+            "The size of preallocated jacobian must be same as "
+            "the number of trainable parameters times the number of "
+            "observables provided.");
+        PL_ABORT_IF(max_snapshots == 0,
+                    "The snapshot budget must be at least one state.");
+
+        std::fill(jac.begin(), jac.end(), PrecisionT{0.0});
+
+        SnapshotT walker(jd.getPtrStateVec(), jd.getSizeStateVec());
+        const size_t num_qubits = walker.getNumQubits();
+        const size_t batch_size = std::min(max_snapshots, tp_size);
+
+        std::vector<SnapshotT> snapshots(batch_size, SnapshotT{num_qubits});
+        std::vector<std::vector<ComplexT>> branch_storage;
+        auto branches = createStates(batch_size, num_qubits, branch_storage);
+        std::vector<std::vector<ComplexT>> scratch_storage;
+        auto scratches = createStates(batch_size, num_qubits, scratch_storage);
+        std::vector<std::pair<size_t, size_t>> batch; // (op_idx, tp_idx)
+        batch.reserve(batch_size);
+
+        auto tp_it = tp.begin();
+        size_t param_idx = 0;
+        for (size_t op_idx = 0; op_idx < ops.getSize(); op_idx++) {
+            const auto &name = ops.getOpsName()[op_idx];
+            if (isStatePrep(name)) {
+                continue;
+            }
+            if (ops.hasParams(op_idx)) {
+                if (tp_it != tp.end() && *tp_it == param_idx) {
+                    PL_ABORT_IF(ops.getOpsParams()[op_idx].size() > 1,
+                                "The operation is not supported using "
+                                "shifted-tape differentiation");
+                    PL_ABORT_IF(two_term_only &&
+                                    std::find(two_term_gates.begin(),
+                                              two_term_gates.end(),
+                                              name) == two_term_gates.end(),
+                                "The operation " + name +
+                                    " has no two-term parameter-shift rule");
+                    snapshots[batch.size()].updateData(walker.getData(),
+                                                       walker.getLength());
+                    batch.emplace_back(op_idx,
+                                       static_cast<size_t>(tp_it - tp.begin()));
+                    ++tp_it;
+                    if (batch.size() == batch_size) {
+                        evaluateBatch(jac, snapshots, branches, scratches,
+                                      batch, jd, rule);
+                        batch.clear();
+                    }
+                }
+                param_idx++;
+            }
+            if (tp_it == tp.end() && rule.base_coeff == PrecisionT{0.0}) {
+                break; // All shifted branches evaluated
+            }
+            walker.applyOperation(name, ops.getOpsWires()[op_idx],
+                                  ops.getOpsInverses()[op_idx],
+                                  ops.getOpsParams()[op_idx],
+                                  ops.getOpsMatrices()[op_idx]);
+        }
+        if (!batch.empty()) {
+            evaluateBatch(jac, snapshots, branches, scratches, batch, jd,
+                          rule);
+        }
+
+        if (rule.base_coeff != PrecisionT{0.0}) {
+            // The walker holds the unshifted final state.
+            branches[0].updateData(walker.getData(), walker.getLength());
+            for (size_t obs_idx = 0; obs_idx < obs.size(); obs_idx++) {
+                const PrecisionT base =
+                    rule.base_coeff *
+                    expval(*obs[obs_idx], branches[0], scratches[0]);
+                for (size_t tp_idx = 0; tp_idx < tp_size; tp_idx++) {
+                    jac[obs_idx * tp_size + tp_idx] += base;
+                }
+            }
+        }
+    }
+
+  public:
+    /**
+     * @brief Compute the Jacobian with the two-term parameter-shift rule.
+     *
+     * @param jac Preallocated row-major Jacobian of shape (observables,
+     * trainable parameters).
+     * @param jd Jacobian data. The statevector is the input state of the tape.
+     * @param max_snapshots Maximum number of prefix states held at once.
+     */
+    void parameterShift(std::span<PrecisionT> jac,
+                        const JacobianData<StateVectorT> &jd,
+                        size_t max_snapshots = 1) {
+        constexpr auto shift = std::numbers::pi_v<PrecisionT> / 2;
+        const ShiftRule rule{{shift, -shift}, {0.5, -0.5}, 0.0};
+        computeJacobian(jac, jd, rule, max_snapshots, true);
+    }
+
+    /**
+     * @brief Compute the Jacobian with forward finite differences.
+     *
+     * @param jac Preallocated row-major Jacobian of shape (observables,
+     * trainable parameters).
+     * @param jd Jacobian data. The statevector is the input state of the tape.
+     * @param h Step size.
+     * @param max_snapshots Maximum number of prefix states held at once.
+     */
+    void finiteDiff(std::span<PrecisionT> jac,
+                    const JacobianData<StateVectorT> &jd, PrecisionT h,
+                    size_t max_snapshots = 1) {
+        PL_ABORT_IF(h == PrecisionT{0.0}, "The step size must be non-zero.");
+        const ShiftRule rule{{h}, {1 / h}, -1 / h};
+        computeJacobian(jac, jd, rule, max_snapshots, false);
+    }
+};
+} // namespace Pennylane::LightningQubit::Algorithms
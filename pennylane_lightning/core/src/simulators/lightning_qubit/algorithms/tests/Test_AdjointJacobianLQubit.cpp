@@ -13,23 +13,33 @@
 // limitations under the License.
 #include <algorithm>
 #include <limits>
+#include <thread>
 #include <vector>
 
 #include <catch2/catch.hpp>
 
 #include "AdjointJacobianLQubit.hpp"
+#include "MeasurementsLQubit.hpp"
 #include "ObservablesLQubit.hpp"
 #include "StateVectorLQubitManaged.hpp"
 #include "StateVectorLQubitRaw.hpp"
 #include "TestHelpers.hpp" // randomIntVector
+#include "Threading.hpp"   // numSegments, partitionThreads
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 
 // using namespace Pennylane;
 /// @cond DEV
 namespace {
 // using namespace Pennylane;
 using namespace Pennylane::LightningQubit::Algorithms;
+using namespace Pennylane::LightningQubit::Measures;
 using namespace Pennylane::LightningQubit::Observables;
 
+using Pennylane::LightningQubit::Util::numSegments;
+using Pennylane::LightningQubit::Util::partitionThreads;
 using Pennylane::Util::randomIntVector;
 // using namespace Pennylane::Simulators;
 } // namespace
@@ -99,4 +109,467 @@ TEMPLATE_PRODUCT_TEST_CASE(
     PrecisionT eps = std::numeric_limits<PrecisionT>::epsilon() * 1e4;
     REQUIRE(isApproxEqual(sv1.getData(), sv1.getLength(), sv2.getData(),
                           sv2.getLength(), eps));
-}
\ No newline at end of file
+}
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "Algorithms::adjointJacobian with constant circuit segments",
+    "[Algorithms]", (StateVectorLQubitManaged, StateVectorLQubitRaw),
+    (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    const size_t num_qubits = 3;
+    const std::vector<PrecisionT> param{0.3, -0.8, 1.2, 0.45, -0.25};
+
+    auto obs0 = std::make_shared<NamedObs<StateVectorT>>(
+        "PauliZ", std::vector<size_t>{0});
+    auto obs1 = TensorProdObs<StateVectorT>::create(
+        {std::make_shared<NamedObs<StateVectorT>>("PauliX",
+                                                  std::vector<size_t>{1}),
+         std::make_shared<NamedObs<StateVectorT>>("PauliY",
+                                                  std::vector<size_t>{2})});
+    const std::vector<std::shared_ptr<Observable<StateVectorT>>> obs{obs0,
+                                                                     obs1};
+
+    // Constant segments mix fusable gates on up to two wires, a three-wire
+    // gate and parametric gates which are not trainable.
+    const auto ops = OpsData<StateVectorT>(
+        {"Hadamard", "RX", "CNOT", "S", "RY", "Toffoli", "Hadamard", "CZ",
+         "RZ", "T", "SWAP", "IsingXX", "PauliY", "CRX"},
+        {{},
+         {param[0]},
+         {},
+         {},
+         {param[1]},
+         {},
+         {},
+         {},
+         {param[2]},
+         {},
+         {},
+         {param[3]},
+         {},
+         {param[4]}},
+        {{0},
+         {0},
+         {0, 1},
+         {1},
+         {1},
+         {0, 1, 2},
+         {2},
+         {1, 2},
+         {2},
+         {2},
+         {0, 2},
+         {0, 1},
+         {1},
+         {2, 0}},
+        {false, false, false, true, false, false, false, false, true, false,
+         false, false, false, false});
+
+    std::vector<ComplexT> cdata(1U << num_qubits);
+    cdata[0] = ComplexT{1, 0};
+    StateVectorT psi(cdata.data(), cdata.size());
+
+    // Reference Jacobian from central finite differences of the circuit,
+    // applied gate by gate in double precision.
+    using RefStateVectorT = StateVectorLQubitManaged<double>;
+    auto ref_obs0 = std::make_shared<NamedObs<RefStateVectorT>>(
+        "PauliZ", std::vector<size_t>{0});
+    auto ref_obs1 = TensorProdObs<RefStateVectorT>::create(
+        {std::make_shared<NamedObs<RefStateVectorT>>("PauliX",
+                                                     std::vector<size_t>{1}),
+         std::make_shared<NamedObs<RefStateVectorT>>(
+             "PauliY", std::vector<size_t>{2})});
+    const auto ref_expvals = [&](const std::vector<double> &p) {
+        RefStateVectorT sv(num_qubits);
+        size_t p_idx = 0;
+        for (size_t i = 0; i < ops.getSize(); i++) {
+            std::vector<double> op_params;
+            if (!ops.getOpsParams()[i].empty()) {
+                op_params.push_back(p[p_idx++]);
+            }
+            sv.applyOperation(ops.getOpsName()[i], ops.getOpsWires()[i],
+                              ops.getOpsInverses()[i], op_params);
+        }
+        Measurements<RefStateVectorT> measure(sv);
+        return std::vector<double>{measure.expval(*ref_obs0),
+                                   measure.expval(*ref_obs1)};
+    };
+
+    const size_t num_params = param.size();
+    const double h = 1e-4;
+    std::vector<double> expected(obs.size() * num_params, 0.0);
+    for (size_t k = 0; k < num_params; k++) {
+        std::vector<double> p_plus(param.begin(), param.end());
+        std::vector<double> p_minus(param.begin(), param.end());
+        p_plus[k] += h;
+        p_minus[k] -= h;
+        const auto f_plus = ref_expvals(p_plus);
+        const auto f_minus = ref_expvals(p_minus);
+        for (size_t o = 0; o < obs.size(); o++) {
+            expected[o * num_params + k] = (f_plus[o] - f_minus[o]) / (2 * h);
+        }
+    }
+
+    AdjointJacobian<StateVectorT> adj;
+    for (const auto &tp :
+         {std::vector<size_t>{0, 1, 2, 3, 4}, std::vector<size_t>{1, 3},
+          std::vector<size_t>{0}, std::vector<size_t>{4},
+          std::vector<size_t>{0, 2, 4}}) {
+        DYNAMIC_SECTION("Trainable parameters - num_tp = " << tp.size()
+                                                          << ", first = "
+                                                          << tp[0]) {
+            std::vector<PrecisionT> jac(obs.size() * tp.size(), 0.0);
+            const JacobianData<StateVectorT> jd{ops.getTotalNumParams(),
+                                                psi.getLength(),
+                                                psi.getData(),
+                                                obs,
+                                                ops,
+                                                tp};
+            adj.adjointJacobian(std::span{jac}, jd, psi, true);
+            for (size_t o = 0; o < obs.size(); o++) {
+                for (size_t t = 0; t < tp.size(); t++) {
+                    CHECK(jac[o * tp.size() + t] ==
+                          Approx(expected[o * num_params + tp[t]])
+                              .margin(1e-5));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("Algorithms::adjointJacobianTerms", "[Algorithms]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    const size_t num_qubits = 3;
+    const std::vector<PrecisionT> param{0.3, -0.8, 1.2};
+    const std::vector<PrecisionT> coeffs{0.5, -1.5, 0.25};
+
+    const std::vector<std::shared_ptr<Observable<StateVectorT>>> terms{
+        std::make_shared<NamedObs<StateVectorT>>("PauliZ",
+                                                 std::vector<size_t>{0}),
+        TensorProdObs<StateVectorT>::create(
+            {std::make_shared<NamedObs<StateVectorT>>("PauliX",
+                                                      std::vector<size_t>{1}),
+             std::make_shared<NamedObs<StateVectorT>>(
+                 "PauliZ", std::vector<size_t>{2})}),
+        std::make_shared<NamedObs<StateVectorT>>("PauliY",
+                                                 std::vector<size_t>{2})};
+    auto ham = std::make_shared<Hamiltonian<StateVectorT>>(coeffs, terms);
+
+    const auto ops = OpsData<StateVectorT>(
+        {"RX", "CNOT", "RY", "Hadamard", "IsingZZ"},
+        {{param[0]}, {}, {param[1]}, {}, {param[2]}},
+        {{0}, {0, 1}, {1}, {2}, {1, 2}},
+        {false, false, false, false, false});
+
+    std::vector<ComplexT> cdata(1U << num_qubits);
+    cdata[0] = ComplexT{1, 0};
+    StateVectorT psi(cdata.data(), cdata.size());
+
+    const std::vector<size_t> tp{0, 1, 2};
+    AdjointJacobian<StateVectorT> adj;
+
+    std::vector<PrecisionT> expected_terms(terms.size() * tp.size(), 0.0);
+    std::vector<PrecisionT> expected_expvals(terms.size(), 0.0);
+    {
+        const JacobianData<StateVectorT> jd{
+            ops.getTotalNumParams(), psi.getLength(), psi.getData(), terms,
+            ops, tp};
+        adj.adjointJacobian(std::span{expected_terms}, jd, psi, true,
+                            std::span{expected_expvals});
+    }
+    std::vector<PrecisionT> expected_ham(tp.size(), 0.0);
+    {
+        const JacobianData<StateVectorT> jd{
+            ops.getTotalNumParams(), psi.getLength(), psi.getData(), {ham},
+            ops, tp};
+        adj.adjointJacobian(std::span{expected_ham}, jd, psi, true);
+    }
+
+    const JacobianData<StateVectorT> jd{
+        ops.getTotalNumParams(), psi.getLength(), psi.getData(), {ham},
+        ops, tp};
+    for (size_t max_states : {size_t{1}, size_t{2}, size_t{8}}) {
+        DYNAMIC_SECTION("Term-resolved Jacobian - max_states = "
+                        << max_states) {
+            std::vector<PrecisionT> jac(terms.size() * tp.size(), 0.0);
+            std::vector<PrecisionT> expvals(terms.size(), 0.0);
+            adj.adjointJacobianTerms(std::span{jac}, std::span{expvals}, jd,
+                                     max_states, true);
+            CHECK_THAT(jac, Catch::Approx(expected_terms).margin(1e-5));
+            CHECK_THAT(expvals,
+                       Catch::Approx(expected_expvals).margin(1e-5));
+
+            for (size_t t = 0; t < tp.size(); t++) {
+                PrecisionT sum = 0.0;
+                for (size_t k = 0; k < terms.size(); k++) {
+                    sum += coeffs[k] * jac[k * tp.size() + t];
+                }
+                CHECK(sum == Approx(expected_ham[t]).margin(1e-5));
+            }
+        }
+    }
+
+    SECTION("No trainable parameters") {
+        const JacobianData<StateVectorT> jd_no_tp{
+            ops.getTotalNumParams(), psi.getLength(), psi.getData(), {ham},
+            ops, {}};
+        std::vector<PrecisionT> jac;
+        std::vector<PrecisionT> expvals(terms.size(), 0.0);
+        adj.adjointJacobianTerms(std::span{jac}, std::span{expvals}, jd_no_tp,
+                                 2, true);
+        CHECK_THAT(expvals, Catch::Approx(expected_expvals).margin(1e-5));
+        CHECK(adj.getNumSegments(jd_no_tp) == 1);
+    }
+
+    SECTION("Throws for non-Hamiltonian observables") {
+        const JacobianData<StateVectorT> jd_terms{
+            ops.getTotalNumParams(), psi.getLength(), psi.getData(), terms,
+            ops, tp};
+        std::vector<PrecisionT> jac(terms.size() * tp.size(), 0.0);
+        std::vector<PrecisionT> expvals(terms.size(), 0.0);
+        PL_REQUIRE_THROWS_MATCHES(
+            adj.adjointJacobianTerms(std::span{jac}, std::span{expvals},
+                                     jd_terms, 1),
+            LightningException, "require a single Hamiltonian observable");
+    }
+}
+
+TEST_CASE("Algorithms::partitionThreads", "[Algorithms]") {
+    auto check = [](size_t num_states, size_t num_qubits, size_t num_threads,
+                    size_t state_threads, size_t amplitude_threads,
+                    size_t chunk_qubits) {
+        const auto partition =
+            partitionThreads(num_states, num_qubits, num_threads, 14);
+        CHECK(partition.state_threads == state_threads);
+        CHECK(partition.amplitude_threads == amplitude_threads);
+        CHECK(partition.chunk_qubits == chunk_qubits);
+    };
+    // More states than threads: observable-level only
+    check(200, 20, 16, 16, 1, 0);
+    // Few states on many threads: spare threads go to amplitude chunks
+    check(3, 20, 64, 3, 21, 5);
+    check(1, 16, 8, 1, 4, 2);
+    // Small statevectors are not split
+    check(3, 10, 64, 3, 1, 0);
+    check(2, 20, 1, 1, 1, 0);
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("Algorithms::adjointJacobian with amplitude chunks",
+                           "[Algorithms]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    const size_t num_qubits = 16;
+    const std::vector<PrecisionT> param{0.3, -0.8, 1.2, 0.45, -0.25, 0.7};
+
+    auto obs0 = std::make_shared<NamedObs<StateVectorT>>(
+        "PauliZ", std::vector<size_t>{0});
+    auto obs1 = std::make_shared<NamedObs<StateVectorT>>(
+        "PauliX", std::vector<size_t>{15});
+    const std::vector<std::shared_ptr<Observable<StateVectorT>>> obs{obs0,
+                                                                     obs1};
+
+    // Operations on the leading wires cannot be applied chunk by chunk
+    const auto ops = OpsData<StateVectorT>(
+        {"Hadamard", "Hadamard", "RX", "CNOT", "RY", "IsingZZ", "Hadamard",
+         "CRX", "S", "RZ", "CNOT", "RX"},
+        {{},
+         {},
+         {param[0]},
+         {},
+         {param[1]},
+         {param[2]},
+         {},
+         {param[3]},
+         {},
+         {param[4]},
+         {},
+         {param[5]}},
+        {{0},
+         {15},
+         {2},
+         {0, 3},
+         {5},
+         {4, 15},
+         {9},
+         {1, 7},
+         {7},
+         {0},
+         {15, 2},
+         {15}},
+        {false, false, false, false, true, false, false, false, false, false,
+         false, false});
+
+    std::vector<ComplexT> cdata(1U << num_qubits);
+    cdata[0] = ComplexT{1, 0};
+    StateVectorT psi(cdata.data(), cdata.size());
+
+    const std::vector<size_t> tp{0, 1, 2, 3, 4, 5};
+    const JacobianData<StateVectorT> tape{
+        ops.getTotalNumParams(), psi.getLength(), psi.getData(), obs, ops, tp};
+
+    auto jacobian = [&](int num_threads) {
+#if defined(_OPENMP)
+        const int prev_threads = omp_get_max_threads();
+        omp_set_num_threads(num_threads);
+#else
+        static_cast<void>(num_threads);
+#endif
+        std::vector<PrecisionT> jac(obs.size() * tp.size(), 0.0);
+        AdjointJacobian<StateVectorT> adj;
+        adj.adjointJacobian(std::span{jac}, tape, psi, true);
+        const auto partition =
+            AdjointJacobian<StateVectorT>::getThreadPartition(obs.size(),
+                                                              num_qubits);
+#if defined(_OPENMP)
+        omp_set_num_threads(prev_threads);
+#endif
+        return std::make_pair(jac, partition);
+    };
+
+    const auto [serial_jac, serial_partition] = jacobian(1);
+    const auto [chunked_jac, chunked_partition] = jacobian(8);
+
+    CHECK(serial_partition.chunk_qubits == 0);
+#if defined(_OPENMP)
+    CHECK(chunked_partition.state_threads == 3);
+    CHECK(chunked_partition.chunk_qubits == 1);
+#endif
+    for (size_t i = 0; i < serial_jac.size(); i++) {
+        CHECK(chunked_jac[i] == Approx(serial_jac[i]).margin(1e-5));
+    }
+
+    SECTION("Concurrent calls on a shared instance") {
+        AdjointJacobian<StateVectorT> adj;
+        std::vector<std::vector<PrecisionT>> jacs(
+            2, std::vector<PrecisionT>(obs.size() * tp.size(), 0.0));
+        std::vector<std::thread> threads;
+        for (auto &jac : jacs) {
+            threads.emplace_back([&adj, &jac, &tape, &psi] {
+                adj.adjointJacobian(std::span{jac}, tape, psi, true);
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        for (const auto &jac : jacs) {
+            for (size_t i = 0; i < serial_jac.size(); i++) {
+                CHECK(jac[i] == Approx(serial_jac[i]).margin(1e-5));
+            }
+        }
+    }
+}
+
+TEST_CASE("Algorithms::numSegments", "[Algorithms]") {
+    constexpr size_t MiB = size_t{1} << 20U;
+    // Busy threads: sequential backward pass
+    CHECK(numSegments(8, 6, 10, MiB, 1024 * MiB) == 1);
+    CHECK(numSegments(1, 1, 10, MiB, 1024 * MiB) == 1);
+    // A single trainable operation cannot be split
+    CHECK(numSegments(16, 2, 1, MiB, 1024 * MiB) == 1);
+    // Limited by threads, trainable operations and memory
+    CHECK(numSegments(16, 2, 10, MiB, 1024 * MiB) == 10);
+    CHECK(numSegments(8, 2, 10, MiB, 1024 * MiB) == 8);
+    CHECK(numSegments(16, 2, 10, MiB, 3 * MiB) == 4);
+    CHECK(numSegments(16, 2, 10, MiB, 0) == 1);
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("Algorithms::adjointJacobianSegmented",
+                           "[Algorithms]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    const size_t num_qubits = 5;
+    const std::vector<PrecisionT> param{0.3, -0.8, 1.2, 0.45, -0.25, 0.7, 0.1};
+
+    auto obs0 = std::make_shared<NamedObs<StateVectorT>>(
+        "PauliZ", std::vector<size_t>{0});
+    auto obs1 = std::make_shared<NamedObs<StateVectorT>>(
+        "PauliY", std::vector<size_t>{3});
+    auto obs2 = std::make_shared<TensorProdObs<StateVectorT>>(
+        std::make_shared<NamedObs<StateVectorT>>("PauliX",
+                                                 std::vector<size_t>{1}),
+        std::make_shared<NamedObs<StateVectorT>>("PauliZ",
+                                                 std::vector<size_t>{4}));
+    const std::vector<std::shared_ptr<Observable<StateVectorT>>> obs{
+        obs0, obs1, obs2};
+
+    const auto ops = OpsData<StateVectorT>(
+        {"Hadamard", "RX", "CNOT", "RY", "IsingXX", "Hadamard", "CRZ", "S",
+         "RZ", "CNOT", "PhaseShift", "RX", "T"},
+        {{},
+         {param[0]},
+         {},
+         {param[1]},
+         {param[2]},
+         {},
+         {param[3]},
+         {},
+         {param[4]},
+         {},
+         {param[5]},
+         {param[6]},
+         {}},
+        {{0}, {1}, {0, 2}, {3}, {2, 4}, {1}, {4, 0}, {3}, {2}, {1, 3},
+         {0}, {4}, {2}},
+        {false, false, false, true, false, false, false, false, true, false,
+         false, false, false});
+
+    std::vector<ComplexT> cdata(1U << num_qubits);
+    cdata[0] = ComplexT{1, 0};
+    StateVectorT psi(cdata.data(), cdata.size());
+
+    for (const auto &tp : std::vector<std::vector<size_t>>{
+             {0, 1, 2, 3, 4, 5, 6}, {1, 3, 4, 6}, {2, 5}}) {
+        const JacobianData<StateVectorT> tape{ops.getTotalNumParams(),
+                                              psi.getLength(),
+                                              psi.getData(),
+                                              obs,
+                                              ops,
+                                              tp};
+
+        std::vector<PrecisionT> expected(obs.size() * tp.size(), 0.0);
+        AdjointJacobian<StateVectorT> adj;
+        adj.setSegmentMemoryBudget(0);
+        adj.adjointJacobian(std::span{expected}, tape, psi, true);
+        CHECK(adj.getNumSegments(tape) == 1);
+
+        for (const size_t num_segments : {1, 2, 3, 9}) {
+            DYNAMIC_SECTION("tp.size() = " << tp.size() << ", num_segments = "
+                                           << num_segments) {
+                std::vector<PrecisionT> jac(obs.size() * tp.size(), 0.0);
+                adj.adjointJacobianSegmented(std::span{jac}, tape,
+                                             num_segments, true);
+                for (size_t i = 0; i < jac.size(); i++) {
+                    CHECK(jac[i] == Approx(expected[i]).margin(1e-5));
+                }
+            }
+        }
+    }
+
+    SECTION("Throws for zero segments") {
+        std::vector<PrecisionT> jac(obs.size(), 0.0);
+        const JacobianData<StateVectorT> tape{
+            ops.getTotalNumParams(), psi.getLength(), psi.getData(), obs, ops,
+            std::vector<size_t>{0}};
+        AdjointJacobian<StateVectorT> adj;
+        PL_REQUIRE_THROWS_MATCHES(
+            adj.adjointJacobianSegmented(std::span{jac}, tape, 0, true),
+            LightningException,
+            "The number of segments must be at least one.");
+    }
+}
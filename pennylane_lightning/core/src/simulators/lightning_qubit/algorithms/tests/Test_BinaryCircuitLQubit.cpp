@@ -0,0 +1,169 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "AdjointJacobianLQubit.hpp"
+#include "BinaryCircuit.hpp"
+#include "BinaryCircuitLQubit.hpp"
+#include "JacobianData.hpp"
+#include "MeasurementsLQubit.hpp"
+#include "ObservablesLQubit.hpp"
+#include "StateVectorLQubitManaged.hpp"
+#include "StateVectorLQubitRaw.hpp"
+#include "TestHelpers.hpp" // PL_REQUIRE_THROWS_MATCHES
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::Algorithms;
+using namespace Pennylane::Util;
+
+using namespace Pennylane::LightningQubit::Algorithms;
+using namespace Pennylane::LightningQubit::Measures;
+using namespace Pennylane::LightningQubit::Observables;
+
+const std::vector<std::complex<double>> pauli_x{
+    {0.0, 0.0}, {1.0, 0.0}, {1.0, 0.0}, {0.0, 0.0}};
+const std::vector<std::complex<double>> projector0{
+    {1.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}};
+
+auto buildCircuit() -> std::vector<std::byte> {
+    BinaryCircuitBuilder builder{3};
+    builder.addOperation("Hadamard", {0});
+    builder.addOperation("RX", {1}, {0.4});
+    builder.addOperation("CNOT", {0, 2});
+    builder.addOperation("RY", {2}, {-0.7}, true);
+    builder.addOperation("QubitUnitary", {1}, {0.0}, false, pauli_x);
+    builder.addOperation("GroverOperator", {0, 1, 2});
+    builder.addOperation("CRZ", {1, 0}, {1.1});
+    builder.addObservable({1.0}, {{{"PauliZ", {0}}}});
+    builder.addObservable({0.5, -2.0}, {{{"PauliX", {0}}, {"PauliY", {2}}},
+                                        {{"Hermitian", {1}, projector0}}});
+    return builder.build();
+}
+} // namespace
+/// @endcond
+
+TEMPLATE_PRODUCT_TEST_CASE("BinaryCircuit", "[Algorithms]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    const size_t num_qubits = 3;
+    const auto buffer = buildCircuit();
+    const BinaryCircuit<StateVectorT> circuit{buffer};
+
+    std::vector<ComplexT> expected_data(1U << num_qubits);
+    expected_data[0] = ComplexT{1.0, 0.0};
+    StateVectorT expected(expected_data.data(), expected_data.size());
+    expected.applyOperation("Hadamard", {0});
+    expected.applyOperation("RX", {1}, false, {0.4});
+    expected.applyOperation("CNOT", {0, 2});
+    expected.applyOperation("RY", {2}, true, {-0.7});
+    expected.applyOperation("PauliX", {1});
+    expected.applyGroverOperator({0, 1, 2});
+    expected.applyOperation("CRZ", {1, 0}, false, {1.1});
+
+    std::vector<ComplexT> data(1U << num_qubits);
+    data[0] = ComplexT{1.0, 0.0};
+    StateVectorT sv(data.data(), data.size());
+
+    SECTION("Apply operations") {
+        circuit.applyTo(sv);
+        const std::vector<ComplexT> result(sv.getData(),
+                                           sv.getData() + sv.getLength());
+        const std::vector<ComplexT> reference(
+            expected.getData(), expected.getData() + expected.getLength());
+        REQUIRE(result == approx(reference).margin(1e-5));
+    }
+
+    SECTION("Observables") {
+        circuit.applyTo(sv);
+        const auto observables = circuit.createObservables();
+        REQUIRE(observables.size() == 2);
+
+        const auto z0 = std::make_shared<NamedObs<StateVectorT>>(
+            "PauliZ", std::vector<size_t>{0});
+        const auto x0y2 = TensorProdObs<StateVectorT>::create(
+            {std::make_shared<NamedObs<StateVectorT>>("PauliX",
+                                                      std::vector<size_t>{0}),
+             std::make_shared<NamedObs<StateVectorT>>("PauliY",
+                                                      std::vector<size_t>{2})});
+        const auto proj = std::make_shared<HermitianObs<StateVectorT>>(
+            std::vector<ComplexT>{
+                {1.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
+            std::vector<size_t>{1});
+        const auto ham = Hamiltonian<StateVectorT>::create(
+            {PrecisionT{0.5}, PrecisionT{-2.0}}, {x0y2, proj});
+
+        Measurements<StateVectorT> measure{sv};
+        Measurements<StateVectorT> reference{expected};
+        CHECK(*observables[0] == *z0);
+        CHECK(*observables[1] == *ham);
+        CHECK(measure.expval(*observables[0]) ==
+              Approx(reference.expval(*z0)).margin(1e-5));
+        CHECK(measure.expval(*observables[1]) ==
+              Approx(reference.expval(*ham)).margin(1e-5));
+    }
+
+    SECTION("Operations data") {
+        const auto ops = circuit.toOpsData();
+        REQUIRE(ops.getSize() == 7);
+        CHECK(ops.getOpsName()[4] == "QubitUnitary");
+        CHECK(ops.getOpsWires()[6] == std::vector<size_t>{1, 0});
+        CHECK(ops.getOpsInverses()[3]);
+        CHECK(ops.getOpsMatrices()[4].size() == 4);
+        CHECK(ops.getNumParOps() == 4);
+
+        // The adjoint Jacobian uses the operations of the binary circuit
+        circuit.applyTo(sv);
+        const auto observables = circuit.createObservables();
+        const std::vector<size_t> trainable{0, 1, 3};
+        const JacobianData<StateVectorT> jd{ops.getTotalNumParams(),
+                                            sv.getLength(),
+                                            sv.getData(),
+                                            observables,
+                                            ops,
+                                            trainable};
+        std::vector<PrecisionT> jac(observables.size() * trainable.size());
+        AdjointJacobian<StateVectorT> adj;
+        adj.adjointJacobian(std::span{jac}, jd, sv);
+        CHECK(std::any_of(jac.begin(), jac.end(),
+                          [](PrecisionT v) { return std::abs(v) > 1e-3; }));
+    }
+
+    SECTION("Invalid circuits") {
+        std::vector<ComplexT> small_data(2);
+        small_data[0] = ComplexT{1.0, 0.0};
+        StateVectorT small(small_data.data(), small_data.size());
+        PL_REQUIRE_THROWS_MATCHES(circuit.applyTo(small), LightningException,
+                                  "different numbers of qubits");
+
+        BinaryCircuitBuilder builder{1};
+        builder.addOperation("NotAGate", {0});
+        const auto invalid = builder.build();
+        PL_REQUIRE_THROWS_MATCHES(BinaryCircuit<StateVectorT>{invalid},
+                                  LightningException,
+                                  "neither a gate kernel nor a matrix");
+    }
+}
@@ -0,0 +1,109 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "AdjointJacobianLQubit.hpp"
+#include "ExecutionQueue.hpp"
+#include "JacobianData.hpp"
+#include "ObservablesLQubit.hpp"
+#include "StateVectorLQubitManaged.hpp"
+#include "StateVectorLQubitRaw.hpp"
+#include "TestHelpers.hpp" // PL_REQUIRE_THROWS_MATCHES
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::Algorithms;
+using namespace Pennylane::Util;
+
+using namespace Pennylane::LightningQubit::Algorithms;
+using namespace Pennylane::LightningQubit::Observables;
+} // namespace
+/// @endcond
+
+TEMPLATE_PRODUCT_TEST_CASE("ExecutionQueue", "[Algorithms]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    const size_t num_qubits = 3;
+    const std::vector<PrecisionT> param{-0.45, 0.2, 1.3};
+    const std::vector<size_t> tp{0, 1, 2};
+
+    auto obs0 = std::make_shared<NamedObs<StateVectorT>>(
+        "PauliZ", std::vector<size_t>{0});
+    auto obs1 = std::make_shared<NamedObs<StateVectorT>>(
+        "PauliZ", std::vector<size_t>{1});
+    auto obs2 = std::make_shared<NamedObs<StateVectorT>>(
+        "PauliZ", std::vector<size_t>{2});
+    const std::vector<std::shared_ptr<Observable<StateVectorT>>> obs{
+        obs0, obs1, obs2};
+
+    const auto ops = OpsData<StateVectorT>(
+        {"RX", "RY", "RX"}, {{param[0]}, {param[1]}, {param[2]}},
+        {{0}, {1}, {2}}, {false, false, false});
+
+    std::vector<ComplexT> cdata(1U << num_qubits);
+    cdata[0] = ComplexT{1, 0};
+    StateVectorT sv(cdata.data(), cdata.size());
+
+    ExecutionQueue<StateVectorT> queue;
+
+    SECTION("Queued jobs match synchronous execution") {
+        auto f_apply = queue.applyOperations(sv, ops);
+        auto f_expval = queue.expval(sv, obs);
+        auto f_jac = queue.adjointJacobian(sv, obs, ops, tp);
+
+        f_apply.get();
+        const auto expvals = f_expval.get();
+        const auto jac = f_jac.get();
+
+        REQUIRE(expvals.size() == obs.size());
+        REQUIRE(jac.size() == obs.size() * tp.size());
+        for (size_t i = 0; i < num_qubits; i++) {
+            CHECK(expvals[i] == Approx(std::cos(param[i])).margin(1e-5));
+        }
+
+        std::vector<PrecisionT> expected(obs.size() * tp.size(), 0.0);
+        const JacobianData<StateVectorT> jd{
+            ops.getTotalNumParams(), sv.getLength(), sv.getData(), obs, ops,
+            tp};
+        AdjointJacobian<StateVectorT> adj;
+        adj.adjointJacobian(std::span{expected}, jd, sv);
+        for (size_t i = 0; i < jac.size(); i++) {
+            CHECK(jac[i] == Approx(expected[i]).margin(1e-6));
+        }
+        CHECK(jac[0] == Approx(-std::sin(param[0])).margin(1e-5));
+        CHECK(jac[4] == Approx(-std::sin(param[1])).margin(1e-5));
+        CHECK(jac[8] == Approx(-std::sin(param[2])).margin(1e-5));
+        CHECK(queue.getNumPendingJobs() == 0);
+    }
+
+    SECTION("Errors are reported through the future") {
+        auto bad_ops = OpsData<StateVectorT>({"RX"}, {{0.1, 0.2}}, {{0}},
+                                             {false});
+        auto f_apply = queue.applyOperations(sv, ops);
+        auto f_jac = queue.adjointJacobian(sv, obs, bad_ops, {0});
+        f_apply.get();
+        REQUIRE_THROWS_AS(f_jac.get(), LightningException);
+
+        queue.synchronize();
+        CHECK(queue.getNumPendingJobs() == 0);
+    }
+}
@@ -0,0 +1,163 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <complex>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "AdjointJacobianLQubit.hpp"
+#include "JacobianData.hpp"
+#include "JacobianVectorProduct.hpp"
+#include "ObservablesLQubit.hpp"
+#include "StateVectorLQubitManaged.hpp"
+#include "StateVectorLQubitRaw.hpp"
+#include "TestHelpers.hpp" // PL_REQUIRE_THROWS_MATCHES
+#include "VectorJacobianProduct.hpp"
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::Algorithms;
+using namespace Pennylane::Util;
+
+using namespace Pennylane::LightningQubit::Algorithms;
+using namespace Pennylane::LightningQubit::Observables;
+} // namespace
+/// @endcond
+
+TEMPLATE_PRODUCT_TEST_CASE("JacobianVectorProduct", "[Algorithms]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    const size_t num_qubits = 3;
+    const size_t length = 1U << num_qubits;
+    const std::vector<PrecisionT> param{-0.45, 0.2, 1.3, 0.7};
+
+    auto obs0 = std::make_shared<NamedObs<StateVectorT>>(
+        "PauliZ", std::vector<size_t>{0});
+    auto obs1 = TensorProdObs<StateVectorT>::create(
+        {std::make_shared<NamedObs<StateVectorT>>("PauliX",
+                                                  std::vector<size_t>{1}),
+         std::make_shared<NamedObs<StateVectorT>>("PauliY",
+                                                  std::vector<size_t>{2})});
+    const std::vector<std::shared_ptr<Observable<StateVectorT>>> obs{obs0,
+                                                                     obs1};
+
+    const auto ops = OpsData<StateVectorT>(
+        {"Hadamard", "RX", "CNOT", "RY", "IsingZZ", "Hadamard", "RZ"},
+        {{}, {param[0]}, {}, {param[1]}, {param[2]}, {}, {param[3]}},
+        {{0}, {0}, {0, 1}, {1}, {1, 2}, {2}, {2}},
+        {false, false, false, true, false, false, false});
+
+    std::vector<ComplexT> cdata(length);
+    cdata[0] = ComplexT{1, 0};
+    StateVectorT psi(cdata.data(), cdata.size());
+
+    const std::vector<size_t> tp{0, 2, 3};
+    const std::vector<PrecisionT> tangent{0.3, -1.1, 0.6};
+    const JacobianData<StateVectorT> jd{
+        ops.getTotalNumParams(), psi.getLength(), psi.getData(), obs, ops, tp};
+
+    JacobianVectorProduct<StateVectorT> jvp;
+
+    SECTION("Expectation values match the adjoint Jacobian") {
+        std::vector<PrecisionT> jac(obs.size() * tp.size(), 0.0);
+        AdjointJacobian<StateVectorT> adj;
+        adj.adjointJacobian(std::span{jac}, jd, psi, true);
+
+        std::vector<PrecisionT> result(obs.size(), 0.0);
+        jvp.expval(std::span{result}, jd, std::span{tangent});
+        for (size_t o = 0; o < obs.size(); o++) {
+            PrecisionT expected = 0.0;
+            for (size_t t = 0; t < tp.size(); t++) {
+                expected += jac[o * tp.size() + t] * tangent[t];
+            }
+            CHECK(result[o] == Approx(expected).margin(1e-5));
+        }
+    }
+
+    SECTION("State matches the vector Jacobian product") {
+        std::vector<ComplexT> dy(length);
+        for (size_t i = 0; i < length; i++) {
+            dy[i] = ComplexT{static_cast<PrecisionT>(0.1 * i),
+                             static_cast<PrecisionT>(0.3 - 0.05 * i)};
+        }
+        std::vector<ComplexT> vjp_result(tp.size());
+        VectorJacobianProduct<StateVectorT> vjp;
+        vjp(std::span{vjp_result}, jd, std::span<const ComplexT>{dy}, true);
+
+        std::vector<ComplexT> result(length);
+        jvp(std::span{result}, jd, std::span{tangent});
+
+        ComplexT expected{0.0, 0.0};
+        for (size_t t = 0; t < tp.size(); t++) {
+            expected += vjp_result[t] * tangent[t];
+        }
+        ComplexT overlap{0.0, 0.0};
+        for (size_t i = 0; i < length; i++) {
+            overlap += std::conj(dy[i]) * result[i];
+        }
+        CHECK(std::real(overlap) == Approx(std::real(expected)).margin(1e-5));
+        CHECK(std::imag(overlap) == Approx(std::imag(expected)).margin(1e-5));
+    }
+
+    SECTION("Probabilities match finite differences") {
+        std::vector<PrecisionT> result(length);
+        jvp.probs(std::span{result}, jd, std::span{tangent});
+
+        const PrecisionT h = 1e-3;
+        auto shifted_probs = [&](PrecisionT sign) {
+            std::vector<std::vector<PrecisionT>> shifted_params{
+                {}, {param[0] + sign * h * tangent[0]}, {},
+                {param[1]}, {param[2] + sign * h * tangent[1]}, {},
+                {param[3] + sign * h * tangent[2]}};
+            const auto shifted_ops = OpsData<StateVectorT>(
+                ops.getOpsName(), shifted_params, ops.getOpsWires(),
+                ops.getOpsInverses());
+            StateVectorLQubitManaged<PrecisionT> sv(cdata.data(),
+                                                    cdata.size());
+            for (size_t i = 0; i < shifted_ops.getSize(); i++) {
+                sv.applyOperation(shifted_ops.getOpsName()[i],
+                                  shifted_ops.getOpsWires()[i],
+                                  shifted_ops.getOpsInverses()[i],
+                                  shifted_ops.getOpsParams()[i]);
+            }
+            std::vector<PrecisionT> probs(length);
+            for (size_t i = 0; i < length; i++) {
+                probs[i] = std::norm(sv.getData()[i]);
+            }
+            return probs;
+        };
+        const auto plus = shifted_probs(1);
+        const auto minus = shifted_probs(-1);
+        for (size_t i = 0; i < length; i++) {
+            CHECK(result[i] == Approx((plus[i] - minus[i]) / (2 * h))
+                                   .margin(1e-2));
+        }
+    }
+
+    SECTION("Throws for a tangent of the wrong size") {
+        std::vector<PrecisionT> result(obs.size(), 0.0);
+        const std::vector<PrecisionT> short_tangent{1.0};
+        PL_REQUIRE_THROWS_MATCHES(
+            jvp.expval(std::span{result}, jd, std::span{short_tangent}),
+            LightningException,
+            "The size of the tangent vector must be the number of trainable "
+            "parameters.");
+    }
+}
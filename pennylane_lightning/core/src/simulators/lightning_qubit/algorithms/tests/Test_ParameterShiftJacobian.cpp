@@ -0,0 +1,148 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "AdjointJacobianLQubit.hpp"
+#include "JacobianData.hpp"
+#include "ObservablesLQubit.hpp"
+#include "ParameterShiftJacobian.hpp"
+#include "StateVectorLQubitManaged.hpp"
+#include "StateVectorLQubitRaw.hpp"
+#include "TestHelpers.hpp" // PL_REQUIRE_THROWS_MATCHES
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::Algorithms;
+using namespace Pennylane::Util;
+
+using namespace Pennylane::LightningQubit::Algorithms;
+using namespace Pennylane::LightningQubit::Observables;
+} // namespace
+/// @endcond
+
+TEMPLATE_PRODUCT_TEST_CASE("ParameterShiftJacobian", "[Algorithms]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    const size_t num_qubits = 3;
+    const std::vector<PrecisionT> param{-0.45, 0.2, 1.3, 0.7, -1.1};
+
+    auto obs0 = std::make_shared<NamedObs<StateVectorT>>(
+        "PauliZ", std::vector<size_t>{0});
+    auto obs1 = TensorProdObs<StateVectorT>::create(
+        {std::make_shared<NamedObs<StateVectorT>>("PauliX",
+                                                  std::vector<size_t>{1}),
+         std::make_shared<NamedObs<StateVectorT>>("PauliY",
+                                                  std::vector<size_t>{2})});
+    auto obs2 = Hamiltonian<StateVectorT>::create(
+        {PrecisionT{0.3}, PrecisionT{-0.8}},
+        {obs0, std::make_shared<NamedObs<StateVectorT>>(
+                   "PauliX", std::vector<size_t>{2})});
+    auto obs3 = std::make_shared<ProjectorObs<StateVectorT>>(
+        std::vector<size_t>{0, 1}, std::vector<size_t>{1, 2});
+    const std::vector<std::shared_ptr<Observable<StateVectorT>>> obs{
+        obs0, obs1, obs2, obs3};
+
+    const auto ops = OpsData<StateVectorT>(
+        {"Hadamard", "RX", "CNOT", "RY", "IsingZZ", "Hadamard", "RZ",
+         "PhaseShift"},
+        {{}, {param[0]}, {}, {param[1]}, {param[2]}, {}, {param[3]},
+         {param[4]}},
+        {{0}, {0}, {0, 1}, {1}, {1, 2}, {2}, {2}, {0}},
+        {false, false, false, true, false, false, false, false});
+
+    std::vector<ComplexT> cdata(1U << num_qubits);
+    cdata[0] = ComplexT{1, 0};
+    StateVectorT psi(cdata.data(), cdata.size());
+
+    ParameterShiftJacobian<StateVectorT> ps;
+
+    for (const auto &tp :
+         {std::vector<size_t>{0, 1, 2, 3, 4}, std::vector<size_t>{1, 3}}) {
+        std::vector<PrecisionT> expected(obs.size() * tp.size(), 0.0);
+        {
+            const JacobianData<StateVectorT> jd{
+                ops.getTotalNumParams(), psi.getLength(), psi.getData(), obs,
+                ops, tp};
+            AdjointJacobian<StateVectorT> adj;
+            adj.adjointJacobian(std::span{expected}, jd, psi, true);
+        }
+        const JacobianData<StateVectorT> jd{ops.getTotalNumParams(),
+                                            psi.getLength(),
+                                            psi.getData(),
+                                            obs,
+                                            ops,
+                                            tp};
+
+        for (size_t max_snapshots : {size_t{1}, size_t{2}, size_t{16}}) {
+            DYNAMIC_SECTION("Parameter shift - num_tp = "
+                            << tp.size() << ", snapshots = " << max_snapshots) {
+                std::vector<PrecisionT> jac(obs.size() * tp.size(), 0.0);
+                ps.parameterShift(std::span{jac}, jd, max_snapshots);
+                for (size_t i = 0; i < jac.size(); i++) {
+                    CHECK(jac[i] == Approx(expected[i]).margin(1e-5));
+                }
+            }
+            DYNAMIC_SECTION("Finite difference - num_tp = "
+                            << tp.size() << ", snapshots = " << max_snapshots) {
+                const PrecisionT h = std::is_same_v<PrecisionT, float>
+                                         ? PrecisionT{1e-2}
+                                         : PrecisionT{1e-6};
+                std::vector<PrecisionT> jac(obs.size() * tp.size(), 0.0);
+                ps.finiteDiff(std::span{jac}, jd, h, max_snapshots);
+                for (size_t i = 0; i < jac.size(); i++) {
+                    CHECK(jac[i] == Approx(expected[i]).margin(2e-2));
+                }
+            }
+        }
+    }
+
+    SECTION("Throws for gates without a two-term rule") {
+        const auto crx_ops = OpsData<StateVectorT>(
+            {"Hadamard", "CRX"}, {{}, {0.3}}, {{0}, {0, 1}}, {false, false});
+        const std::vector<size_t> tp{0};
+        const JacobianData<StateVectorT> jd{crx_ops.getTotalNumParams(),
+                                            psi.getLength(),
+                                            psi.getData(),
+                                            obs,
+                                            crx_ops,
+                                            tp};
+        std::vector<PrecisionT> jac(obs.size(), 0.0);
+        PL_REQUIRE_THROWS_MATCHES(ps.parameterShift(std::span{jac}, jd),
+                                  LightningException,
+                                  "has no two-term parameter-shift rule");
+        REQUIRE_NOTHROW(ps.finiteDiff(std::span{jac}, jd, PrecisionT{1e-3}));
+    }
+
+    SECTION("Throws for an empty snapshot budget") {
+        const std::vector<size_t> tp{0};
+        const JacobianData<StateVectorT> jd{ops.getTotalNumParams(),
+                                            psi.getLength(),
+                                            psi.getData(),
+                                            obs,
+                                            ops,
+                                            tp};
+        std::vector<PrecisionT> jac(obs.size(), 0.0);
+        PL_REQUIRE_THROWS_MATCHES(ps.parameterShift(std::span{jac}, jd, 0),
+                                  LightningException,
+                                  "snapshot budget must be at least one");
+    }
+}
@@ -19,13 +19,24 @@
  */
 
 #pragma once
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <span>
+#include <variant>
+
+#include "AdjointJacobianLQubit.hpp"
 #include "BindingsBase.hpp"
 #include "Constant.hpp"
 #include "ConstantUtil.hpp" // lookup
 #include "DynamicDispatcher.hpp"
+#include "ExecutionQueue.hpp"
 #include "GateOperation.hpp"
+#include "JacobianVectorProduct.hpp"
 #include "MeasurementsLQubit.hpp"
 #include "ObservablesLQubit.hpp"
+#include "ParameterShiftJacobian.hpp"
 #include "StateVectorLQubitRaw.hpp"
 #include "TypeList.hpp"
 #include "VectorJacobianProduct.hpp"
@@ -95,6 +106,85 @@ void registerBackendClassSpecificBindings(PyClass &pyclass) {
 
     pyclass.def("kernel_map", &svKernelMap<StateVectorT>,
                 "Get internal kernels for operations");
+    pyclass.def("applyDiagonal", &registerDiagonal<StateVectorT>,
+                "Apply a diagonal matrix, given by its diagonal, to wires.");
+    pyclass.def("applyReflection", &registerReflection<StateVectorT>,
+                "Apply the reflection 2|s><s| - I about a state of wires.");
+    pyclass.def("applyGroverOperator", &StateVectorT::applyGroverOperator,
+                "Apply the Grover diffusion operator to wires.");
+    pyclass.def("applyPermutation", &StateVectorT::applyPermutation,
+                "Apply a permutation of the basis states of wires.",
+                py::arg("perm"), py::arg("wires"), py::arg("in_place") = false);
+    pyclass.def("applyOracle", &StateVectorT::applyOracle,
+                "Apply the oracle |x>|y> -> |x>|y XOR f(x)>.");
+    pyclass.def("applyModularAdd", &StateVectorT::applyModularAdd,
+                "Apply |x> -> |x + a mod 2^k> to wires.");
+    pyclass.def("applyModularMultiply", &StateVectorT::applyModularMultiply,
+                "Apply |x> -> |a x mod N> to wires.");
+
+    pyclass
+        .def(
+            "getAmplitudes",
+            [](const StateVectorT &sv, const std::vector<size_t> &indices) {
+                return createNumpyArrayFromVector(sv.getAmplitudes(indices));
+            },
+            "Get the amplitudes of the given basis states.")
+        .def(
+            "getAmplitudesRange",
+            [](const StateVectorT &sv, size_t begin, size_t end) {
+                return createNumpyArrayFromVector(
+                    sv.getAmplitudesRange(begin, end));
+            },
+            "Get the amplitudes of the basis states in [begin, end).")
+        .def(
+            "getAmplitudesSlice",
+            [](const StateVectorT &sv, const std::vector<size_t> &wires,
+               const std::vector<size_t> &values) {
+                return createNumpyArrayFromVector(
+                    sv.getAmplitudesSlice(wires, values));
+            },
+            "Get the amplitudes of the basis states with the given wires "
+            "fixed to the given bit values.");
+
+    using SnapshotT = typename StateVectorT::SnapshotT;
+    py::class_<SnapshotT>(pyclass, "Snapshot", py::module_local())
+        .def_property_readonly("num_qubits", &SnapshotT::getNumQubits)
+        .def_property_readonly("num_chunks", &SnapshotT::getNumChunks)
+        .def("num_shared_chunks", &SnapshotT::getNumSharedChunks,
+             "Number of chunks stored in the same buffer as in another "
+             "snapshot.");
+
+    pyclass
+        .def(
+            "snapshot",
+            [](const StateVectorT &sv, size_t chunk_qubits) {
+                return sv.snapshot(chunk_qubits);
+            },
+            "Take a snapshot of the statevector.",
+            py::arg("chunk_qubits") = SnapshotT::default_chunk_qubits)
+        .def(
+            "snapshot",
+            [](const StateVectorT &sv, const SnapshotT &base) {
+                return sv.snapshot(base);
+            },
+            "Take a snapshot of the statevector, sharing the chunks that are "
+            "unchanged since a base snapshot.",
+            py::arg("base"))
+        .def("restore", &StateVectorT::restore,
+             "Restore the statevector from a snapshot.");
+
+    using PoolT = AmplitudeBufferPool<typename StateVectorT::PrecisionT>;
+    pyclass
+        .def_static(
+            "setBufferPoolCapacity",
+            [](size_t capacity) { PoolT::getInstance().setCapacity(capacity); },
+            "Set the maximum number of amplitudes kept by the buffer pool of "
+            "snapshots and forks. A capacity of 0 disables pooling.",
+            py::arg("capacity"))
+        .def_static(
+            "clearBufferPool", []() { PoolT::getInstance().clear(); },
+            "Free all buffers kept by the buffer pool of snapshots and "
+            "forks.");
 }
 
 /**
@@ -116,13 +206,51 @@ void registerBackendSpecificMeasurements(PyClass &pyclass) {
     using np_arr_sparse_ind =
         py::array_t<sparse_index_type,
                     py::array::c_style | py::array::forcecast>;
+    // 32-bit column indices are used as given, without a 64-bit copy
+    using np_arr_sparse_ind32 = py::array_t<int32_t, py::array::c_style>;
+    using np_arr_out = py::array_t<ParamT, py::array::c_style>;
+    using np_arr_samples_out = py::array_t<size_t, py::array::c_style>;
 
     pyclass
+        .def(
+            "probs",
+            [](Measurements<StateVectorT> &M, const std::vector<size_t> &wires,
+               np_arr_out &out) {
+                M.probs(wires,
+                        getOutputSpan(out, size_t{1} << wires.size()));
+            },
+            py::arg("wires"), py::arg("out").noconvert(),
+            "Write the probabilities of the given wires into a preallocated "
+            "array.")
+        .def(
+            "generate_samples",
+            [](Measurements<StateVectorT> &M, size_t num_wires,
+               size_t num_shots, np_arr_samples_out &out) {
+                M.generate_samples(num_shots,
+                                   getOutputSpan(out, num_shots * num_wires));
+            },
+            py::arg("num_wires"), py::arg("num_shots"),
+            py::arg("out").noconvert(),
+            "Write samples into a preallocated array of shape (num_shots, "
+            "num_wires).")
         .def("expval",
              static_cast<PrecisionT (Measurements<StateVectorT>::*)(
                  const std::string &, const std::vector<size_t> &)>(
                  &Measurements<StateVectorT>::expval),
              "Expected value of an operation by name.")
+        .def(
+            "expval",
+            [](Measurements<StateVectorT> &M, const np_arr_sparse_ind &row_map,
+               const np_arr_sparse_ind32 &entries, const np_arr_c &values) {
+                return M.expval(
+                    static_cast<sparse_index_type *>(row_map.request().ptr),
+                    static_cast<sparse_index_type>(row_map.request().size),
+                    static_cast<int32_t *>(entries.request().ptr),
+                    static_cast<std::complex<PrecisionT> *>(
+                        values.request().ptr),
+                    static_cast<sparse_index_type>(values.request().size));
+            },
+            "Expected value of a sparse Hamiltonian with 32-bit indices.")
         .def(
             "expval",
             [](Measurements<StateVectorT> &M, const np_arr_sparse_ind &row_map,
@@ -146,6 +274,19 @@ void registerBackendSpecificMeasurements(PyClass &pyclass) {
                  const std::string &, const std::vector<size_t> &)>(
                  &Measurements<StateVectorT>::var),
              "Variance of an operation by name.")
+        .def(
+            "var",
+            [](Measurements<StateVectorT> &M, const np_arr_sparse_ind &row_map,
+               const np_arr_sparse_ind32 &entries, const np_arr_c &values) {
+                return M.var(
+                    static_cast<sparse_index_type *>(row_map.request().ptr),
+                    static_cast<sparse_index_type>(row_map.request().size),
+                    static_cast<int32_t *>(entries.request().ptr),
+                    static_cast<std::complex<PrecisionT> *>(
+                        values.request().ptr),
+                    static_cast<sparse_index_type>(values.request().size));
+            },
+            "Variance of a sparse Hamiltonian with 32-bit column indices.")
         .def(
             "var",
             [](Measurements<StateVectorT> &M, const np_arr_sparse_ind &row_map,
@@ -198,6 +339,8 @@ void registerBackendSpecificObservables([[maybe_unused]] py::module_ &m) {
         std::to_string(sizeof(std::complex<PrecisionT>) * 8);
 
     using np_arr_c = py::array_t<std::complex<ParamT>, py::array::c_style>;
+    using np_arr_idx =
+        py::array_t<int64_t, py::array::c_style | py::array::forcecast>;
 
     std::string class_name;
 
@@ -206,18 +349,30 @@ void registerBackendSpecificObservables([[maybe_unused]] py::module_ &m) {
                std::shared_ptr<SparseHamiltonian<StateVectorT>>,
                Observable<StateVectorT>>(m, class_name.c_str(),
                                          py::module_local())
-        .def(py::init([](const np_arr_c &data,
-                         const std::vector<std::size_t> &indices,
-                         const std::vector<std::size_t> &indptr,
-                         const std::vector<std::size_t> &wires) {
-            using ComplexT = typename StateVectorT::ComplexT;
-            const py::buffer_info buffer_data = data.request();
-            const auto *data_ptr = static_cast<ComplexT *>(buffer_data.ptr);
-
-            return SparseHamiltonian<StateVectorT>{
-                std::vector<ComplexT>({data_ptr, data_ptr + data.size()}),
-                indices, indptr, wires};
-        }))
+        .def(py::init([](const np_arr_c &data, const np_arr_idx &indices,
+                         const np_arr_idx &indptr,
+                         const std::vector<std::size_t> &wires,
+                         bool upper_triangle) {
+                 using ComplexT = typename StateVectorT::ComplexT;
+                 const auto *data_ptr =
+                     static_cast<const ComplexT *>(data.request().ptr);
+                 const auto *indices_ptr =
+                     static_cast<const int64_t *>(indices.request().ptr);
+                 const auto *indptr_ptr =
+                     static_cast<const int64_t *>(indptr.request().ptr);
+
+                 // The CSR arrays are compacted without intermediate copies
+                 return SparseHamiltonian<StateVectorT>{
+                     std::span<const ComplexT>{
+                         data_ptr, static_cast<size_t>(data.size())},
+                     std::span<const int64_t>{
+                         indices_ptr, static_cast<size_t>(indices.size())},
+                     std::span<const int64_t>{
+                         indptr_ptr, static_cast<size_t>(indptr.size())},
+                     wires, upper_triangle};
+             }),
+             py::arg("data"), py::arg("indices"), py::arg("indptr"),
+             py::arg("wires"), py::arg("upper_triangle") = false)
         .def("__repr__", &SparseHamiltonian<StateVectorT>::getObsName)
         .def("get_wires", &SparseHamiltonian<StateVectorT>::getWires,
              "Get wires of observables")
@@ -232,6 +387,30 @@ void registerBackendSpecificObservables([[maybe_unused]] py::module_ &m) {
                 return self == other_cast;
             },
             "Compare two observables");
+
+    class_name = "ProjectorObsC" + bitsize;
+    py::class_<ProjectorObs<StateVectorT>,
+               std::shared_ptr<ProjectorObs<StateVectorT>>,
+               Observable<StateVectorT>>(m, class_name.c_str(),
+                                         py::module_local())
+        .def(py::init([](const std::vector<size_t> &state,
+                         const std::vector<size_t> &wires) {
+            return ProjectorObs<StateVectorT>(state, wires);
+        }))
+        .def("__repr__", &ProjectorObs<StateVectorT>::getObsName)
+        .def("get_wires", &ProjectorObs<StateVectorT>::getWires,
+             "Get wires of observables")
+        .def(
+            "__eq__",
+            [](const ProjectorObs<StateVectorT> &self,
+               py::handle other) -> bool {
+                if (!py::isinstance<ProjectorObs<StateVectorT>>(other)) {
+                    return false;
+                }
+                auto other_cast = other.cast<ProjectorObs<StateVectorT>>();
+                return self == other_cast;
+            },
+            "Compare two observables");
 }
 
 /**
@@ -264,9 +443,104 @@ auto registerVJP(VectorJacobianProduct<StateVectorT> &calculate_vjp,
         std::span{static_cast<const std::complex<PrecisionT> *>(buffer.ptr),
                   static_cast<size_t>(buffer.size)});
 
-    return py::array_t<std::complex<PrecisionT>>(py::cast(vjp));
+    return createNumpyArrayFromVector(std::move(vjp));
 }
 
+/**
+ * @brief Python handle to the result of a job queued on an ExecutionQueue.
+ *
+ * The handle owns the statevector the job runs on, and keeps the numpy array
+ * holding its data alive until the job has completed. It releases the GIL
+ * while waiting on the job. Vector results are handed over to numpy without
+ * copying.
+ *
+ * @tparam StateVectorT State vector type of the job.
+ */
+template <class StateVectorT> class AsyncResult {
+  private:
+    using PrecisionT = typename StateVectorT::PrecisionT;
+
+    std::variant<std::future<void>, std::future<std::vector<PrecisionT>>>
+        future_;
+    std::unique_ptr<StateVectorT> sv_;
+    py::object keep_alive_;
+    py::object result_;
+
+  public:
+    /**
+     * @brief Create a handle to a queued job.
+     *
+     * @param future Future of the job.
+     * @param sv Statevector the job runs on.
+     * @param keep_alive Python object holding the data of the statevector.
+     */
+    template <class FutureT>
+    AsyncResult(FutureT &&future, std::unique_ptr<StateVectorT> sv,
+                py::object keep_alive)
+        : future_{std::forward<FutureT>(future)}, sv_{std::move(sv)},
+          keep_alive_{std::move(keep_alive)} {}
+
+    AsyncResult(const AsyncResult &) = delete;
+    AsyncResult(AsyncResult &&) noexcept = default;
+    auto operator=(const AsyncResult &) -> AsyncResult & = delete;
+    auto operator=(AsyncResult &&) noexcept -> AsyncResult & = default;
+
+    ~AsyncResult() { wait(); }
+
+    /**
+     * @brief Check whether the job has completed without blocking.
+     */
+    [[nodiscard]] auto done() const -> bool {
+        return std::visit(
+            [](const auto &future) {
+                return !future.valid() ||
+                       future.wait_for(std::chrono::seconds(0)) ==
+                           std::future_status::ready;
+            },
+            future_);
+    }
+
+    /**
+     * @brief Block until the job has completed.
+     */
+    void wait() {
+        std::visit(
+            [](auto &future) {
+                if (future.valid()) {
+                    py::gil_scoped_release release;
+                    future.wait();
+                }
+            },
+            future_);
+    }
+
+    /**
+     * @brief Block until the job has completed and return its result.
+     *
+     * @return `None` for jobs without output, a 1D numpy array otherwise.
+     * Exceptions raised by the job are rethrown.
+     */
+    auto result() -> py::object {
+        if (!result_) {
+            wait();
+            result_ = std::visit(
+                [](auto &future) -> py::object {
+                    using FutureT = std::decay_t<decltype(future)>;
+                    if constexpr (std::is_same_v<FutureT, std::future<void>>) {
+                        future.get();
+                        return py::none();
+                    } else {
+                        return createNumpyArrayFromVector(future.get());
+                    }
+                },
+                future_);
+            sv_.reset();
+            keep_alive_ = py::none();
+        }
+        return result_;
+    }
+};
+
 /**
  * @brief Register backend specific adjoint Jacobian methods.
  *
@@ -295,6 +569,239 @@ void registerBackendSpecificAlgorithms(py::module_ &m) {
         .def(py::init<>())
         .def("__call__", &registerVJP<StateVectorT, np_arr_c>,
              "Vector Jacobian Product method.");
+
+    //***********************************************************************//
+    //                        Jacobian Vector Product
+    //***********************************************************************//
+    using np_arr_r = py::array_t<ParamT, py::array::c_style>;
+    using ObsPtrsT = std::vector<std::shared_ptr<Observable<StateVectorT>>>;
+    auto getTangent = [](const np_arr_r &tangent) {
+        const auto buffer = tangent.request();
+        return std::span{static_cast<const ParamT *>(buffer.ptr),
+                         static_cast<size_t>(buffer.size)};
+    };
+
+    class_name = "JacobianVectorProductC" + bitsize;
+    py::class_<JacobianVectorProduct<StateVectorT>>(m, class_name.c_str(),
+                                                    py::module_local())
+        .def(py::init<>())
+        .def(
+            "__call__",
+            [getTangent](JacobianVectorProduct<StateVectorT> &calculate_jvp,
+                         const StateVectorT &sv,
+                         const OpsData<StateVectorT> &operations,
+                         const np_arr_r &tangent,
+                         const std::vector<size_t> &trainableParams) {
+                std::vector<std::complex<PrecisionT>> jvp(sv.getLength());
+                const JacobianData<StateVectorT> jd{
+                    operations.getTotalNumParams(),
+                    sv.getLength(),
+                    sv.getData(),
+                    {},
+                    operations,
+                    trainableParams};
+                calculate_jvp(std::span{jvp}, jd, getTangent(tangent));
+                return createNumpyArrayFromVector(std::move(jvp));
+            },
+            "Jacobian Vector Product of the final statevector.")
+        .def(
+            "probs",
+            [getTangent](JacobianVectorProduct<StateVectorT> &calculate_jvp,
+                         const StateVectorT &sv,
+                         const OpsData<StateVectorT> &operations,
+                         const np_arr_r &tangent,
+                         const std::vector<size_t> &trainableParams) {
+                std::vector<PrecisionT> jvp(sv.getLength());
+                const JacobianData<StateVectorT> jd{
+                    operations.getTotalNumParams(),
+                    sv.getLength(),
+                    sv.getData(),
+                    {},
+                    operations,
+                    trainableParams};
+                calculate_jvp.probs(std::span{jvp}, jd, getTangent(tangent));
+                return createNumpyArrayFromVector(std::move(jvp));
+            },
+            "Jacobian Vector Product of the computational basis "
+            "probabilities.")
+        .def(
+            "expval",
+            [getTangent](JacobianVectorProduct<StateVectorT> &calculate_jvp,
+                         const StateVectorT &sv, const ObsPtrsT &observables,
+                         const OpsData<StateVectorT> &operations,
+                         const np_arr_r &tangent,
+                         const std::vector<size_t> &trainableParams) {
+                std::vector<PrecisionT> jvp(observables.size());
+                const JacobianData<StateVectorT> jd{
+                    operations.getTotalNumParams(),
+                    sv.getLength(),
+                    sv.getData(),
+                    observables,
+                    operations,
+                    trainableParams};
+                calculate_jvp.expval(std::span{jvp}, jd, getTangent(tangent));
+                return createNumpyArrayFromVector(std::move(jvp));
+            },
+            "Jacobian Vector Product of the expectation values.");
+
+    //***********************************************************************//
+    //                   Parameter-shift / finite-difference
+    //***********************************************************************//
+    class_name = "ParameterShiftJacobianC" + bitsize;
+    py::class_<ParameterShiftJacobian<StateVectorT>>(m, class_name.c_str(),
+                                                     py::module_local())
+        .def(py::init<>())
+        .def(
+            "parameter_shift",
+            [](ParameterShiftJacobian<StateVectorT> &ps, const StateVectorT &sv,
+               const std::vector<std::shared_ptr<Observable<StateVectorT>>>
+                   &observables,
+               const OpsData<StateVectorT> &operations,
+               const std::vector<size_t> &trainableParams,
+               size_t max_snapshots) {
+                std::vector<PrecisionT> jac(
+                    observables.size() * trainableParams.size(),
+                    PrecisionT{0.0});
+                const JacobianData<StateVectorT> jd{
+                    operations.getTotalNumParams(), sv.getLength(),
+                    sv.getData(), observables, operations, trainableParams};
+                ps.parameterShift(std::span{jac}, jd, max_snapshots);
+                return createNumpyArrayFromVector(std::move(jac));
+            },
+            "Parameter-shift Jacobian of a tape applied to the given input "
+            "state.",
+            py::arg("sv"), py::arg("observables"), py::arg("operations"),
+            py::arg("trainableParams"), py::arg("max_snapshots") = 1)
+        .def(
+            "finite_diff",
+            [](ParameterShiftJacobian<StateVectorT> &ps, const StateVectorT &sv,
+               const std::vector<std::shared_ptr<Observable<StateVectorT>>>
+                   &observables,
+               const OpsData<StateVectorT> &operations,
+               const std::vector<size_t> &trainableParams, PrecisionT h,
+               size_t max_snapshots) {
+                std::vector<PrecisionT> jac(
+                    observables.size() * trainableParams.size(),
+                    PrecisionT{0.0});
+                const JacobianData<StateVectorT> jd{
+                    operations.getTotalNumParams(), sv.getLength(),
+                    sv.getData(), observables, operations, trainableParams};
+                ps.finiteDiff(std::span{jac}, jd, h, max_snapshots);
+                return createNumpyArrayFromVector(std::move(jac));
+            },
+            "Forward finite-difference Jacobian of a tape applied to the "
+            "given input state.",
+            py::arg("sv"), py::arg("observables"), py::arg("operations"),
+            py::arg("trainableParams"),
+            py::arg("h") =
+                std::sqrt(std::numeric_limits<PrecisionT>::epsilon()),
+            py::arg("max_snapshots") = 1);
+
+    //***********************************************************************//
+    //                   Term-resolved Hamiltonian Jacobian
+    //***********************************************************************//
+    std::string function_name = "adjoint_jacobian_termsC" + bitsize;
+    m.def(
+        function_name.c_str(),
+        [](const StateVectorT &sv,
+           const std::shared_ptr<Observable<StateVectorT>> &hamiltonian,
+           const OpsData<StateVectorT> &operations,
+           const std::vector<size_t> &trainableParams, size_t max_states) {
+            const JacobianData<StateVectorT> jd{
+                operations.getTotalNumParams(), sv.getLength(), sv.getData(),
+                {hamiltonian}, operations, trainableParams};
+            const size_t num_terms = hamiltonian->getCoeffs().size();
+            std::vector<PrecisionT> jac(num_terms * trainableParams.size(),
+                                        PrecisionT{0.0});
+            std::vector<PrecisionT> term_expvals(num_terms, PrecisionT{0.0});
+            AdjointJacobian<StateVectorT> adj;
+            adj.adjointJacobianTerms(std::span{jac}, std::span{term_expvals},
+                                     jd, max_states);
+            return py::make_tuple(
+                createNumpyArrayFromVector(std::move(jac), num_terms,
+                                           trainableParams.size()),
+                createNumpyArrayFromVector(std::move(term_expvals)));
+        },
+        "Jacobian of each Hamiltonian term and the term expectation values, "
+        "which are the derivatives with respect to the coefficients.",
+        py::arg("sv"), py::arg("hamiltonian"), py::arg("operations"),
+        py::arg("trainableParams"), py::arg("max_states"));
+
+    //***********************************************************************//
+    //                           Execution Queue
+    //***********************************************************************//
+    using ObsPtrT = std::shared_ptr<Observable<StateVectorT>>;
+    using AsyncResultT = AsyncResult<StateVectorT>;
+
+    // The jobs run on a statevector over the caller's array, which the
+    // handle keeps alive. It must not be converted into a temporary.
+    auto stateOver = [](np_arr_c &state) {
+        const auto data =
+            getOutputSpan(state, static_cast<size_t>(state.size()));
+        return std::make_unique<StateVectorT>(data.data(), data.size());
+    };
+
+    class_name = "AsyncResultC" + bitsize;
+    py::class_<AsyncResultT>(m, class_name.c_str(), py::module_local())
+        .def("done", &AsyncResultT::done,
+             "Check whether the job has completed.")
+        .def("wait", &AsyncResultT::wait, "Block until the job has completed.")
+        .def("result", &AsyncResultT::result,
+             "Block until the job has completed and return its result.");
+
+    class_name = "ExecutionQueueC" + bitsize;
+    py::class_<ExecutionQueue<StateVectorT>>(
+        m, class_name.c_str(),
+        "Queue of jobs run on a background thread. Each job runs on the "
+        "statevector data of a numpy array, which must not be read or written "
+        "until the result() of the job has returned.",
+        py::module_local())
+        .def(py::init<>())
+        .def(
+            "apply_operations",
+            [stateOver](ExecutionQueue<StateVectorT> &queue, np_arr_c &state,
+                        const OpsData<StateVectorT> &operations) {
+                auto sv = stateOver(state);
+                auto future = queue.applyOperations(*sv, operations);
+                return AsyncResultT(std::move(future), std::move(sv), state);
+            },
+            "Queue the application of operations to the statevector data of "
+            "a numpy array, updated in place.",
+            py::arg("state").noconvert(), py::arg("operations"))
+        .def(
+            "expval",
+            [stateOver](ExecutionQueue<StateVectorT> &queue, np_arr_c &state,
+                        const std::vector<ObsPtrT> &observables) {
+                auto sv = stateOver(state);
+                auto future = queue.expval(*sv, observables);
+                return AsyncResultT(std::move(future), std::move(sv), state);
+            },
+            "Queue the computation of expectation values.",
+            py::arg("state").noconvert(), py::arg("observables"))
+        .def(
+            "adjoint_jacobian",
+            [stateOver](ExecutionQueue<StateVectorT> &queue, np_arr_c &state,
+                        const std::vector<ObsPtrT> &observables,
+                        const OpsData<StateVectorT> &operations,
+                        const std::vector<size_t> &trainableParams) {
+                auto sv = stateOver(state);
+                auto future = queue.adjointJacobian(
+                    *sv, observables, operations, trainableParams);
+                return AsyncResultT(std::move(future), std::move(sv), state);
+            },
+            "Queue an adjoint Jacobian computation. The result is the "
+            "flattened (num_observables, num_params) Jacobian.",
+            py::arg("state").noconvert(), py::arg("observables"),
+            py::arg("operations"), py::arg("trainableParams"))
+        .def(
+            "synchronize",
+            [](ExecutionQueue<StateVectorT> &queue) {
+                py::gil_scoped_release release;
+                queue.synchronize();
+            },
+            "Block until all queued jobs have completed.")
+        .def("num_pending", &ExecutionQueue<StateVectorT>::getNumPendingJobs,
+             "Number of queued jobs waiting to be started.");
 }
 
 /**
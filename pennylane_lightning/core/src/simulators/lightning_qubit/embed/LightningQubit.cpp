@@ -0,0 +1,484 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <algorithm>
+#include <exception>
+#include <numeric>
+#include <span>
+#include <utility>
+
+#include "AdjointJacobianLQubit.hpp"
+#include "BinaryCircuitLQubit.hpp"
+#include "Error.hpp"
+#include "JacobianData.hpp"
+#include "MeasurementsLQubit.hpp"
+#include "ObservablesLQubit.hpp"
+#include "StateVectorLQubitManaged.hpp"
+#include "Util.hpp"
+#include "VectorJacobianProduct.hpp"
+
+#include "pennylane_lightning/LightningQubit.hpp"
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::LightningQubit;
+using namespace Pennylane::LightningQubit::Algorithms;
+using namespace Pennylane::LightningQubit::Measures;
+using namespace Pennylane::LightningQubit::Observables;
+using Pennylane::Algorithms::JacobianData;
+using Pennylane::Algorithms::OpsData;
+
+using StateVectorT = StateVectorLQubitManaged<double>;
+using ObservableT = Pennylane::Observables::Observable<StateVectorT>;
+
+/**
+ * @brief Run a function and rethrow its failures as Embed::Error.
+ */
+template <class FuncT> decltype(auto) translateErrors(FuncT &&func) {
+    try {
+        return func();
+    } catch (const Pennylane::LightningQubit::Embed::Error &) {
+        throw;
+    } catch (const std::exception &e) {
+        throw Pennylane::LightningQubit::Embed::Error(e.what());
+    }
+}
+
+void checkWires(const std::vector<size_t> &wires, size_t num_qubits) {
+    PL_ABORT_IF(std::any_of(wires.begin(), wires.end(),
+                            [=](size_t wire) { return wire >= num_qubits; }),
+                "Invalid wire index.");
+}
+
+/**
+ * @brief Check that observables only act on the wires of a state vector.
+ *
+ * Observables are created without a state vector, so their wires are checked
+ * when they are measured.
+ */
+void checkObservables(const std::vector<std::shared_ptr<ObservableT>> &obs,
+                      size_t num_qubits) {
+    for (const auto &observable : obs) {
+        checkWires(observable->getWires(), num_qubits);
+    }
+}
+
+void checkNumQubits(size_t circuit_qubits, size_t num_qubits) {
+    PL_ABORT_IF_NOT(circuit_qubits == num_qubits,
+                    "The circuit and the state vector have different "
+                    "numbers of qubits.");
+}
+} // namespace
+/// @endcond
+
+namespace Pennylane::LightningQubit::Embed {
+struct Observable::Impl {
+    std::shared_ptr<ObservableT> obs;
+};
+
+struct Circuit::Impl {
+    size_t num_qubits;
+    size_t num_params{0};
+    std::vector<std::string> names;
+    std::vector<std::vector<double>> params;
+    std::vector<std::vector<size_t>> wires;
+    std::vector<bool> inverses;
+    std::vector<std::vector<ComplexT>> matrices;
+
+    [[nodiscard]] auto toOpsData() const -> OpsData<StateVectorT> {
+        return {names, params, wires, inverses, matrices};
+    }
+};
+
+struct BinaryCircuit::Impl {
+    Algorithms::BinaryCircuit<StateVectorT> circuit;
+    std::vector<std::shared_ptr<ObservableT>> observables;
+};
+
+struct StateVector::Impl {
+    StateVectorT sv;
+};
+
+auto libraryVersion() -> std::string { return PL_LQ_LIBRARY_VERSION; }
+
+/* Observable */
+
+Observable::Observable(std::shared_ptr<const Impl> impl)
+    : impl_{std::move(impl)} {}
+
+auto Observable::named(const std::string &name, std::vector<size_t> wires)
+    -> Observable {
+    return translateErrors([&] {
+        return Observable{std::make_shared<const Impl>(Impl{
+            std::make_shared<NamedObs<StateVectorT>>(name, std::move(wires))})};
+    });
+}
+
+auto Observable::hermitian(std::vector<ComplexT> matrix,
+                           std::vector<size_t> wires) -> Observable {
+    return translateErrors([&] {
+        return Observable{std::make_shared<const Impl>(
+            Impl{std::make_shared<HermitianObs<StateVectorT>>(
+                std::move(matrix), std::move(wires))})};
+    });
+}
+
+auto Observable::tensorProduct(const std::vector<Observable> &factors)
+    -> Observable {
+    return translateErrors([&] {
+        std::vector<std::shared_ptr<ObservableT>> obs;
+        for (const auto &factor : factors) {
+            obs.push_back(factor.getImpl().obs);
+        }
+        return Observable{std::make_shared<const Impl>(
+            Impl{TensorProdObs<StateVectorT>::create(std::move(obs))})};
+    });
+}
+
+auto Observable::hamiltonian(std::vector<double> coeffs,
+                             const std::vector<Observable> &terms)
+    -> Observable {
+    return translateErrors([&] {
+        PL_ABORT_IF_NOT(coeffs.size() == terms.size(),
+                        "The number of coefficients and terms must be equal.");
+        std::vector<std::shared_ptr<ObservableT>> obs;
+        for (const auto &term : terms) {
+            obs.push_back(term.getImpl().obs);
+        }
+        return Observable{std::make_shared<const Impl>(
+            Impl{std::make_shared<Hamiltonian<StateVectorT>>(std::move(coeffs),
+                                                             std::move(obs))})};
+    });
+}
+
+auto Observable::sparseHamiltonian(const std::vector<ComplexT> &data,
+                                   const std::vector<size_t> &indices,
+                                   const std::vector<size_t> &offsets,
+                                   std::vector<size_t> wires) -> Observable {
+    return translateErrors([&] {
+        return Observable{std::make_shared<const Impl>(
+            Impl{std::make_shared<SparseHamiltonian<StateVectorT>>(
+                data, indices, offsets, std::move(wires))})};
+    });
+}
+
+auto Observable::getWires() const -> std::vector<size_t> {
+    return impl_->obs->getWires();
+}
+
+auto Observable::getName() const -> std::string {
+    return impl_->obs->getObsName();
+}
+
+auto Observable::getImpl() const -> const Impl & { return *impl_; }
+
+/* Circuit */
+
+Circuit::Circuit(size_t num_qubits)
+    : impl_{std::make_unique<Impl>(Impl{num_qubits, 0, {}, {}, {}, {}, {}})} {}
+Circuit::Circuit(const Circuit &other)
+    : impl_{std::make_unique<Impl>(*other.impl_)} {}
+Circuit::Circuit(Circuit &&other) noexcept = default;
+auto Circuit::operator=(const Circuit &other) -> Circuit & {
+    impl_ = std::make_unique<Impl>(*other.impl_);
+    return *this;
+}
+auto Circuit::operator=(Circuit &&other) noexcept -> Circuit & = default;
+Circuit::~Circuit() = default;
+
+void Circuit::addOperation(const std::string &name, std::vector<size_t> wires,
+                           std::vector<double> params, bool inverse) {
+    translateErrors([&] {
+        checkWires(wires, impl_->num_qubits);
+        impl_->num_params += params.size();
+        impl_->names.push_back(name);
+        impl_->params.push_back(std::move(params));
+        impl_->wires.push_back(std::move(wires));
+        impl_->inverses.push_back(inverse);
+        impl_->matrices.emplace_back();
+    });
+}
+
+void Circuit::addMatrix(std::vector<ComplexT> matrix,
+                        std::vector<size_t> wires, bool inverse) {
+    translateErrors([&] {
+        checkWires(wires, impl_->num_qubits);
+        PL_ABORT_IF_NOT(matrix.size() ==
+                            Pennylane::Util::exp2(2 * wires.size()),
+                        "The size of matrix does not match with the given "
+                        "number of wires");
+        impl_->names.emplace_back("QubitUnitary");
+        impl_->params.emplace_back();
+        impl_->wires.push_back(std::move(wires));
+        impl_->inverses.push_back(inverse);
+        impl_->matrices.push_back(std::move(matrix));
+    });
+}
+
+auto Circuit::getNumQubits() const -> size_t { return impl_->num_qubits; }
+auto Circuit::getNumOperations() const -> size_t {
+    return impl_->names.size();
+}
+auto Circuit::getNumParams() const -> size_t { return impl_->num_params; }
+auto Circuit::getImpl() const -> const Impl & { return *impl_; }
+
+/* BinaryCircuit */
+
+BinaryCircuit::BinaryCircuit(const void *data, size_t size)
+    : impl_{translateErrors([&] {
+          Algorithms::BinaryCircuit<StateVectorT> circuit{
+              {static_cast<const std::byte *>(data), size}};
+          auto observables = circuit.createObservables();
+          return std::make_unique<Impl>(
+              Impl{std::move(circuit), std::move(observables)});
+      })} {}
+BinaryCircuit::BinaryCircuit(BinaryCircuit &&other) noexcept = default;
+auto BinaryCircuit::operator=(BinaryCircuit &&other) noexcept
+    -> BinaryCircuit & = default;
+BinaryCircuit::~BinaryCircuit() = default;
+
+auto BinaryCircuit::getNumQubits() const -> size_t {
+    return impl_->circuit.getView().getNumQubits();
+}
+auto BinaryCircuit::getNumOperations() const -> size_t {
+    return impl_->circuit.getView().numOperations();
+}
+auto BinaryCircuit::getNumObservables() const -> size_t {
+    return impl_->observables.size();
+}
+auto BinaryCircuit::getNumParams() const -> size_t {
+    return impl_->circuit.getView().numParams();
+}
+auto BinaryCircuit::getImpl() const -> const Impl & { return *impl_; }
+
+/* StateVector */
+
+StateVector::StateVector(size_t num_qubits)
+    : impl_{std::make_unique<Impl>(Impl{StateVectorT{num_qubits}})} {}
+StateVector::StateVector(const ComplexT *data, size_t length)
+    : impl_{translateErrors([&] {
+          PL_ABORT_IF_NOT(length > 0 && (length & (length - 1)) == 0,
+                          "The number of amplitudes must be a power of 2.");
+          return std::make_unique<Impl>(Impl{StateVectorT{data, length}});
+      })} {}
+StateVector::StateVector(const StateVector &other)
+    : impl_{std::make_unique<Impl>(*other.impl_)} {}
+StateVector::StateVector(StateVector &&other) noexcept = default;
+auto StateVector::operator=(const StateVector &other) -> StateVector & {
+    impl_ = std::make_unique<Impl>(*other.impl_);
+    return *this;
+}
+auto StateVector::operator=(StateVector &&other) noexcept
+    -> StateVector & = default;
+StateVector::~StateVector() = default;
+
+auto StateVector::getNumQubits() const -> size_t {
+    return impl_->sv.getNumQubits();
+}
+auto StateVector::getLength() const -> size_t {
+    return impl_->sv.getLength();
+}
+auto StateVector::getData() const -> const ComplexT * {
+    return impl_->sv.getData();
+}
+
+void StateVector::reset() {
+    auto *data = impl_->sv.getData();
+    std::fill(data, data + impl_->sv.getLength(), ComplexT{0.0, 0.0});
+    data[0] = {1.0, 0.0};
+}
+
+void StateVector::applyOperation(const std::string &name,
+                                 const std::vector<size_t> &wires,
+                                 const std::vector<double> &params,
+                                 bool inverse) {
+    translateErrors([&] {
+        checkWires(wires, getNumQubits());
+        impl_->sv.applyOperation(name, wires, inverse, params);
+    });
+}
+
+void StateVector::applyMatrix(const std::vector<ComplexT> &matrix,
+                              const std::vector<size_t> &wires, bool inverse) {
+    translateErrors([&] {
+        checkWires(wires, getNumQubits());
+        impl_->sv.applyMatrix(matrix, wires, inverse);
+    });
+}
+
+void StateVector::applyCircuit(const Circuit &circuit) {
+    translateErrors([&] {
+        const auto &ops = circuit.getImpl();
+        checkNumQubits(ops.num_qubits, getNumQubits());
+        for (size_t i = 0; i < ops.names.size(); i++) {
+            if (ops.matrices[i].empty()) {
+                impl_->sv.applyOperation(ops.names[i], ops.wires[i],
+                                         ops.inverses[i], ops.params[i]);
+            } else {
+                impl_->sv.applyMatrix(ops.matrices[i], ops.wires[i],
+                                      ops.inverses[i]);
+            }
+        }
+    });
+}
+
+void StateVector::applyCircuit(const BinaryCircuit &circuit) {
+    translateErrors([&] { circuit.getImpl().circuit.applyTo(impl_->sv); });
+}
+
+auto StateVector::expval(const Observable &observable) const -> double {
+    return translateErrors([&] {
+        checkObservables({observable.getImpl().obs}, getNumQubits());
+        Measurements<StateVectorT> measure{impl_->sv};
+        return measure.expval(*observable.getImpl().obs);
+    });
+}
+
+auto StateVector::var(const Observable &observable) const -> double {
+    return translateErrors([&] {
+        checkObservables({observable.getImpl().obs}, getNumQubits());
+        Measurements<StateVectorT> measure{impl_->sv};
+        return measure.var(*observable.getImpl().obs);
+    });
+}
+
+auto StateVector::expvals(const BinaryCircuit &circuit) const
+    -> std::vector<double> {
+    return translateErrors([&] {
+        checkObservables(circuit.getImpl().observables, getNumQubits());
+        Measurements<StateVectorT> measure{impl_->sv};
+        std::vector<double> result;
+        result.reserve(circuit.getNumObservables());
+        for (const auto &obs : circuit.getImpl().observables) {
+            result.push_back(measure.expval(*obs));
+        }
+        return result;
+    });
+}
+
+auto StateVector::probs(const std::vector<size_t> &wires) const
+    -> std::vector<double> {
+    return translateErrors([&] {
+        checkWires(wires, getNumQubits());
+        Measurements<StateVectorT> measure{impl_->sv};
+        return wires.empty() ? measure.probs() : measure.probs(wires);
+    });
+}
+
+auto StateVector::generateSamples(size_t num_samples) const
+    -> std::vector<size_t> {
+    return translateErrors([&] {
+        Measurements<StateVectorT> measure{impl_->sv};
+        return measure.generate_samples(num_samples);
+    });
+}
+
+auto StateVector::getImpl() const -> const Impl & { return *impl_; }
+
+/* Differentiation */
+
+/// @cond DEV
+namespace {
+template <class CircuitT>
+auto allParams(const CircuitT &circuit, const std::vector<size_t> &trainable)
+    -> std::vector<size_t> {
+    if (!trainable.empty()) {
+        return trainable;
+    }
+    std::vector<size_t> all(circuit.getNumParams());
+    std::iota(all.begin(), all.end(), 0);
+    return all;
+}
+
+/**
+ * @brief Adjoint Jacobian with one row of derivatives per observable.
+ */
+auto adjointJacobianRows(const StateVectorT &sv, size_t num_params,
+                         OpsData<StateVectorT> ops,
+                         std::vector<std::shared_ptr<ObservableT>> obs,
+                         std::vector<size_t> trainable) -> std::vector<double> {
+    const size_t num_obs = obs.size();
+    const size_t num_trainable = trainable.size();
+    const JacobianData<StateVectorT> jd{num_params,     sv.getLength(),
+                                        sv.getData(),   std::move(obs),
+                                        std::move(ops), std::move(trainable)};
+
+    // The adjoint method returns one row per trainable parameter
+    std::vector<double> jac(num_obs * num_trainable, 0.0);
+    AdjointJacobian<StateVectorT> adjoint;
+    adjoint.adjointJacobian(std::span{jac}, jd, sv);
+
+    std::vector<double> result(jac.size());
+    for (size_t p = 0; p < num_trainable; p++) {
+        for (size_t o = 0; o < num_obs; o++) {
+            result[o * num_trainable + p] = jac[p * num_obs + o];
+        }
+    }
+    return result;
+}
+} // namespace
+/// @endcond
+
+auto adjointJacobian(const StateVector &state, const Circuit &circuit,
+                     const std::vector<Observable> &observables,
+                     const std::vector<size_t> &trainable_params)
+    -> std::vector<double> {
+    return translateErrors([&] {
+        const size_t num_qubits = state.getNumQubits();
+        checkNumQubits(circuit.getNumQubits(), num_qubits);
+        std::vector<std::shared_ptr<ObservableT>> obs;
+        for (const auto &observable : observables) {
+            obs.push_back(observable.getImpl().obs);
+        }
+        checkObservables(obs, num_qubits);
+        return adjointJacobianRows(state.getImpl().sv, circuit.getNumParams(),
+                                   circuit.getImpl().toOpsData(),
+                                   std::move(obs),
+                                   allParams(circuit, trainable_params));
+    });
+}
+
+auto adjointJacobian(const StateVector &state, const BinaryCircuit &circuit,
+                     const std::vector<size_t> &trainable_params)
+    -> std::vector<double> {
+    return translateErrors([&] {
+        const auto &impl = circuit.getImpl();
+        checkNumQubits(circuit.getNumQubits(), state.getNumQubits());
+        return adjointJacobianRows(state.getImpl().sv, circuit.getNumParams(),
+                                   impl.circuit.toOpsData(), impl.observables,
+                                   allParams(circuit, trainable_params));
+    });
+}
+
+auto vectorJacobianProduct(const StateVector &state, const Circuit &circuit,
+                           const std::vector<ComplexT> &dy,
+                           const std::vector<size_t> &trainable_params)
+    -> std::vector<ComplexT> {
+    return translateErrors([&] {
+        const auto &sv = state.getImpl().sv;
+        checkNumQubits(circuit.getNumQubits(), sv.getNumQubits());
+        PL_ABORT_IF_NOT(dy.size() == sv.getLength(),
+                        "The cotangent vector and the state vector have "
+                        "different sizes.");
+        const auto trainable = allParams(circuit, trainable_params);
+        const JacobianData<StateVectorT> jd{
+            circuit.getNumParams(), sv.getLength(), sv.getData(), {},
+            circuit.getImpl().toOpsData(), trainable};
+
+        std::vector<ComplexT> vjp(trainable.size());
+        VectorJacobianProduct<StateVectorT> calculate_vjp;
+        calculate_vjp(std::span{vjp}, jd, std::span{dy});
+        return vjp;
+    });
+}
+} // namespace Pennylane::LightningQubit::Embed
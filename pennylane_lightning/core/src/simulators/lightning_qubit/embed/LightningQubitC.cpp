@@ -0,0 +1,476 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "pennylane_lightning/LightningQubit.hpp"
+#include "pennylane_lightning/lightning_qubit.h"
+
+using Pennylane::LightningQubit::Embed::BinaryCircuit;
+using Pennylane::LightningQubit::Embed::Circuit;
+using Pennylane::LightningQubit::Embed::ComplexT;
+using Pennylane::LightningQubit::Embed::Observable;
+using Pennylane::LightningQubit::Embed::StateVector;
+
+struct pl_lq_state {
+    StateVector sv;
+};
+struct pl_lq_observable {
+    Observable obs;
+};
+struct pl_lq_circuit {
+    Circuit circuit;
+};
+struct pl_lq_binary_circuit {
+    BinaryCircuit circuit;
+};
+
+/// @cond DEV
+namespace {
+thread_local std::string last_error;
+
+/**
+ * @brief Run a function and turn its exceptions into a failure status.
+ */
+template <class FuncT> auto guard(FuncT &&func) noexcept -> pl_lq_status {
+    try {
+        func();
+        return PL_LQ_SUCCESS;
+    } catch (const std::exception &e) {
+        last_error = e.what();
+    } catch (...) {
+        last_error = "Unknown error.";
+    }
+    return PL_LQ_FAILURE;
+}
+
+void checkNotNull(const void *ptr, const char *name) {
+    if (ptr == nullptr) {
+        throw std::invalid_argument(std::string("The argument ") + name +
+                                    " must not be null.");
+    }
+}
+
+/**
+ * @brief Check the length of a caller-provided buffer against the size of the
+ * result written to it.
+ */
+void checkLength(size_t length, size_t expected, const char *what) {
+    if (length != expected) {
+        throw std::invalid_argument(
+            std::string("The length does not match with ") + what + ".");
+    }
+}
+
+/**
+ * @brief Number of trainable parameters, where none means all parameters of
+ * the circuit.
+ */
+template <class CircuitT>
+auto numTrainable(const CircuitT &circuit, size_t num_trainable) -> size_t {
+    return (num_trainable == 0) ? circuit.getNumParams() : num_trainable;
+}
+
+auto toComplex(const double *data, size_t length) -> std::vector<ComplexT> {
+    std::vector<ComplexT> result(length);
+    for (size_t i = 0; i < length; i++) {
+        result[i] = {data[2 * i], data[2 * i + 1]};
+    }
+    return result;
+}
+
+void fromComplex(const ComplexT *data, size_t length, double *result) {
+    for (size_t i = 0; i < length; i++) {
+        result[2 * i] = data[i].real();
+        result[2 * i + 1] = data[i].imag();
+    }
+}
+
+template <class T>
+auto toVector(const T *data, size_t length) -> std::vector<T> {
+    return (length == 0) ? std::vector<T>{}
+                         : std::vector<T>(data, data + length);
+}
+
+auto matrixSize(size_t num_wires) -> size_t {
+    return size_t{1} << (2 * num_wires);
+}
+
+auto toObservables(const pl_lq_observable *const *observables, size_t length)
+    -> std::vector<Observable> {
+    std::vector<Observable> result;
+    result.reserve(length);
+    for (size_t i = 0; i < length; i++) {
+        checkNotNull(observables[i], "observables");
+        result.push_back(observables[i]->obs);
+    }
+    return result;
+}
+
+auto newObservable(Observable obs) -> pl_lq_observable * {
+    return new pl_lq_observable{std::move(obs)};
+}
+} // namespace
+/// @endcond
+
+extern "C" {
+int pl_lq_api_version(void) {
+    return PL_LQ_API_VERSION_MAJOR * 1000 + PL_LQ_API_VERSION_MINOR;
+}
+
+const char *pl_lq_library_version(void) { return PL_LQ_LIBRARY_VERSION; }
+
+const char *pl_lq_last_error(void) { return last_error.c_str(); }
+
+/* State vectors */
+
+pl_lq_status pl_lq_state_create(size_t num_qubits, pl_lq_state **state) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        *state = new pl_lq_state{StateVector{num_qubits}};
+    });
+}
+
+pl_lq_status pl_lq_state_create_from(const double *amplitudes, size_t length,
+                                     pl_lq_state **state) {
+    return guard([&] {
+        checkNotNull(amplitudes, "amplitudes");
+        checkNotNull(state, "state");
+        const auto data = toComplex(amplitudes, length);
+        *state = new pl_lq_state{StateVector{data.data(), length}};
+    });
+}
+
+void pl_lq_state_destroy(pl_lq_state *state) { delete state; }
+
+size_t pl_lq_state_num_qubits(const pl_lq_state *state) {
+    return (state == nullptr) ? 0 : state->sv.getNumQubits();
+}
+
+pl_lq_status pl_lq_state_reset(pl_lq_state *state) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        state->sv.reset();
+    });
+}
+
+pl_lq_status pl_lq_state_get(const pl_lq_state *state, double *amplitudes,
+                             size_t length) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(amplitudes, "amplitudes");
+        checkLength(length, state->sv.getLength(), "the state vector");
+        fromComplex(state->sv.getData(), length, amplitudes);
+    });
+}
+
+pl_lq_status pl_lq_state_apply_operation(pl_lq_state *state, const char *name,
+                                         const size_t *wires, size_t num_wires,
+                                         const double *params,
+                                         size_t num_params, int inverse) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(name, "name");
+        state->sv.applyOperation(name, toVector(wires, num_wires),
+                                 toVector(params, num_params), inverse != 0);
+    });
+}
+
+pl_lq_status pl_lq_state_apply_matrix(pl_lq_state *state, const double *matrix,
+                                      const size_t *wires, size_t num_wires,
+                                      int inverse) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(matrix, "matrix");
+        state->sv.applyMatrix(toComplex(matrix, matrixSize(num_wires)),
+                              toVector(wires, num_wires), inverse != 0);
+    });
+}
+
+pl_lq_status pl_lq_state_apply_circuit(pl_lq_state *state,
+                                       const pl_lq_circuit *circuit) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(circuit, "circuit");
+        state->sv.applyCircuit(circuit->circuit);
+    });
+}
+
+/* Measurements */
+
+pl_lq_status pl_lq_expval(const pl_lq_state *state,
+                          const pl_lq_observable *observable, double *result) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(observable, "observable");
+        checkNotNull(result, "result");
+        *result = state->sv.expval(observable->obs);
+    });
+}
+
+pl_lq_status pl_lq_var(const pl_lq_state *state,
+                       const pl_lq_observable *observable, double *result) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(observable, "observable");
+        checkNotNull(result, "result");
+        *result = state->sv.var(observable->obs);
+    });
+}
+
+pl_lq_status pl_lq_probs(const pl_lq_state *state, const size_t *wires,
+                         size_t num_wires, double *probs, size_t length) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(probs, "probs");
+        const auto result = state->sv.probs(toVector(wires, num_wires));
+        checkLength(length, result.size(), "the number of wires");
+        std::copy(result.begin(), result.end(), probs);
+    });
+}
+
+pl_lq_status pl_lq_generate_samples(const pl_lq_state *state,
+                                    size_t num_samples, size_t *samples,
+                                    size_t length) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(samples, "samples");
+        checkLength(length, num_samples * state->sv.getNumQubits(),
+                    "the number of samples and qubits");
+        const auto result = state->sv.generateSamples(num_samples);
+        std::copy(result.begin(), result.end(), samples);
+    });
+}
+
+/* Observables */
+
+pl_lq_status pl_lq_observable_named(const char *name, const size_t *wires,
+                                    size_t num_wires,
+                                    pl_lq_observable **observable) {
+    return guard([&] {
+        checkNotNull(name, "name");
+        checkNotNull(observable, "observable");
+        *observable = newObservable(
+            Observable::named(name, toVector(wires, num_wires)));
+    });
+}
+
+pl_lq_status pl_lq_observable_hermitian(const double *matrix,
+                                        const size_t *wires, size_t num_wires,
+                                        pl_lq_observable **observable) {
+    return guard([&] {
+        checkNotNull(matrix, "matrix");
+        checkNotNull(observable, "observable");
+        *observable = newObservable(
+            Observable::hermitian(toComplex(matrix, matrixSize(num_wires)),
+                                  toVector(wires, num_wires)));
+    });
+}
+
+pl_lq_status
+pl_lq_observable_tensor_product(const pl_lq_observable *const *factors,
+                                size_t num_factors,
+                                pl_lq_observable **observable) {
+    return guard([&] {
+        checkNotNull(factors, "factors");
+        checkNotNull(observable, "observable");
+        *observable = newObservable(
+            Observable::tensorProduct(toObservables(factors, num_factors)));
+    });
+}
+
+pl_lq_status pl_lq_observable_hamiltonian(const double *coeffs,
+                                          const pl_lq_observable *const *terms,
+                                          size_t num_terms,
+                                          pl_lq_observable **observable) {
+    return guard([&] {
+        checkNotNull(coeffs, "coeffs");
+        checkNotNull(terms, "terms");
+        checkNotNull(observable, "observable");
+        *observable = newObservable(
+            Observable::hamiltonian(toVector(coeffs, num_terms),
+                                    toObservables(terms, num_terms)));
+    });
+}
+
+pl_lq_status pl_lq_observable_sparse_hamiltonian(
+    const double *data, const size_t *indices, size_t num_nonzeros,
+    const size_t *offsets, size_t num_offsets, const size_t *wires,
+    size_t num_wires, pl_lq_observable **observable) {
+    return guard([&] {
+        checkNotNull(offsets, "offsets");
+        checkNotNull(observable, "observable");
+        *observable = newObservable(Observable::sparseHamiltonian(
+            toComplex(data, num_nonzeros), toVector(indices, num_nonzeros),
+            toVector(offsets, num_offsets), toVector(wires, num_wires)));
+    });
+}
+
+void pl_lq_observable_destroy(pl_lq_observable *observable) {
+    delete observable;
+}
+
+/* Circuits */
+
+pl_lq_status pl_lq_circuit_create(size_t num_qubits, pl_lq_circuit **circuit) {
+    return guard([&] {
+        checkNotNull(circuit, "circuit");
+        *circuit = new pl_lq_circuit{Circuit{num_qubits}};
+    });
+}
+
+void pl_lq_circuit_destroy(pl_lq_circuit *circuit) { delete circuit; }
+
+size_t pl_lq_circuit_num_params(const pl_lq_circuit *circuit) {
+    return (circuit == nullptr) ? 0 : circuit->circuit.getNumParams();
+}
+
+pl_lq_status pl_lq_circuit_add_operation(pl_lq_circuit *circuit,
+                                         const char *name, const size_t *wires,
+                                         size_t num_wires, const double *params,
+                                         size_t num_params, int inverse) {
+    return guard([&] {
+        checkNotNull(circuit, "circuit");
+        checkNotNull(name, "name");
+        circuit->circuit.addOperation(name, toVector(wires, num_wires),
+                                      toVector(params, num_params),
+                                      inverse != 0);
+    });
+}
+
+pl_lq_status pl_lq_circuit_add_matrix(pl_lq_circuit *circuit,
+                                      const double *matrix,
+                                      const size_t *wires, size_t num_wires,
+                                      int inverse) {
+    return guard([&] {
+        checkNotNull(circuit, "circuit");
+        checkNotNull(matrix, "matrix");
+        circuit->circuit.addMatrix(toComplex(matrix, matrixSize(num_wires)),
+                                   toVector(wires, num_wires), inverse != 0);
+    });
+}
+
+/* Binary circuits */
+
+pl_lq_status pl_lq_binary_circuit_load(const void *data, size_t size,
+                                       pl_lq_binary_circuit **circuit) {
+    return guard([&] {
+        checkNotNull(data, "data");
+        checkNotNull(circuit, "circuit");
+        *circuit = new pl_lq_binary_circuit{BinaryCircuit{data, size}};
+    });
+}
+
+void pl_lq_binary_circuit_destroy(pl_lq_binary_circuit *circuit) {
+    delete circuit;
+}
+
+size_t
+pl_lq_binary_circuit_num_observables(const pl_lq_binary_circuit *circuit) {
+    return (circuit == nullptr) ? 0 : circuit->circuit.getNumObservables();
+}
+
+size_t pl_lq_binary_circuit_num_params(const pl_lq_binary_circuit *circuit) {
+    return (circuit == nullptr) ? 0 : circuit->circuit.getNumParams();
+}
+
+pl_lq_status
+pl_lq_state_apply_binary_circuit(pl_lq_state *state,
+                                 const pl_lq_binary_circuit *circuit) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(circuit, "circuit");
+        state->sv.applyCircuit(circuit->circuit);
+    });
+}
+
+pl_lq_status pl_lq_binary_circuit_expvals(const pl_lq_state *state,
+                                          const pl_lq_binary_circuit *circuit,
+                                          double *results, size_t length) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(circuit, "circuit");
+        checkNotNull(results, "results");
+        checkLength(length, circuit->circuit.getNumObservables(),
+                    "the number of observables");
+        const auto result = state->sv.expvals(circuit->circuit);
+        std::copy(result.begin(), result.end(), results);
+    });
+}
+
+pl_lq_status pl_lq_binary_circuit_adjoint_jacobian(
+    const pl_lq_state *state, const pl_lq_binary_circuit *circuit,
+    const size_t *trainable_params, size_t num_trainable, double *jacobian,
+    size_t length) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(circuit, "circuit");
+        checkNotNull(jacobian, "jacobian");
+        checkLength(length,
+                    circuit->circuit.getNumObservables() *
+                        numTrainable(circuit->circuit, num_trainable),
+                    "the number of observables and trainable parameters");
+        const auto result = Pennylane::LightningQubit::Embed::adjointJacobian(
+            state->sv, circuit->circuit,
+            toVector(trainable_params, num_trainable));
+        std::copy(result.begin(), result.end(), jacobian);
+    });
+}
+
+/* Differentiation */
+
+pl_lq_status pl_lq_adjoint_jacobian(
+    const pl_lq_state *state, const pl_lq_circuit *circuit,
+    const pl_lq_observable *const *observables, size_t num_observables,
+    const size_t *trainable_params, size_t num_trainable, double *jacobian,
+    size_t length) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(circuit, "circuit");
+        checkNotNull(observables, "observables");
+        checkNotNull(jacobian, "jacobian");
+        checkLength(length,
+                    num_observables *
+                        numTrainable(circuit->circuit, num_trainable),
+                    "the number of observables and trainable parameters");
+        const auto result = Pennylane::LightningQubit::Embed::adjointJacobian(
+            state->sv, circuit->circuit,
+            toObservables(observables, num_observables),
+            toVector(trainable_params, num_trainable));
+        std::copy(result.begin(), result.end(), jacobian);
+    });
+}
+
+pl_lq_status pl_lq_vector_jacobian_product(
+    const pl_lq_state *state, const pl_lq_circuit *circuit, const double *dy,
+    size_t length, const size_t *trainable_params, size_t num_trainable,
+    double *vjp, size_t vjp_length) {
+    return guard([&] {
+        checkNotNull(state, "state");
+        checkNotNull(circuit, "circuit");
+        checkNotNull(dy, "dy");
+        checkNotNull(vjp, "vjp");
+        checkLength(vjp_length, numTrainable(circuit->circuit, num_trainable),
+                    "the number of trainable parameters");
+        const auto result =
+            Pennylane::LightningQubit::Embed::vectorJacobianProduct(
+                state->sv, circuit->circuit, toComplex(dy, length),
+                toVector(trainable_params, num_trainable));
+        fromComplex(result.data(), result.size(), vjp);
+    });
+}
+} // extern "C"
@@ -0,0 +1,268 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file LightningQubit.hpp
+ * @brief C++ interface of the Lightning-Qubit embedding library.
+ *
+ * The classes of this header only hold a pointer to their implementation, so
+ * the header does not depend on the simulator templates and stays stable
+ * across releases with the same `PL_LQ_API_VERSION_MAJOR`. All computations
+ * are in double precision, and failures are reported as `Embed::Error`.
+ */
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "lightning_qubit.h"
+
+namespace Pennylane::LightningQubit::Embed {
+using ComplexT = std::complex<double>;
+
+/// Major version of the embedding API.
+inline constexpr int api_version_major = PL_LQ_API_VERSION_MAJOR;
+/// Minor version of the embedding API.
+inline constexpr int api_version_minor = PL_LQ_API_VERSION_MINOR;
+
+/**
+ * @brief Error raised by the embedding library.
+ */
+class PL_LQ_API Error : public std::runtime_error {
+  public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief Version of the PennyLane-Lightning release.
+ */
+PL_LQ_API auto libraryVersion() -> std::string;
+
+/**
+ * @brief Immutable observable. Copies share the same implementation.
+ */
+class PL_LQ_API Observable {
+  public:
+    struct Impl;
+
+    /**
+     * @brief Named observable, e.g. `PauliZ`.
+     */
+    static auto named(const std::string &name, std::vector<size_t> wires)
+        -> Observable;
+    /**
+     * @brief Hermitian observable given by its row-major matrix.
+     */
+    static auto hermitian(std::vector<ComplexT> matrix,
+                          std::vector<size_t> wires) -> Observable;
+    static auto tensorProduct(const std::vector<Observable> &factors)
+        -> Observable;
+    static auto hamiltonian(std::vector<double> coeffs,
+                            const std::vector<Observable> &terms)
+        -> Observable;
+    /**
+     * @brief Hamiltonian given by its sparse matrix in CSR format over all
+     * wires.
+     */
+    static auto sparseHamiltonian(const std::vector<ComplexT> &data,
+                                  const std::vector<size_t> &indices,
+                                  const std::vector<size_t> &offsets,
+                                  std::vector<size_t> wires) -> Observable;
+
+    [[nodiscard]] auto getWires() const -> std::vector<size_t>;
+    [[nodiscard]] auto getName() const -> std::string;
+    [[nodiscard]] auto getImpl() const -> const Impl &;
+
+  private:
+    std::shared_ptr<const Impl> impl_;
+
+    explicit Observable(std::shared_ptr<const Impl> impl);
+};
+
+/**
+ * @brief List of operations, with at most one parameter each for
+ * differentiation.
+ */
+class PL_LQ_API Circuit {
+  public:
+    struct Impl;
+
+    explicit Circuit(size_t num_qubits);
+    Circuit(const Circuit &other);
+    Circuit(Circuit &&other) noexcept;
+    auto operator=(const Circuit &other) -> Circuit &;
+    auto operator=(Circuit &&other) noexcept -> Circuit &;
+    ~Circuit();
+
+    /**
+     * @brief Append a gate given by its name, e.g. `RX`.
+     */
+    void addOperation(const std::string &name, std::vector<size_t> wires,
+                      std::vector<double> params = {}, bool inverse = false);
+    /**
+     * @brief Append a gate given by its row-major matrix.
+     */
+    void addMatrix(std::vector<ComplexT> matrix, std::vector<size_t> wires,
+                   bool inverse = false);
+
+    [[nodiscard]] auto getNumQubits() const -> size_t;
+    [[nodiscard]] auto getNumOperations() const -> size_t;
+    /**
+     * @brief Number of parameters of the circuit, in the order used by the
+     * trainable parameter indices.
+     */
+    [[nodiscard]] auto getNumParams() const -> size_t;
+    [[nodiscard]] auto getImpl() const -> const Impl &;
+
+  private:
+    std::unique_ptr<Impl> impl_;
+};
+
+/**
+ * @brief Circuit in the binary circuit format, with its observables.
+ *
+ * The operations are read in place from the buffer, e.g. a memory-mapped
+ * file, which must outlive the circuit and be aligned to 8 bytes.
+ */
+class PL_LQ_API BinaryCircuit {
+  public:
+    struct Impl;
+
+    BinaryCircuit(const void *data, size_t size);
+    BinaryCircuit(BinaryCircuit &&other) noexcept;
+    auto operator=(BinaryCircuit &&other) noexcept -> BinaryCircuit &;
+    ~BinaryCircuit();
+
+    [[nodiscard]] auto getNumQubits() const -> size_t;
+    [[nodiscard]] auto getNumOperations() const -> size_t;
+    [[nodiscard]] auto getNumObservables() const -> size_t;
+    [[nodiscard]] auto getNumParams() const -> size_t;
+    [[nodiscard]] auto getImpl() const -> const Impl &;
+
+  private:
+    std::unique_ptr<Impl> impl_;
+};
+
+/**
+ * @brief State vector of double precision.
+ */
+class PL_LQ_API StateVector {
+  public:
+    struct Impl;
+
+    /**
+     * @brief Create the state `|0...0>`.
+     */
+    explicit StateVector(size_t num_qubits);
+    /**
+     * @brief Create a state from `length` amplitudes, a power of two.
+     */
+    StateVector(const ComplexT *data, size_t length);
+    StateVector(const StateVector &other);
+    StateVector(StateVector &&other) noexcept;
+    auto operator=(const StateVector &other) -> StateVector &;
+    auto operator=(StateVector &&other) noexcept -> StateVector &;
+    ~StateVector();
+
+    [[nodiscard]] auto getNumQubits() const -> size_t;
+    [[nodiscard]] auto getLength() const -> size_t;
+    [[nodiscard]] auto getData() const -> const ComplexT *;
+
+    /**
+     * @brief Reset the state to `|0...0>`.
+     */
+    void reset();
+    void applyOperation(const std::string &name,
+                        const std::vector<size_t> &wires,
+                        const std::vector<double> &params = {},
+                        bool inverse = false);
+    void applyMatrix(const std::vector<ComplexT> &matrix,
+                     const std::vector<size_t> &wires, bool inverse = false);
+    void applyCircuit(const Circuit &circuit);
+    void applyCircuit(const BinaryCircuit &circuit);
+
+    [[nodiscard]] auto expval(const Observable &observable) const -> double;
+    [[nodiscard]] auto var(const Observable &observable) const -> double;
+    /**
+     * @brief Expectation values of the observables of a binary circuit.
+     */
+    [[nodiscard]] auto expvals(const BinaryCircuit &circuit) const
+        -> std::vector<double>;
+    /**
+     * @brief Probabilities of the basis states of the wires, or of all wires
+     * when none is given.
+     */
+    [[nodiscard]] auto probs(const std::vector<size_t> &wires = {}) const
+        -> std::vector<double>;
+    /**
+     * @brief Samples as `num_samples` rows of `getNumQubits()` bits.
+     */
+    [[nodiscard]] auto generateSamples(size_t num_samples) const
+        -> std::vector<size_t>;
+    [[nodiscard]] auto getImpl() const -> const Impl &;
+
+  private:
+    std::unique_ptr<Impl> impl_;
+};
+
+/**
+ * @brief Adjoint Jacobian of the expectation values of observables.
+ *
+ * @param state State after the circuit.
+ * @param circuit Circuit which prepared the state.
+ * @param observables Observables to differentiate.
+ * @param trainable_params Indices of the trainable parameters, sorted, or all
+ * parameters when empty.
+ * @return One row of derivatives per observable.
+ */
+PL_LQ_API auto adjointJacobian(const StateVector &state,
+                               const Circuit &circuit,
+                               const std::vector<Observable> &observables,
+                               const std::vector<size_t> &trainable_params = {})
+    -> std::vector<double>;
+
+/**
+ * @brief Adjoint Jacobian of the expectation values of the observables of a
+ * binary circuit.
+ *
+ * @param state State after the circuit.
+ * @param circuit Binary circuit which prepared the state.
+ * @param trainable_params Indices of the trainable parameters, sorted, or all
+ * parameters when empty.
+ * @return One row of derivatives per observable.
+ */
+PL_LQ_API auto adjointJacobian(const StateVector &state,
+                               const BinaryCircuit &circuit,
+                               const std::vector<size_t> &trainable_params = {})
+    -> std::vector<double>;
+
+/**
+ * @brief Vector-Jacobian product `<dy|d psi / d theta_j>` of a state.
+ *
+ * @param state State after the circuit.
+ * @param circuit Circuit which prepared the state.
+ * @param dy Cotangent vector of the state.
+ * @param trainable_params Indices of the trainable parameters, sorted, or all
+ * parameters when empty.
+ * @return One value per trainable parameter.
+ */
+PL_LQ_API auto
+vectorJacobianProduct(const StateVector &state, const Circuit &circuit,
+                      const std::vector<ComplexT> &dy,
+                      const std::vector<size_t> &trainable_params = {})
+    -> std::vector<ComplexT>;
+} // namespace Pennylane::LightningQubit::Embed
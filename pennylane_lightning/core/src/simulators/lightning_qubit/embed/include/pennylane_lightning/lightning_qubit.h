@@ -0,0 +1,208 @@
+/* Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+
+ *     http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file lightning_qubit.h
+ * @brief C interface of the Lightning-Qubit embedding library.
+ *
+ * Every function returning a `pl_lq_status` reports failures through
+ * `PL_LQ_FAILURE`, with the message of the last failure of the calling thread
+ * available from `pl_lq_last_error`. Complex numbers are passed as
+ * interleaved pairs of doubles `(re, im)`. Objects created by the library are
+ * owned by the caller and released with the matching `_destroy` function.
+ *
+ * Functions writing to a caller-provided buffer take its length, in numbers
+ * of the buffer's element type, and fail unless it matches the size of the
+ * result. When differentiating, an empty list of trainable parameters
+ * (`num_trainable == 0`) selects all parameters of the circuit, as counted by
+ * `pl_lq_circuit_num_params` and `pl_lq_binary_circuit_num_params`.
+ */
+#ifndef PENNYLANE_LIGHTNING_QUBIT_H
+#define PENNYLANE_LIGHTNING_QUBIT_H
+
+#include <stddef.h>
+
+/* The major version changes with any incompatible change of this interface
+ * or of LightningQubit.hpp, the minor version with additions. */
+#define PL_LQ_API_VERSION_MAJOR 2
+#define PL_LQ_API_VERSION_MINOR 0
+
+#if defined(_WIN32)
+#if defined(PL_LQ_EMBED_BUILD)
+#define PL_LQ_API __declspec(dllexport)
+#else
+#define PL_LQ_API __declspec(dllimport)
+#endif
+#else
+#define PL_LQ_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum pl_lq_status { PL_LQ_SUCCESS = 0, PL_LQ_FAILURE = 1 } pl_lq_status;
+
+/** State vector of double precision. */
+typedef struct pl_lq_state pl_lq_state;
+/** Immutable observable. */
+typedef struct pl_lq_observable pl_lq_observable;
+/** List of operations, applied to states or differentiated. */
+typedef struct pl_lq_circuit pl_lq_circuit;
+/** Circuit in the binary circuit format, with its observables. */
+typedef struct pl_lq_binary_circuit pl_lq_binary_circuit;
+
+/** API version of the library, as `major * 1000 + minor`. */
+PL_LQ_API int pl_lq_api_version(void);
+/** Version of the PennyLane-Lightning release. */
+PL_LQ_API const char *pl_lq_library_version(void);
+/** Message of the last failure of the calling thread. */
+PL_LQ_API const char *pl_lq_last_error(void);
+
+/* State vectors */
+PL_LQ_API pl_lq_status pl_lq_state_create(size_t num_qubits,
+                                          pl_lq_state **state);
+PL_LQ_API pl_lq_status pl_lq_state_create_from(const double *amplitudes,
+                                               size_t length,
+                                               pl_lq_state **state);
+PL_LQ_API void pl_lq_state_destroy(pl_lq_state *state);
+PL_LQ_API size_t pl_lq_state_num_qubits(const pl_lq_state *state);
+PL_LQ_API pl_lq_status pl_lq_state_reset(pl_lq_state *state);
+/** Copy the `length` amplitudes of the state to `amplitudes`. */
+PL_LQ_API pl_lq_status pl_lq_state_get(const pl_lq_state *state,
+                                       double *amplitudes, size_t length);
+PL_LQ_API pl_lq_status pl_lq_state_apply_operation(
+    pl_lq_state *state, const char *name, const size_t *wires,
+    size_t num_wires, const double *params, size_t num_params, int inverse);
+PL_LQ_API pl_lq_status pl_lq_state_apply_matrix(pl_lq_state *state,
+                                                const double *matrix,
+                                                const size_t *wires,
+                                                size_t num_wires, int inverse);
+PL_LQ_API pl_lq_status pl_lq_state_apply_circuit(pl_lq_state *state,
+                                                 const pl_lq_circuit *circuit);
+
+/* Measurements */
+PL_LQ_API pl_lq_status pl_lq_expval(const pl_lq_state *state,
+                                    const pl_lq_observable *observable,
+                                    double *result);
+PL_LQ_API pl_lq_status pl_lq_var(const pl_lq_state *state,
+                                 const pl_lq_observable *observable,
+                                 double *result);
+/** Probabilities of the `2^num_wires` basis states of the wires. */
+PL_LQ_API pl_lq_status pl_lq_probs(const pl_lq_state *state,
+                                   const size_t *wires, size_t num_wires,
+                                   double *probs, size_t length);
+/**
+ * Samples as `num_samples` rows of `num_qubits` bits, where `length` is
+ * `num_samples * num_qubits`.
+ */
+PL_LQ_API pl_lq_status pl_lq_generate_samples(const pl_lq_state *state,
+                                              size_t num_samples,
+                                              size_t *samples, size_t length);
+
+/* Observables */
+PL_LQ_API pl_lq_status pl_lq_observable_named(const char *name,
+                                              const size_t *wires,
+                                              size_t num_wires,
+                                              pl_lq_observable **observable);
+PL_LQ_API pl_lq_status pl_lq_observable_hermitian(
+    const double *matrix, const size_t *wires, size_t num_wires,
+    pl_lq_observable **observable);
+PL_LQ_API pl_lq_status
+pl_lq_observable_tensor_product(const pl_lq_observable *const *factors,
+                                size_t num_factors,
+                                pl_lq_observable **observable);
+PL_LQ_API pl_lq_status pl_lq_observable_hamiltonian(
+    const double *coeffs, const pl_lq_observable *const *terms,
+    size_t num_terms, pl_lq_observable **observable);
+PL_LQ_API pl_lq_status pl_lq_observable_sparse_hamiltonian(
+    const double *data, const size_t *indices, size_t num_nonzeros,
+    const size_t *offsets, size_t num_offsets, const size_t *wires,
+    size_t num_wires, pl_lq_observable **observable);
+PL_LQ_API void pl_lq_observable_destroy(pl_lq_observable *observable);
+
+/* Circuits */
+PL_LQ_API pl_lq_status pl_lq_circuit_create(size_t num_qubits,
+                                            pl_lq_circuit **circuit);
+PL_LQ_API void pl_lq_circuit_destroy(pl_lq_circuit *circuit);
+/** Number of parameters of the circuit, in the order of the trainable
+ * parameter indices. */
+PL_LQ_API size_t pl_lq_circuit_num_params(const pl_lq_circuit *circuit);
+PL_LQ_API pl_lq_status pl_lq_circuit_add_operation(
+    pl_lq_circuit *circuit, const char *name, const size_t *wires,
+    size_t num_wires, const double *params, size_t num_params, int inverse);
+PL_LQ_API pl_lq_status pl_lq_circuit_add_matrix(pl_lq_circuit *circuit,
+                                                const double *matrix,
+                                                const size_t *wires,
+                                                size_t num_wires, int inverse);
+
+/* Binary circuits */
+/**
+ * Load a binary circuit of `size` bytes. The buffer is read in place, so it
+ * must outlive the circuit and be aligned to 8 bytes.
+ */
+PL_LQ_API pl_lq_status pl_lq_binary_circuit_load(
+    const void *data, size_t size, pl_lq_binary_circuit **circuit);
+PL_LQ_API void pl_lq_binary_circuit_destroy(pl_lq_binary_circuit *circuit);
+PL_LQ_API size_t
+pl_lq_binary_circuit_num_observables(const pl_lq_binary_circuit *circuit);
+PL_LQ_API size_t
+pl_lq_binary_circuit_num_params(const pl_lq_binary_circuit *circuit);
+PL_LQ_API pl_lq_status pl_lq_state_apply_binary_circuit(
+    pl_lq_state *state, const pl_lq_binary_circuit *circuit);
+/** Expectation values of the `length` observables of the circuit. */
+PL_LQ_API pl_lq_status pl_lq_binary_circuit_expvals(
+    const pl_lq_state *state, const pl_lq_binary_circuit *circuit,
+    double *results, size_t length);
+/**
+ * Adjoint Jacobian of the observables of the circuit, with one row of
+ * derivatives per observable and one column per trainable parameter, or per
+ * parameter of the circuit when `num_trainable` is 0. `length` is the number
+ * of rows times the number of columns.
+ */
+PL_LQ_API pl_lq_status pl_lq_binary_circuit_adjoint_jacobian(
+    const pl_lq_state *state, const pl_lq_binary_circuit *circuit,
+    const size_t *trainable_params, size_t num_trainable, double *jacobian,
+    size_t length);
+
+/* Differentiation */
+/**
+ * Adjoint Jacobian of the expectation values of the observables, where
+ * `state` is the state after the circuit. `jacobian` holds `num_observables`
+ * rows of `num_trainable` derivatives, or of `pl_lq_circuit_num_params`
+ * derivatives when `num_trainable` is 0, and `length` is its number of
+ * values.
+ */
+PL_LQ_API pl_lq_status pl_lq_adjoint_jacobian(
+    const pl_lq_state *state, const pl_lq_circuit *circuit,
+    const pl_lq_observable *const *observables, size_t num_observables,
+    const size_t *trainable_params, size_t num_trainable, double *jacobian,
+    size_t length);
+/**
+ * Vector-Jacobian product `<dy|d psi / d theta_j>` of the state after the
+ * circuit, with one complex number per trainable parameter, or per parameter
+ * of the circuit when `num_trainable` is 0. `length` is the number of
+ * amplitudes of `dy` and `vjp_length` the number of complex numbers of `vjp`.
+ */
+PL_LQ_API pl_lq_status pl_lq_vector_jacobian_product(
+    const pl_lq_state *state, const pl_lq_circuit *circuit, const double *dy,
+    size_t length, const size_t *trainable_params, size_t num_trainable,
+    double *vjp, size_t vjp_length);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* PENNYLANE_LIGHTNING_QUBIT_H */
@@ -0,0 +1,207 @@
+/* Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+
+ *     http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Clients of the C interface, compiled as C and called from
+ * Test_LightningQubitEmbed.cpp. */
+#include "pennylane_lightning/lightning_qubit.h"
+
+/* Prepare a Bell state and measure <Z0 Z1> and its amplitudes. */
+int bellStateC(double *expval, double *amplitudes) {
+    const size_t wire0[] = {0};
+    const size_t wires01[] = {0, 1};
+    const size_t wire1[] = {1};
+    pl_lq_state *state = NULL;
+    pl_lq_observable *z0 = NULL;
+    pl_lq_observable *z1 = NULL;
+    pl_lq_observable *zz = NULL;
+    int status = PL_LQ_FAILURE;
+
+    if (pl_lq_state_create(2, &state) != PL_LQ_SUCCESS ||
+        pl_lq_state_apply_operation(state, "Hadamard", wire0, 1, NULL, 0, 0) !=
+            PL_LQ_SUCCESS ||
+        pl_lq_state_apply_operation(state, "CNOT", wires01, 2, NULL, 0, 0) !=
+            PL_LQ_SUCCESS ||
+        pl_lq_observable_named("PauliZ", wire0, 1, &z0) != PL_LQ_SUCCESS ||
+        pl_lq_observable_named("PauliZ", wire1, 1, &z1) != PL_LQ_SUCCESS) {
+        goto cleanup;
+    }
+    {
+        const pl_lq_observable *factors[] = {z0, z1};
+        if (pl_lq_observable_tensor_product(factors, 2, &zz) !=
+                PL_LQ_SUCCESS ||
+            pl_lq_expval(state, zz, expval) != PL_LQ_SUCCESS ||
+            pl_lq_state_get(state, amplitudes, 4) != PL_LQ_SUCCESS) {
+            goto cleanup;
+        }
+    }
+    status = PL_LQ_SUCCESS;
+
+cleanup:
+    pl_lq_observable_destroy(zz);
+    pl_lq_observable_destroy(z1);
+    pl_lq_observable_destroy(z0);
+    pl_lq_state_destroy(state);
+    return status;
+}
+
+/* Adjoint Jacobian of <Z0> and <Z1> for RX(theta0) on 0, RY(theta1) on 1. */
+int adjointJacobianC(double theta0, double theta1, double *jacobian) {
+    const size_t wire0[] = {0};
+    const size_t wire1[] = {1};
+    pl_lq_state *state = NULL;
+    pl_lq_circuit *circuit = NULL;
+    pl_lq_observable *z0 = NULL;
+    pl_lq_observable *z1 = NULL;
+    int status = PL_LQ_FAILURE;
+
+    if (pl_lq_circuit_create(2, &circuit) != PL_LQ_SUCCESS ||
+        pl_lq_circuit_add_operation(circuit, "RX", wire0, 1, &theta0, 1, 0) !=
+            PL_LQ_SUCCESS ||
+        pl_lq_circuit_add_operation(circuit, "RY", wire1, 1, &theta1, 1, 0) !=
+            PL_LQ_SUCCESS ||
+        pl_lq_state_create(2, &state) != PL_LQ_SUCCESS ||
+        pl_lq_state_apply_circuit(state, circuit) != PL_LQ_SUCCESS ||
+        pl_lq_observable_named("PauliZ", wire0, 1, &z0) != PL_LQ_SUCCESS ||
+        pl_lq_observable_named("PauliZ", wire1, 1, &z1) != PL_LQ_SUCCESS) {
+        goto cleanup;
+    }
+    {
+        const pl_lq_observable *observables[] = {z0, z1};
+        if (pl_lq_circuit_num_params(circuit) != 2 ||
+            pl_lq_adjoint_jacobian(state, circuit, observables, 2, NULL, 0,
+                                   jacobian, 4) != PL_LQ_SUCCESS) {
+            goto cleanup;
+        }
+    }
+    status = PL_LQ_SUCCESS;
+
+cleanup:
+    pl_lq_observable_destroy(z1);
+    pl_lq_observable_destroy(z0);
+    pl_lq_circuit_destroy(circuit);
+    pl_lq_state_destroy(state);
+    return status;
+}
+
+/* Call an entry point writing to a buffer with the given length, for two
+ * samples of a two-qubit state, or all two parameters of RX(0.1) on 0 and
+ * RY(0.2) on 1, and return its status. */
+int outputLengthC(int entry_point, size_t length) {
+    const size_t wire0[] = {0};
+    const size_t wire1[] = {1};
+    const double theta[] = {0.1, 0.2};
+    const double dy[] = {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    double results[16] = {0.0};
+    size_t samples[16] = {0};
+    pl_lq_state *state = NULL;
+    pl_lq_circuit *circuit = NULL;
+    pl_lq_observable *z0 = NULL;
+    int status = PL_LQ_FAILURE;
+
+    if (length > 16 || pl_lq_circuit_create(2, &circuit) != PL_LQ_SUCCESS ||
+        pl_lq_circuit_add_operation(circuit, "RX", wire0, 1, &theta[0], 1,
+                                    0) != PL_LQ_SUCCESS ||
+        pl_lq_circuit_add_operation(circuit, "RY", wire1, 1, &theta[1], 1,
+                                    0) != PL_LQ_SUCCESS ||
+        pl_lq_state_create(2, &state) != PL_LQ_SUCCESS ||
+        pl_lq_state_apply_circuit(state, circuit) != PL_LQ_SUCCESS ||
+        pl_lq_observable_named("PauliZ", wire0, 1, &z0) != PL_LQ_SUCCESS) {
+        goto cleanup;
+    }
+    {
+        const pl_lq_observable *observables[] = {z0};
+        switch (entry_point) {
+        case 0:
+            status = pl_lq_adjoint_jacobian(state, circuit, observables, 1,
+                                            NULL, 0, results, length);
+            break;
+        case 1:
+            status = pl_lq_vector_jacobian_product(state, circuit, dy, 4, NULL,
+                                                   0, results, length);
+            break;
+        default:
+            status = pl_lq_generate_samples(state, 2, samples, length);
+            break;
+        }
+    }
+
+cleanup:
+    pl_lq_observable_destroy(z0);
+    pl_lq_circuit_destroy(circuit);
+    pl_lq_state_destroy(state);
+    return status;
+}
+
+/* Apply an unknown gate and return the reported error. */
+const char *invalidOperationC(void) {
+    const size_t wire0[] = {0};
+    pl_lq_state *state = NULL;
+    const char *message = NULL;
+
+    if (pl_lq_state_create(1, &state) == PL_LQ_SUCCESS &&
+        pl_lq_state_apply_operation(state, "NotAGate", wire0, 1, NULL, 0, 0) ==
+            PL_LQ_FAILURE) {
+        message = pl_lq_last_error();
+    }
+    pl_lq_state_destroy(state);
+    return message;
+}
+
+/* Call an entry point of the C interface with the out-of-range wire 1 of a
+ * single-qubit state, and return its status. */
+int invalidWireC(int entry_point) {
+    const size_t wire1[] = {1};
+    const double pauli_x[] = {0.0, 0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0};
+    double results[2] = {0.0, 0.0};
+    pl_lq_state *state = NULL;
+    pl_lq_observable *observable = NULL;
+    int status = PL_LQ_FAILURE;
+
+    if (pl_lq_state_create(1, &state) != PL_LQ_SUCCESS) {
+        return PL_LQ_SUCCESS;
+    }
+    switch (entry_point) {
+    case 0:
+        status = pl_lq_state_apply_operation(state, "PauliX", wire1, 1, NULL,
+                                             0, 0);
+        break;
+    case 1:
+        status = pl_lq_state_apply_matrix(state, pauli_x, wire1, 1, 0);
+        break;
+    case 2:
+        status = pl_lq_probs(state, wire1, 1, results, 2);
+        break;
+    case 3:
+    case 4:
+    case 5:
+        if (entry_point == 5) {
+            status = pl_lq_observable_hermitian(pauli_x, wire1, 1, &observable);
+        } else {
+            status = pl_lq_observable_named("PauliZ", wire1, 1, &observable);
+        }
+        if (status != PL_LQ_SUCCESS) {
+            break;
+        }
+        status = entry_point == 4 ? pl_lq_var(state, observable, results)
+                                  : pl_lq_expval(state, observable, results);
+        break;
+    default:
+        status = PL_LQ_SUCCESS;
+        break;
+    }
+    pl_lq_observable_destroy(observable);
+    pl_lq_state_destroy(state);
+    return status;
+}
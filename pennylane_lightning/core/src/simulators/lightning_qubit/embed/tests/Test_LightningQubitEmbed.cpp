@@ -0,0 +1,413 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <numbers>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "BinaryCircuit.hpp"
+#include "pennylane_lightning/LightningQubit.hpp"
+
+/**
+ * @file
+ * Tests of the embedding library. Only its public headers and the binary
+ * circuit writer are used, as in an application linking
+ * PennyLane::LightningQubit.
+ */
+
+extern "C" {
+int bellStateC(double *expval, double *amplitudes);
+int adjointJacobianC(double theta0, double theta1, double *jacobian);
+int outputLengthC(int entry_point, size_t length);
+const char *invalidOperationC(void);
+int invalidWireC(int entry_point);
+}
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::LightningQubit::Embed;
+constexpr double isqrt2 = 1.0 / std::numbers::sqrt2;
+
+auto bellState() -> StateVector {
+    StateVector sv{2};
+    sv.applyOperation("Hadamard", {0});
+    sv.applyOperation("CNOT", {0, 1});
+    return sv;
+}
+} // namespace
+/// @endcond
+
+TEST_CASE("Embed::Version", "[Embed]") {
+    CHECK(api_version_major == PL_LQ_API_VERSION_MAJOR);
+    CHECK(api_version_minor == 0);
+    CHECK(pl_lq_api_version() ==
+          PL_LQ_API_VERSION_MAJOR * 1000 + PL_LQ_API_VERSION_MINOR);
+    CHECK(!libraryVersion().empty());
+    CHECK(libraryVersion() == pl_lq_library_version());
+}
+
+TEST_CASE("Embed::StateVector", "[Embed]") {
+    SECTION("Bell state") {
+        const auto sv = bellState();
+        REQUIRE(sv.getNumQubits() == 2);
+        REQUIRE(sv.getLength() == 4);
+        const std::vector<ComplexT> data(sv.getData(), sv.getData() + 4);
+        CHECK(data[0].real() == Approx(isqrt2));
+        CHECK(std::abs(data[1]) == Approx(0.0).margin(1e-12));
+        CHECK(std::abs(data[2]) == Approx(0.0).margin(1e-12));
+        CHECK(data[3].real() == Approx(isqrt2));
+
+        const auto probs = sv.probs();
+        CHECK(probs[0] == Approx(0.5));
+        CHECK(probs[3] == Approx(0.5));
+        const auto probs0 = sv.probs({0});
+        REQUIRE(probs0.size() == 2);
+        CHECK(probs0[1] == Approx(0.5));
+    }
+
+    SECTION("From amplitudes, copy and reset") {
+        const std::vector<ComplexT> data{{0.0, 0.0}, {1.0, 0.0}};
+        StateVector sv{data.data(), data.size()};
+        const StateVector copy = sv;
+        sv.reset();
+        CHECK(sv.getData()[0] == ComplexT{1.0, 0.0});
+        CHECK(copy.getData()[1] == ComplexT{1.0, 0.0});
+        CHECK_THROWS_AS((StateVector{data.data(), 3}), Error);
+    }
+
+    SECTION("Matrices and inverses") {
+        StateVector sv{1};
+        const std::vector<ComplexT> pauli_x{
+            {0.0, 0.0}, {1.0, 0.0}, {1.0, 0.0}, {0.0, 0.0}};
+        sv.applyMatrix(pauli_x, {0});
+        CHECK(sv.getData()[1] == ComplexT{1.0, 0.0});
+
+        sv.applyOperation("RY", {0}, {0.3});
+        sv.applyOperation("RY", {0}, {0.3}, true);
+        CHECK(std::abs(sv.getData()[1]) == Approx(1.0));
+    }
+
+    SECTION("Samples") {
+        const auto sv = bellState();
+        const size_t num_samples = 100;
+        const auto samples = sv.generateSamples(num_samples);
+        REQUIRE(samples.size() == 2 * num_samples);
+        for (size_t i = 0; i < num_samples; i++) {
+            CHECK(samples[2 * i] == samples[2 * i + 1]);
+        }
+    }
+
+    SECTION("Errors") {
+        StateVector sv{1};
+        CHECK_THROWS_AS(sv.applyOperation("NotAGate", {0}), Error);
+        CHECK_THROWS_AS(Circuit{1}.addOperation("RX", {1}, {0.1}), Error);
+        CHECK_THROWS_AS(sv.applyCircuit(Circuit{2}), Error);
+    }
+
+    SECTION("Invalid wires") {
+        StateVector sv{1};
+        const std::vector<std::complex<double>> pauli_x{0.0, 1.0, 1.0, 0.0};
+        const auto z1 = Observable::named("PauliZ", {1});
+        CHECK_THROWS_WITH(sv.applyOperation("PauliX", {1}),
+                          Catch::Contains("Invalid wire index."));
+        CHECK_THROWS_WITH(sv.applyMatrix(pauli_x, {1}),
+                          Catch::Contains("Invalid wire index."));
+        CHECK_THROWS_WITH(sv.probs({0, 1}),
+                          Catch::Contains("Invalid wire index."));
+        CHECK_THROWS_WITH(sv.expval(z1),
+                          Catch::Contains("Invalid wire index."));
+        CHECK_THROWS_WITH(sv.var(Observable::hermitian(pauli_x, {1})),
+                          Catch::Contains("Invalid wire index."));
+        CHECK_THROWS_WITH(adjointJacobian(sv, Circuit{1}, {z1}, {}),
+                          Catch::Contains("Invalid wire index."));
+        CHECK_THROWS_AS(adjointJacobian(sv, Circuit{2}, {}, {}), Error);
+    }
+}
+
+TEST_CASE("Embed::Observable", "[Embed]") {
+    const auto sv = bellState();
+    const auto z0 = Observable::named("PauliZ", {0});
+    const auto z1 = Observable::named("PauliZ", {1});
+    const auto x0 = Observable::named("PauliX", {0});
+
+    SECTION("Named and tensor products") {
+        CHECK(sv.expval(z0) == Approx(0.0).margin(1e-12));
+        CHECK(sv.expval(Observable::tensorProduct({z0, z1})) == Approx(1.0));
+        CHECK(sv.var(x0) == Approx(1.0));
+        CHECK(z0.getWires() == std::vector<size_t>{0});
+    }
+
+    SECTION("Hermitian") {
+        const std::vector<ComplexT> pauli_z{
+            {1.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {-1.0, 0.0}};
+        const auto obs = Observable::hermitian(pauli_z, {1});
+        CHECK(sv.expval(obs) == Approx(sv.expval(z1)).margin(1e-12));
+    }
+
+    SECTION("Hamiltonian") {
+        const auto obs = Observable::hamiltonian(
+            {0.5, 2.0}, {x0, Observable::tensorProduct({z0, z1})});
+        CHECK(sv.expval(obs) == Approx(2.0));
+        CHECK_THROWS_AS(Observable::hamiltonian({1.0}, {z0, z1}), Error);
+    }
+
+    SECTION("Sparse Hamiltonian") {
+        // 2 * Z0 Z1 on the two wires
+        const std::vector<ComplexT> data{
+            {2.0, 0.0}, {-2.0, 0.0}, {-2.0, 0.0}, {2.0, 0.0}};
+        const std::vector<size_t> indices{0, 1, 2, 3};
+        const std::vector<size_t> offsets{0, 1, 2, 3, 4};
+        const auto obs =
+            Observable::sparseHamiltonian(data, indices, offsets, {0, 1});
+        CHECK(sv.expval(obs) == Approx(2.0));
+    }
+}
+
+TEST_CASE("Embed::adjointJacobian", "[Embed]") {
+    const double theta0 = 0.4;
+    const double theta1 = -1.1;
+
+    Circuit circuit{2};
+    circuit.addOperation("RX", {0}, {theta0});
+    circuit.addOperation("CNOT", {0, 1});
+    circuit.addOperation("RY", {1}, {theta1});
+    REQUIRE(circuit.getNumOperations() == 3);
+    REQUIRE(circuit.getNumParams() == 2);
+
+    StateVector sv{2};
+    sv.applyCircuit(circuit);
+
+    const std::vector<Observable> observables{Observable::named("PauliZ", {0}),
+                                              Observable::named("PauliY", {0})};
+
+    SECTION("All parameters, compared to finite differences") {
+        const auto jac = adjointJacobian(sv, circuit, observables);
+        REQUIRE(jac.size() == 4);
+
+        const double eps = 1e-6;
+        const std::vector<double> params{theta0, theta1};
+        for (size_t p = 0; p < params.size(); p++) {
+            auto shifted = [&](double shift) {
+                Circuit c{2};
+                c.addOperation("RX", {0}, {theta0 + (p == 0 ? shift : 0.0)});
+                c.addOperation("CNOT", {0, 1});
+                c.addOperation("RY", {1}, {theta1 + (p == 1 ? shift : 0.0)});
+                StateVector s{2};
+                s.applyCircuit(c);
+                return s;
+            };
+            const auto plus = shifted(eps);
+            const auto minus = shifted(-eps);
+            for (size_t o = 0; o < observables.size(); o++) {
+                const double expected = (plus.expval(observables[o]) -
+                                         minus.expval(observables[o])) /
+                                        (2 * eps);
+                CHECK(jac[o * params.size() + p] ==
+                      Approx(expected).margin(1e-6));
+            }
+        }
+    }
+
+    SECTION("Trainable parameters") {
+        const auto jac = adjointJacobian(sv, circuit, observables, {0});
+        REQUIRE(jac.size() == 2);
+        CHECK(jac[0] == Approx(-std::sin(theta0)));
+    }
+}
+
+TEST_CASE("Embed::vectorJacobianProduct", "[Embed]") {
+    const double theta = std::numbers::pi / 7;
+
+    Circuit circuit{2};
+    circuit.addOperation("Hadamard", {0});
+    circuit.addOperation("CNOT", {0, 1});
+    circuit.addOperation("RX", {1}, {theta});
+
+    StateVector sv{2};
+    sv.applyCircuit(circuit);
+
+    const std::vector<ComplexT> expected{
+        {-isqrt2 / 2.0 * std::sin(theta / 2), 0.0},
+        {0.0, -isqrt2 / 2.0 * std::cos(theta / 2)},
+        {0.0, -isqrt2 / 2.0 * std::cos(theta / 2)},
+        {-isqrt2 / 2.0 * std::sin(theta / 2), 0.0}};
+
+    for (size_t i = 0; i < 4; i++) {
+        std::vector<ComplexT> dy(4);
+        dy[i] = {1.0, 0.0};
+        const auto vjp = vectorJacobianProduct(sv, circuit, dy);
+        REQUIRE(vjp.size() == 1);
+        CHECK(vjp[0].real() == Approx(expected[i].real()).margin(1e-10));
+        CHECK(vjp[0].imag() == Approx(expected[i].imag()).margin(1e-10));
+    }
+
+    CHECK_THROWS_AS(
+        vectorJacobianProduct(sv, circuit, std::vector<ComplexT>(2)), Error);
+}
+
+TEST_CASE("Embed::BinaryCircuit", "[Embed]") {
+    using Pennylane::Util::BinaryCircuitBuilder;
+    const double theta0 = 0.3;
+    const double theta1 = -0.5;
+
+    BinaryCircuitBuilder builder{2};
+    builder.addOperation("RX", {0}, {theta0});
+    builder.addOperation("CNOT", {0, 1});
+    builder.addOperation("RY", {1}, {theta1});
+    builder.addObservable({1.0}, {{{"PauliZ", {1}}}});
+    builder.addObservable(
+        {0.5, 1.0}, {{{"PauliX", {0}}}, {{"PauliZ", {0}}, {"PauliZ", {1}}}});
+    const auto buffer = builder.build();
+    const BinaryCircuit binary{buffer.data(), buffer.size()};
+    REQUIRE(binary.getNumQubits() == 2);
+    REQUIRE(binary.getNumOperations() == 3);
+    REQUIRE(binary.getNumObservables() == 2);
+    REQUIRE(binary.getNumParams() == 2);
+
+    Circuit circuit{2};
+    circuit.addOperation("RX", {0}, {theta0});
+    circuit.addOperation("CNOT", {0, 1});
+    circuit.addOperation("RY", {1}, {theta1});
+    const auto z0 = Observable::named("PauliZ", {0});
+    const auto z1 = Observable::named("PauliZ", {1});
+    const std::vector<Observable> observables{
+        z1, Observable::hamiltonian(
+                {0.5, 1.0}, {Observable::named("PauliX", {0}),
+                             Observable::tensorProduct({z0, z1})})};
+
+    StateVector sv{2};
+    sv.applyCircuit(binary);
+    StateVector expected{2};
+    expected.applyCircuit(circuit);
+
+    SECTION("Apply and measure") {
+        for (size_t i = 0; i < 4; i++) {
+            CHECK(std::abs(sv.getData()[i] - expected.getData()[i]) ==
+                  Approx(0.0).margin(1e-12));
+        }
+        const auto expvals = sv.expvals(binary);
+        REQUIRE(expvals.size() == 2);
+        CHECK(expvals[0] == Approx(expected.expval(observables[0])));
+        CHECK(expvals[1] == Approx(expected.expval(observables[1])));
+    }
+
+    SECTION("Adjoint Jacobian") {
+        const auto jac = adjointJacobian(sv, binary);
+        const auto reference = adjointJacobian(expected, circuit, observables);
+        REQUIRE(jac.size() == reference.size());
+        for (size_t i = 0; i < jac.size(); i++) {
+            CHECK(jac[i] == Approx(reference[i]).margin(1e-12));
+        }
+    }
+
+    SECTION("Errors") {
+        std::vector<std::byte> invalid(buffer);
+        invalid[0] = std::byte{0};
+        CHECK_THROWS_AS((BinaryCircuit{invalid.data(), invalid.size()}),
+                        Error);
+        StateVector other{3};
+        CHECK_THROWS_AS(other.applyCircuit(binary), Error);
+    }
+
+    SECTION("C interface") {
+        pl_lq_binary_circuit *c_circuit = nullptr;
+        pl_lq_state *state = nullptr;
+        REQUIRE(pl_lq_binary_circuit_load(buffer.data(), buffer.size(),
+                                          &c_circuit) == PL_LQ_SUCCESS);
+        REQUIRE(pl_lq_binary_circuit_num_observables(c_circuit) == 2);
+        REQUIRE(pl_lq_binary_circuit_num_params(c_circuit) == 2);
+        REQUIRE(pl_lq_state_create(2, &state) == PL_LQ_SUCCESS);
+        REQUIRE(pl_lq_state_apply_binary_circuit(state, c_circuit) ==
+                PL_LQ_SUCCESS);
+
+        std::vector<double> expvals(2);
+        REQUIRE(pl_lq_binary_circuit_expvals(state, c_circuit, expvals.data(),
+                                             2) == PL_LQ_SUCCESS);
+        CHECK(expvals[0] == Approx(expected.expval(observables[0])));
+        CHECK(pl_lq_binary_circuit_expvals(state, c_circuit, expvals.data(),
+                                           1) == PL_LQ_FAILURE);
+
+        std::vector<double> jac(4);
+        REQUIRE(pl_lq_binary_circuit_adjoint_jacobian(
+                    state, c_circuit, nullptr, 0, jac.data(), 4) ==
+                PL_LQ_SUCCESS);
+        CHECK(jac == adjointJacobian(sv, binary));
+        const size_t trainable[] = {1};
+        CHECK(pl_lq_binary_circuit_adjoint_jacobian(
+                  state, c_circuit, trainable, 1, jac.data(), 4) ==
+              PL_LQ_FAILURE);
+
+        pl_lq_state_destroy(state);
+        pl_lq_binary_circuit_destroy(c_circuit);
+    }
+}
+
+TEST_CASE("Embed::C interface", "[Embed]") {
+    SECTION("Bell state") {
+        double expval = 0.0;
+        std::vector<double> amplitudes(8);
+        REQUIRE(bellStateC(&expval, amplitudes.data()) == PL_LQ_SUCCESS);
+        CHECK(expval == Approx(1.0));
+        CHECK(amplitudes[0] == Approx(isqrt2));
+        CHECK(amplitudes[6] == Approx(isqrt2));
+    }
+
+    SECTION("Adjoint Jacobian") {
+        const double theta0 = 0.7;
+        const double theta1 = 0.2;
+        std::vector<double> jac(4);
+        REQUIRE(adjointJacobianC(theta0, theta1, jac.data()) ==
+                PL_LQ_SUCCESS);
+        CHECK(jac[0] == Approx(-std::sin(theta0)));
+        CHECK(jac[1] == Approx(0.0).margin(1e-12));
+        CHECK(jac[2] == Approx(0.0).margin(1e-12));
+        CHECK(jac[3] == Approx(-std::sin(theta1)));
+    }
+
+    SECTION("Output lengths") {
+        // Adjoint Jacobian of one observable and VJP over all two parameters,
+        // and two samples of two qubits
+        const std::vector<size_t> lengths{2, 2, 4};
+        for (int entry_point = 0; entry_point < 3; entry_point++) {
+            INFO("entry point " << entry_point);
+            const size_t length = lengths[entry_point];
+            CHECK(outputLengthC(entry_point, length) == PL_LQ_SUCCESS);
+            CHECK(outputLengthC(entry_point, length - 1) == PL_LQ_FAILURE);
+            CHECK_THAT(pl_lq_last_error(),
+                       Catch::Contains("The length does not match"));
+            CHECK(outputLengthC(entry_point, length + 1) == PL_LQ_FAILURE);
+        }
+    }
+
+    SECTION("Errors") {
+        const char *message = invalidOperationC();
+        REQUIRE(message != nullptr);
+        CHECK(!std::string(message).empty());
+    }
+
+    SECTION("Invalid wires") {
+        // apply_operation, apply_matrix, probs, and expval, var, and expval
+        // of a Hermitian observable
+        for (int entry_point = 0; entry_point < 6; entry_point++) {
+            INFO("entry point " << entry_point);
+            CHECK(invalidWireC(entry_point) == PL_LQ_FAILURE);
+            CHECK_THAT(pl_lq_last_error(),
+                       Catch::Contains("Invalid wire index."));
+        }
+    }
+}
@@ -38,7 +38,8 @@ namespace Pennylane::LightningQubit::KernelMap::Internal {
 constexpr static auto leq_four = Util::larger_than_equal_to<size_t>(4);
 
 void assignKernelsForGateOp_AVX2(CPUMemoryModel memory_model) {
-    auto &instance = OperationKernelMap<GateOperation>::getInstance();
+    auto &instance =
+        OperationKernelMap<GateOperation>::getAssignmentInstance();
 
     instance.assignKernelForOp(GateOperation::PauliX, all_threading,
                                memory_model, leq_four, KernelType::AVX2);
@@ -75,11 +76,29 @@ void assignKernelsForGateOp_AVX2(CPUMemoryModel memory_model) {
                                memory_model, leq_four, KernelType::AVX2);
     instance.assignKernelForOp(GateOperation::IsingZZ, all_threading,
                                memory_model, leq_four, KernelType::AVX2);
+    instance.assignKernelForOp(GateOperation::SingleExcitation, all_threading,
+                               memory_model, leq_four, KernelType::AVX2);
+    instance.assignKernelForOp(GateOperation::SingleExcitationMinus,
+                               all_threading, memory_model, leq_four,
+                               KernelType::AVX2);
+    instance.assignKernelForOp(GateOperation::SingleExcitationPlus,
+                               all_threading, memory_model, leq_four,
+                               KernelType::AVX2);
+    /* Four-qubit gates */
+    instance.assignKernelForOp(GateOperation::DoubleExcitation, all_threading,
+                               memory_model, leq_four, KernelType::AVX2);
+    instance.assignKernelForOp(GateOperation::DoubleExcitationMinus,
+                               all_threading, memory_model, leq_four,
+                               KernelType::AVX2);
+    instance.assignKernelForOp(GateOperation::DoubleExcitationPlus,
+                               all_threading, memory_model, leq_four,
+                               KernelType::AVX2);
     /* Multi-qubit gates */
 }
 
 void assignKernelsForGeneratorOp_AVX2(CPUMemoryModel memory_model) {
-    auto &instance = OperationKernelMap<GeneratorOperation>::getInstance();
+    auto &instance =
+        OperationKernelMap<GeneratorOperation>::getAssignmentInstance();
 
     instance.assignKernelForOp(GeneratorOperation::RX, all_threading,
                                memory_model, leq_four, KernelType::AVX2);
@@ -89,7 +108,8 @@ void assignKernelsForGeneratorOp_AVX2(CPUMemoryModel memory_model) {
                                memory_model, leq_four, KernelType::AVX2);
 }
 void assignKernelsForMatrixOp_AVX2(CPUMemoryModel memory_model) {
-    auto &instance = OperationKernelMap<MatrixOperation>::getInstance();
+    auto &instance =
+        OperationKernelMap<MatrixOperation>::getAssignmentInstance();
 
     instance.assignKernelForOp(MatrixOperation::SingleQubitOp, all_threading,
                                memory_model, leq_four, KernelType::AVX2);
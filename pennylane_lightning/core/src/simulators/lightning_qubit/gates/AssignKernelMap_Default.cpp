@@ -39,7 +39,8 @@ namespace Pennylane::LightningQubit::KernelMap::Internal {
 constexpr static auto all_qubit_numbers = full_domain<size_t>();
 
 void assignKernelsForGateOp_Default() {
-    auto &instance = OperationKernelMap<GateOperation>::getInstance();
+    auto &instance =
+        OperationKernelMap<GateOperation>::getAssignmentInstance();
 
     instance.assignKernelForOp(GateOperation::Identity, all_threading,
                                all_memory_model, all_qubit_numbers,
@@ -150,10 +151,14 @@ void assignKernelsForGateOp_Default() {
     instance.assignKernelForOp(GateOperation::MultiRZ, all_threading,
                                all_memory_model, all_qubit_numbers,
                                KernelType::LM);
+    instance.assignKernelForOp(GateOperation::QFT, all_threading,
+                               all_memory_model, all_qubit_numbers,
+                               KernelType::LM);
 }
 
 void assignKernelsForGeneratorOp_Default() {
-    auto &instance = OperationKernelMap<GeneratorOperation>::getInstance();
+    auto &instance =
+        OperationKernelMap<GeneratorOperation>::getAssignmentInstance();
 
     instance.assignKernelForOp(GeneratorOperation::PhaseShift, all_threading,
                                all_memory_model, all_qubit_numbers,
@@ -216,7 +221,8 @@ void assignKernelsForGeneratorOp_Default() {
                                KernelType::LM);
 }
 void assignKernelsForMatrixOp_Default() {
-    auto &instance = OperationKernelMap<MatrixOperation>::getInstance();
+    auto &instance =
+        OperationKernelMap<MatrixOperation>::getAssignmentInstance();
 
     instance.assignKernelForOp(MatrixOperation::SingleQubitOp, all_threading,
                                all_memory_model, all_qubit_numbers,
@@ -227,5 +233,8 @@ void assignKernelsForMatrixOp_Default() {
     instance.assignKernelForOp(MatrixOperation::MultiQubitOp, all_threading,
                                all_memory_model, all_qubit_numbers,
                                KernelType::LM);
+    instance.assignKernelForOp(MatrixOperation::DiagonalOp, all_threading,
+                               all_memory_model, all_qubit_numbers,
+                               KernelType::LM);
 }
 } // namespace Pennylane::LightningQubit::KernelMap::Internal
@@ -22,6 +22,7 @@
 #include <complex>
 #include <functional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <variant>
@@ -64,6 +65,19 @@ constexpr auto generatorNamesWithoutPrefix() {
     return res;
 }
 
+int registerAllAvailableKernels_Float();
+int registerAllAvailableKernels_Double();
+
+/**
+ * @brief Register all kernels available on the host for the given precision.
+ */
+template <typename PrecisionT> int registerAllAvailableKernels() {
+    if constexpr (std::is_same_v<PrecisionT, float>) {
+        return registerAllAvailableKernels_Float();
+    } else if constexpr (std::is_same_v<PrecisionT, double>) {
+        return registerAllAvailableKernels_Double();
+    }
+}
 } // namespace Pennylane::LightningQubit::Internal
 /// @endcond
 
@@ -72,10 +86,11 @@ namespace Pennylane::LightningQubit {
  * @brief DynamicDispatcher class
  *
  * This is a singleton class that can call a gate/generator operation
- * dynamically. Currently, all gate operations (gates/generators/matrices) are
- * registered to this class when the library is loaded. As all functions besides
- * registration functions are already thread-safe, we can use this class
- * in multithreading environment without any problem.
+ * dynamically. All gate operations (gates/generators/matrices) are
+ * registered to this class the first time the instance for a given precision
+ * is requested, so loading the library does not pay for the registration.
+ * As all functions besides registration functions are already thread-safe, we
+ * can use this class in multithreading environment without any problem.
  * In addition, adding mutex is not required unless kernel functions are
  * registered in multiple threads.
  */
@@ -128,8 +143,22 @@ template <typename PrecisionT> class DynamicDispatcher {
 
     /**
      * @brief Get the singleton instance
+     *
+     * All kernels available on the host are registered on the first call.
      */
     static DynamicDispatcher &getInstance() {
+        static DynamicDispatcher &singleton = []() -> DynamicDispatcher & {
+            Internal::registerAllAvailableKernels<PrecisionT>();
+            return getRegistrationInstance();
+        }();
+        return singleton;
+    }
+
+    /**
+     * @brief Get the singleton instance without triggering the kernel
+     * registration. Only used by the registration functions themselves.
+     */
+    static DynamicDispatcher &getRegistrationInstance() {
         static DynamicDispatcher singleton;
         return singleton;
     }
@@ -472,6 +501,33 @@ template <typename PrecisionT> class DynamicDispatcher {
         applyMatrix(kernel, data, num_qubits, matrix.data(), wires, inverse);
     }
 
+    /**
+     * @brief Apply a diagonal matrix directly to the statevector.
+     *
+     * @param kernel Kernel to use for this operation
+     * @param data Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     * @param diag Diagonal entries of the matrix, of size 2^(wires.size()).
+     * @param wires Wires the matrix applies to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyDiagonal(KernelType kernel, CFP_t *data, size_t num_qubits,
+                       const std::complex<PrecisionT> *diag,
+                       const std::vector<size_t> &wires, bool inverse) const {
+        PL_ASSERT(num_qubits >= wires.size());
+
+        const auto iter = matrix_kernels_.find(
+            std::make_pair(MatrixOperation::DiagonalOp, kernel));
+
+        if (iter == matrix_kernels_.end()) {
+            throw std::invalid_argument(
+                std::string(lookup(GateConstant::matrix_names,
+                                   MatrixOperation::DiagonalOp)) +
+                " is not registered for the given kernel");
+        }
+        (iter->second)(data, num_qubits, diag, wires, inverse);
+    }
+
     /**
      * @brief Apply a single generator to the state-vector using the given
      * kernel.
@@ -523,22 +579,3 @@ template <typename PrecisionT> class DynamicDispatcher {
     }
 };
 } // namespace Pennylane::LightningQubit
-
-/// @cond DEV
-namespace Pennylane::LightningQubit::Internal {
-int registerAllAvailableKernels_Float();
-int registerAllAvailableKernels_Double();
-
-/**
- * @brief These functions are only used to register kernels to the dynamic
- * dispatcher.
- */
-struct RegisterBeforeMain_Float {
-    const static inline int dummy = registerAllAvailableKernels_Float();
-};
-
-struct RegisterBeforeMain_Double {
-    const static inline int dummy = registerAllAvailableKernels_Double();
-};
-} // namespace Pennylane::LightningQubit::Internal
-/// @endcond
@@ -25,6 +25,7 @@
 #include <functional>
 #include <mutex>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 
@@ -54,17 +55,20 @@ int assignKernelsForGateOp();
 int assignKernelsForGeneratorOp();
 int assignKernelsForMatrixOp();
 
-template <class Operation> struct AssignKernelForOp;
-
-template <> struct AssignKernelForOp<Pennylane::Gates::GateOperation> {
-    static inline const int dummy = assignKernelsForGateOp();
-};
-template <> struct AssignKernelForOp<Pennylane::Gates::GeneratorOperation> {
-    static inline const int dummy = assignKernelsForGeneratorOp();
-};
-template <> struct AssignKernelForOp<Pennylane::Gates::MatrixOperation> {
-    static inline const int dummy = assignKernelsForMatrixOp();
-};
+/**
+ * @brief Assign the default kernels for all operations of a kind.
+ */
+template <class Operation> int assignKernelsForOp() {
+    if constexpr (std::is_same_v<Operation, Pennylane::Gates::GateOperation>) {
+        return assignKernelsForGateOp();
+    } else if constexpr (std::is_same_v<Operation,
+                                        Pennylane::Gates::GeneratorOperation>) {
+        return assignKernelsForGeneratorOp();
+    } else if constexpr (std::is_same_v<Operation,
+                                        Pennylane::Gates::MatrixOperation>) {
+        return assignKernelsForMatrixOp();
+    }
+}
 } // namespace Internal
 ///@endcond
 
@@ -274,9 +278,27 @@ template <class Operation, size_t cache_size = 16> class OperationKernelMap {
     /**
      * @brief Get a singleton instance.
      *
+     * Default kernels for this kind of operation are assigned on the first
+     * call.
+     *
      * @return A singleton instance.
      */
     static auto getInstance() -> OperationKernelMap & {
+        static OperationKernelMap &instance = []() -> OperationKernelMap & {
+            Internal::assignKernelsForOp<Operation>();
+            return getAssignmentInstance();
+        }();
+
+        return instance;
+    }
+
+    /**
+     * @brief Get a singleton instance without assigning the default kernels.
+     * Only used by the kernel assignment functions themselves.
+     *
+     * @return A singleton instance.
+     */
+    static auto getAssignmentInstance() -> OperationKernelMap & {
         static OperationKernelMap instance;
 
         return instance;
@@ -259,6 +259,12 @@ struct GateOpToMemberFuncPtr<PrecisionT, ParamT, GateImplementation,
     constexpr static auto value =
         &GateImplementation::template applyMultiRZ<PrecisionT, ParamT>;
 };
+template <class PrecisionT, class ParamT, class GateImplementation>
+struct GateOpToMemberFuncPtr<PrecisionT, ParamT, GateImplementation,
+                             GateOperation::QFT> {
+    constexpr static auto value =
+        &GateImplementation::template applyQFT<PrecisionT>;
+};
 
 /**
  * @brief Return a specific member function pointer for a given generator
@@ -424,6 +430,12 @@ struct MatrixOpToMemberFuncPtr<PrecisionT, GateImplementation,
     constexpr static auto value =
         &GateImplementation::template applyMultiQubitOp<PrecisionT>;
 };
+template <class PrecisionT, class GateImplementation>
+struct MatrixOpToMemberFuncPtr<PrecisionT, GateImplementation,
+                               MatrixOperation::DiagonalOp> {
+    constexpr static auto value =
+        &GateImplementation::template applyDiagonalOp<PrecisionT>;
+};
 
 /// @cond DEV
 namespace Internal {
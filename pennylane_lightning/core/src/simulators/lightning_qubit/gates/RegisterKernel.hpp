@@ -164,7 +164,7 @@ constexpr auto matrix_op_functor_tuple =
  */
 template <class PrecisionT, class ParamT, class GateImplementation>
 void registerAllImplementedGateOps() {
-    auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+    auto &dispatcher = DynamicDispatcher<PrecisionT>::getRegistrationInstance();
 
     auto registerGateToDispatcher = [&dispatcher](
                                         const auto &gate_op_func_pair) {
@@ -188,7 +188,7 @@ void registerAllImplementedGateOps() {
  */
 template <class PrecisionT, class GateImplementation>
 void registerAllImplementedGeneratorOps() {
-    auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+    auto &dispatcher = DynamicDispatcher<PrecisionT>::getRegistrationInstance();
 
     auto registerGeneratorToDispatcher =
         [&dispatcher](const auto &gntr_op_func_pair) {
@@ -212,7 +212,7 @@ void registerAllImplementedGeneratorOps() {
  */
 template <class PrecisionT, class GateImplementation>
 void registerAllImplementedMatrixOps() {
-    auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+    auto &dispatcher = DynamicDispatcher<PrecisionT>::getRegistrationInstance();
 
     auto registerMatrixToDispatcher = [&dispatcher](
                                           const auto &mat_op_func_pair) {
@@ -239,8 +239,9 @@ void registerKernel() {
     registerAllImplementedGeneratorOps<PrecisionT, GateImplementation>();
     registerAllImplementedMatrixOps<PrecisionT, GateImplementation>();
 
-    DynamicDispatcher<PrecisionT>::getInstance().registerKernelName(
-        GateImplementation::kernel_id, std::string{GateImplementation::name});
+    DynamicDispatcher<PrecisionT>::getRegistrationInstance()
+        .registerKernelName(GateImplementation::kernel_id,
+                            std::string{GateImplementation::name});
 }
 } // namespace Pennylane::LightningQubit
 /// @endcond
@@ -36,6 +36,7 @@
 namespace {
 using Pennylane::Gates::GateOperation;
 using Pennylane::Gates::getRot;
+namespace Pattern = Pennylane::Gates::Pattern;
 } // namespace
 /// @endcond
 
@@ -57,6 +58,12 @@ class GateImplementationsAVXCommon
         GateOperation::IsingXY,    GateOperation::ControlledPhaseShift,
         GateOperation::CRY,        GateOperation::CRZ,
         GateOperation::CRX,
+        GateOperation::SingleExcitation,
+        GateOperation::SingleExcitationMinus,
+        GateOperation::SingleExcitationPlus,
+        GateOperation::DoubleExcitation,
+        GateOperation::DoubleExcitationMinus,
+        GateOperation::DoubleExcitationPlus,
         /* CRot */
     };
 
@@ -515,6 +522,90 @@ class GateImplementationsAVXCommon
         gate_helper(arr, num_qubits, wires, inverse, angle);
     }
 
+    /**
+     * @brief Apply a gate declared by its sparsity pattern with the AVX
+     * kernel generated from the pattern, or with the LM kernel when a wire of
+     * the gate is inside a register.
+     */
+    template <class GatePattern, class PrecisionT, class ParamT>
+    static void applyPatternGate(std::complex<PrecisionT> *arr,
+                                 const size_t num_qubits,
+                                 const std::vector<size_t> &wires,
+                                 bool inverse, ParamT angle) {
+        using ApplyPatternGateAVX =
+            AVXCommon::ApplyPatternGate<PrecisionT,
+                                        Derived::packed_bytes /
+                                            sizeof(PrecisionT),
+                                        GatePattern>;
+        static_assert(std::is_same_v<PrecisionT, float> ||
+                          std::is_same_v<PrecisionT, double>,
+                      "Only float and double are supported.");
+
+        PL_ASSERT(wires.size() == GatePattern::num_wires);
+
+        if (ApplyPatternGateAVX::isExternal(num_qubits, wires)) {
+            ApplyPatternGateAVX::applyExternal(arr, num_qubits, wires, inverse,
+                                               angle);
+            return;
+        }
+        GateImplementationsLM::applyPatternGate<GatePattern>(
+            arr, num_qubits, wires, inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applySingleExcitation(std::complex<PrecisionT> *arr,
+                                      const size_t num_qubits,
+                                      const std::vector<size_t> &wires,
+                                      bool inverse, ParamT angle) {
+        applyPatternGate<Pattern::SingleExcitation>(arr, num_qubits, wires,
+                                                    inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applySingleExcitationMinus(std::complex<PrecisionT> *arr,
+                                           const size_t num_qubits,
+                                           const std::vector<size_t> &wires,
+                                           bool inverse, ParamT angle) {
+        applyPatternGate<Pattern::SingleExcitationMinus>(arr, num_qubits, wires,
+                                                         inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applySingleExcitationPlus(std::complex<PrecisionT> *arr,
+                                          const size_t num_qubits,
+                                          const std::vector<size_t> &wires,
+                                          bool inverse, ParamT angle) {
+        applyPatternGate<Pattern::SingleExcitationPlus>(arr, num_qubits, wires,
+                                                        inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyDoubleExcitation(std::complex<PrecisionT> *arr,
+                                      const size_t num_qubits,
+                                      const std::vector<size_t> &wires,
+                                      bool inverse, ParamT angle) {
+        applyPatternGate<Pattern::DoubleExcitation>(arr, num_qubits, wires,
+                                                    inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyDoubleExcitationMinus(std::complex<PrecisionT> *arr,
+                                           const size_t num_qubits,
+                                           const std::vector<size_t> &wires,
+                                           bool inverse, ParamT angle) {
+        applyPatternGate<Pattern::DoubleExcitationMinus>(arr, num_qubits, wires,
+                                                         inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyDoubleExcitationPlus(std::complex<PrecisionT> *arr,
+                                          const size_t num_qubits,
+                                          const std::vector<size_t> &wires,
+                                          bool inverse, ParamT angle) {
+        applyPatternGate<Pattern::DoubleExcitationPlus>(arr, num_qubits, wires,
+                                                        inverse, angle);
+    }
+
     /* Generators */
     template <class PrecisionT>
     static auto applyGeneratorPhaseShift(std::complex<PrecisionT> *arr,
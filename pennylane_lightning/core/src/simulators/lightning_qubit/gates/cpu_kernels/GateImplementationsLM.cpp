@@ -26,94 +26,24 @@ template <class PrecisionT, class ParamT>
 void GateImplementationsLM::applySingleExcitation(
     std::complex<PrecisionT> *arr, size_t num_qubits,
     const std::vector<size_t> &wires, bool inverse, ParamT angle) {
-    PL_ASSERT(wires.size() == 2);
-    const PrecisionT c = std::cos(angle / 2);
-    const PrecisionT s = inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
-    const size_t rev_wire0 = num_qubits - wires[1] - 1;
-    const size_t rev_wire1 = num_qubits - wires[0] - 1;
-    const size_t rev_wire0_shift = static_cast<size_t>(1U) << rev_wire0;
-    const size_t rev_wire1_shift = static_cast<size_t>(1U) << rev_wire1;
-    const auto [parity_high, parity_middle, parity_low] =
-        revWireParity(rev_wire0, rev_wire1);
-
-    for (size_t k = 0; k < exp2(num_qubits - 2); k++) {
-        const size_t i00 = ((k << 2U) & parity_high) |
-                           ((k << 1U) & parity_middle) | (k & parity_low);
-        const size_t i10 = i00 | rev_wire1_shift;
-        const size_t i01 = i00 | rev_wire0_shift;
-
-        const std::complex<PrecisionT> v01 = arr[i01];
-        const std::complex<PrecisionT> v10 = arr[i10];
-
-        arr[i01] = c * v01 - s * v10;
-        arr[i10] = s * v01 + c * v10;
-    }
+    applyPatternGate<Pattern::SingleExcitation>(arr, num_qubits, wires,
+                                                inverse, angle);
 }
 
 template <class PrecisionT, class ParamT>
 void GateImplementationsLM::applySingleExcitationMinus(
     std::complex<PrecisionT> *arr, size_t num_qubits,
     const std::vector<size_t> &wires, bool inverse, ParamT angle) {
-    PL_ASSERT(wires.size() == 2);
-    const PrecisionT c = std::cos(angle / 2);
-    const PrecisionT s = inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
-    const std::complex<PrecisionT> e =
-        inverse ? std::exp(std::complex<PrecisionT>(0, angle / 2))
-                : std::exp(-std::complex<PrecisionT>(0, angle / 2));
-    const size_t rev_wire0 = num_qubits - wires[1] - 1;
-    const size_t rev_wire1 = num_qubits - wires[0] - 1;
-    const size_t rev_wire0_shift = static_cast<size_t>(1U) << rev_wire0;
-    const size_t rev_wire1_shift = static_cast<size_t>(1U) << rev_wire1;
-    const auto [parity_high, parity_middle, parity_low] =
-        revWireParity(rev_wire0, rev_wire1);
-
-    for (size_t k = 0; k < exp2(num_qubits - 2); k++) {
-        const size_t i00 = ((k << 2U) & parity_high) |
-                           ((k << 1U) & parity_middle) | (k & parity_low);
-        const size_t i10 = i00 | rev_wire1_shift;
-        const size_t i01 = i00 | rev_wire0_shift;
-        const size_t i11 = i00 | rev_wire0_shift | rev_wire1_shift;
-
-        const std::complex<PrecisionT> v01 = arr[i01];
-        const std::complex<PrecisionT> v10 = arr[i10];
-
-        arr[i00] *= e;
-        arr[i01] = c * v01 - s * v10;
-        arr[i10] = s * v01 + c * v10;
-        arr[i11] *= e;
-    }
+    applyPatternGate<Pattern::SingleExcitationMinus>(arr, num_qubits, wires,
+                                                     inverse, angle);
 }
 
 template <class PrecisionT, class ParamT>
 void GateImplementationsLM::applySingleExcitationPlus(
     std::complex<PrecisionT> *arr, size_t num_qubits,
     const std::vector<size_t> &wires, bool inverse, ParamT angle) {
-    PL_ASSERT(wires.size() == 2);
-    const PrecisionT c = std::cos(angle / 2);
-    const PrecisionT s = inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
-    const std::complex<PrecisionT> e =
-        inverse ? std::exp(-std::complex<PrecisionT>(0, angle / 2))
-                : std::exp(std::complex<PrecisionT>(0, angle / 2));
-    const size_t rev_wire0 = num_qubits - wires[1] - 1;
-    const size_t rev_wire1 = num_qubits - wires[0] - 1;
-    const size_t rev_wire0_shift = static_cast<size_t>(1U) << rev_wire0;
-    const size_t rev_wire1_shift = static_cast<size_t>(1U) << rev_wire1;
-    const auto [parity_high, parity_middle, parity_low] =
-        revWireParity(rev_wire0, rev_wire1);
-
-    for (size_t k = 0; k < exp2(num_qubits - 2); k++) {
-        const size_t i00 = ((k << 2U) & parity_high) |
-                           ((k << 1U) & parity_middle) | (k & parity_low);
-        const size_t i10 = i00 | rev_wire1_shift;
-        const size_t i01 = i00 | rev_wire0_shift;
-        const size_t i11 = i00 | rev_wire0_shift | rev_wire1_shift;
-        const std::complex<PrecisionT> v01 = arr[i01];
-        const std::complex<PrecisionT> v10 = arr[i10];
-        arr[i00] *= e;
-        arr[i01] = c * v01 - s * v10;
-        arr[i10] = s * v01 + c * v10;
-        arr[i11] *= e;
-    }
+    applyPatternGate<Pattern::SingleExcitationPlus>(arr, num_qubits, wires,
+                                                    inverse, angle);
 }
 
 template <class PrecisionT>
@@ -338,6 +268,14 @@ template void GateImplementationsLM::applyMultiQubitOp<double>(
     std::complex<double> *, size_t, const std::complex<double> *,
     const std::vector<size_t> &, bool);
 
+template void GateImplementationsLM::applyDiagonalOp<float>(
+    std::complex<float> *, size_t, const std::complex<float> *,
+    const std::vector<size_t> &, bool);
+
+template void GateImplementationsLM::applyDiagonalOp<double>(
+    std::complex<double> *, size_t, const std::complex<double> *,
+    const std::vector<size_t> &, bool);
+
 /* Single-qubit gates */
 template void
 GateImplementationsLM::applyIdentity<float>(std::complex<float> *, size_t,
@@ -519,6 +457,12 @@ template void GateImplementationsLM::applyMultiRZ<float, float>(
     std::complex<float> *, size_t, const std::vector<size_t> &, bool, float);
 template void GateImplementationsLM::applyMultiRZ<double, double>(
     std::complex<double> *, size_t, const std::vector<size_t> &, bool, double);
+template void
+GateImplementationsLM::applyQFT<float>(std::complex<float> *, size_t,
+                                       const std::vector<size_t> &, bool);
+template void
+GateImplementationsLM::applyQFT<double>(std::complex<double> *, size_t,
+                                        const std::vector<size_t> &, bool);
 
 /* QChem functions */
 template void GateImplementationsLM::applySingleExcitation<float, float>(
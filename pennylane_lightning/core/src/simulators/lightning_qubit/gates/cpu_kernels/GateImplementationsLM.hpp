@@ -16,6 +16,8 @@
  * Defines kernel functions with less memory (and fast)
  */
 #pragma once
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <complex>
 #include <tuple>
@@ -24,6 +26,7 @@
 #include "BitUtil.hpp" // fillLeadingOnes, fillTrailingOnes, bitswap
 #include "Error.hpp"
 #include "GateOperation.hpp"
+#include "GatePatterns.hpp"
 #include "Gates.hpp"
 #include "KernelType.hpp"
 #include "LinearAlgebra.hpp"
@@ -78,6 +81,67 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
                                                rev_wire3});
     }
 
+    /**
+     * @brief Largest number of wires for which the QFT copies each block of
+     * amplitudes into a contiguous buffer before transforming it.
+     */
+    constexpr static size_t qft_buffer_qubits = 14;
+
+    /**
+     * @brief Smallest number of amplitudes for which the blocks of the QFT
+     * are transformed in parallel.
+     */
+    constexpr static size_t qft_omp_threshold = 1U << 16U;
+
+    /**
+     * @brief In-place radix-2 decimation-in-time FFT of `2^n_bits`
+     * amplitudes, normalized by `2^(-n_bits/2)`.
+     *
+     * @param at Accessor returning a reference to amplitude `j`.
+     * @param n_bits Number of bits of the transform.
+     * @param twiddle Accessor returning `exp(+-2 pi i t / 2^n_bits)` for
+     * `t < 2^(n_bits - 1)`.
+     */
+    template <class PrecisionT, class Accessor, class Twiddle>
+    static void fftRadix2(Accessor &&at, size_t n_bits, Twiddle &&twiddle) {
+        const size_t dim = exp2(n_bits);
+        for (size_t j = 0, r = 0; j < dim; j++) {
+            if (j < r) {
+                std::swap(at(j), at(r));
+            }
+            // Increment the bit-reversed counter
+            size_t bit = dim >> 1U;
+            while ((r & bit) != 0) {
+                r ^= bit;
+                bit >>= 1U;
+            }
+            r |= bit;
+        }
+
+        // The twiddles of the first stage are all one
+        const auto norm = static_cast<PrecisionT>(
+            1.0 / std::sqrt(static_cast<double>(dim)));
+        for (size_t g = 0; g < dim; g += 2) {
+            const std::complex<PrecisionT> v0 = at(g);
+            const std::complex<PrecisionT> v1 = at(g + 1);
+            at(g) = norm * (v0 + v1);
+            at(g + 1) = norm * (v0 - v1);
+        }
+        for (size_t stage = 1; stage < n_bits; stage++) {
+            const size_t half = exp2(stage);
+            const size_t shift = n_bits - 1 - stage;
+            for (size_t g = 0; g < dim; g += 2 * half) {
+                for (size_t m = 0; m < half; m++) {
+                    const std::complex<PrecisionT> v0 = at(g + m);
+                    const std::complex<PrecisionT> v1 =
+                        twiddle(m << shift) * at(g + m + half);
+                    at(g + m) = v0 + v1;
+                    at(g + m + half) = v0 - v1;
+                }
+            }
+        }
+    }
+
   public:
     constexpr static KernelType kernel_id = KernelType::LM;
     constexpr static std::string_view name = "LM";
@@ -121,7 +185,8 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
         GateOperation::DoubleExcitation,
         GateOperation::DoubleExcitationMinus,
         GateOperation::DoubleExcitationPlus,
-        GateOperation::MultiRZ};
+        GateOperation::MultiRZ,
+        GateOperation::QFT};
 
     constexpr static std::array implemented_generators = {
         GeneratorOperation::PhaseShift,
@@ -147,7 +212,7 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
 
     constexpr static std::array implemented_matrices = {
         MatrixOperation::SingleQubitOp, MatrixOperation::TwoQubitOp,
-        MatrixOperation::MultiQubitOp};
+        MatrixOperation::MultiQubitOp, MatrixOperation::DiagonalOp};
 
     /**
      * @brief Computes the array of indices to apply the gate corresponding to
@@ -409,6 +474,162 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
         }
     }
 
+    /**
+     * @brief Apply a diagonal matrix given by its diagonal entries.
+     *
+     * Every amplitude is multiplied by the diagonal entry selected by the
+     * bits of its index on `wires`, in a single pass over the statevector.
+     *
+     * @param arr Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     * @param diag Diagonal entries of the matrix, of size 2^(wires.size()).
+     * @param wires Wires the matrix applies to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    template <class PrecisionT>
+    static void applyDiagonalOp(std::complex<PrecisionT> *arr,
+                                std::size_t num_qubits,
+                                const std::complex<PrecisionT> *diag,
+                                const std::vector<std::size_t> &wires,
+                                bool inverse) {
+        constexpr std::size_t one{1};
+        PL_ASSERT(num_qubits >= wires.size());
+
+        const std::size_t n_wires = wires.size();
+        const std::size_t dim = one << n_wires;
+
+        std::vector<std::size_t> rev_wires(n_wires);
+        std::vector<std::size_t> rev_wire_shifts(n_wires);
+        for (std::size_t k = 0; k < n_wires; k++) {
+            rev_wires[k] = (num_qubits - 1) - wires[(n_wires - 1) - k];
+            rev_wire_shifts[k] = (one << rev_wires[k]);
+        }
+        const std::vector<std::size_t> parity =
+            Pennylane::Util::revWireParity(rev_wires);
+
+        // Offsets of the diagonal entries within a block, and the entries
+        // themselves (conjugated for the inverse).
+        std::vector<std::size_t> offsets(dim, 0);
+        std::vector<std::complex<PrecisionT>> factors(diag, diag + dim);
+        for (std::size_t j = 1; j < dim; j++) {
+            for (std::size_t i = 0; i < n_wires; i++) {
+                if ((j & (one << i)) != 0) {
+                    offsets[j] |= rev_wire_shifts[i];
+                }
+            }
+        }
+        if (inverse) {
+            std::transform(factors.cbegin(), factors.cend(), factors.begin(),
+                           [](const auto &v) { return std::conj(v); });
+        }
+
+        for (std::size_t k = 0; k < exp2(num_qubits - n_wires); k++) {
+            std::size_t base = (k & parity[0]);
+            for (std::size_t i = 1; i < parity.size(); i++) {
+                base |= ((k << i) & parity[i]);
+            }
+            for (std::size_t j = 0; j < dim; j++) {
+                arr[base | offsets[j]] *= factors[j];
+            }
+        }
+    }
+
+    /**
+     * @brief Apply a gate declared by its sparsity pattern.
+     *
+     * The loop is generated from the pattern: for each block of
+     * amplitudes sharing the bits outside `wires`, only the amplitudes of
+     * the rows of the pattern are loaded, multiplied by the nonzero entries
+     * and stored back.
+     *
+     * @tparam GatePattern Gate pattern declaration (see GatePatterns.hpp).
+     * @param arr Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     * @param wires Wires the gate applies to.
+     * @param inverse Indicate whether inverse should be taken.
+     * @param params Gate parameters.
+     */
+    template <class GatePattern, class PrecisionT, class... ParamT>
+    static void applyPatternGate(std::complex<PrecisionT> *arr,
+                                 size_t num_qubits,
+                                 const std::vector<size_t> &wires,
+                                 bool inverse, ParamT... params) {
+        static_assert(sizeof...(ParamT) == GatePattern::num_params);
+        using Traits = Pattern::PatternTraits<GatePattern>;
+        constexpr std::size_t one{1};
+        constexpr std::size_t n_wires = Traits::num_wires;
+        constexpr std::size_t num_active = Traits::num_active;
+        PL_ASSERT(wires.size() == n_wires);
+
+        std::array<std::size_t, n_wires> rev_wires{};
+        std::array<std::size_t, n_wires> rev_wire_shifts{};
+        for (std::size_t k = 0; k < n_wires; k++) {
+            rev_wires[k] = (num_qubits - 1) - wires[(n_wires - 1) - k];
+            rev_wire_shifts[k] = (one << rev_wires[k]);
+        }
+        const auto parity = Pennylane::Util::revWireParity(rev_wires);
+
+        // Offsets of the amplitudes the gate touches within a block.
+        std::array<std::size_t, num_active> offsets{};
+        for (std::size_t a = 0; a < num_active; a++) {
+            for (std::size_t i = 0; i < n_wires; i++) {
+                if ((Traits::active_indices[a] & (one << i)) != 0) {
+                    offsets[a] |= rev_wire_shifts[i];
+                }
+            }
+        }
+
+        const auto coeffs =
+            GatePattern::template coefficients<std::complex, PrecisionT>(
+                static_cast<PrecisionT>(params)...);
+        if (inverse) {
+            applyPatternBlocks<GatePattern, true>(arr, num_qubits, parity,
+                                                  offsets, coeffs);
+        } else {
+            applyPatternBlocks<GatePattern, false>(arr, num_qubits, parity,
+                                                   offsets, coeffs);
+        }
+    }
+
+    /**
+     * @brief Loop of applyPatternGate over the blocks of the statevector.
+     *
+     * The adjoint is applied as the conjugate transpose of the pattern.
+     */
+    template <class GatePattern, bool inverse, class PrecisionT,
+              std::size_t n_parity, std::size_t num_active, std::size_t nnz>
+    static void applyPatternBlocks(
+        std::complex<PrecisionT> *arr, size_t num_qubits,
+        const std::array<std::size_t, n_parity> &parity,
+        const std::array<std::size_t, num_active> &offsets,
+        const std::array<std::complex<PrecisionT>, nnz> &coeffs) {
+        using Traits = Pattern::PatternTraits<GatePattern>;
+        constexpr auto entries = Traits::local_entries;
+
+        for (std::size_t k = 0; k < exp2(num_qubits - (n_parity - 1)); k++) {
+            std::size_t base = (k & parity[0]);
+            for (std::size_t i = 1; i < n_parity; i++) {
+                base |= ((k << i) & parity[i]);
+            }
+            std::array<std::complex<PrecisionT>, num_active> v{};
+            for (std::size_t a = 0; a < num_active; a++) {
+                v[a] = arr[base | offsets[a]];
+            }
+            std::array<std::complex<PrecisionT>, num_active> out{};
+            for (std::size_t e = 0; e < nnz; e++) {
+                if constexpr (inverse) {
+                    out[entries[e].col] +=
+                        std::conj(coeffs[e]) * v[entries[e].row];
+                } else {
+                    out[entries[e].row] += coeffs[e] * v[entries[e].col];
+                }
+            }
+            for (std::size_t a = 0; a < num_active; a++) {
+                arr[base | offsets[a]] = out[a];
+            }
+        }
+    }
+
     template <class PrecisionT>
     static void applyIdentity(std::complex<PrecisionT> *arr,
                               const size_t num_qubits,
@@ -1171,38 +1392,8 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
                                       size_t num_qubits,
                                       const std::vector<size_t> &wires,
                                       bool inverse, ParamT angle) {
-        PL_ASSERT(wires.size() == 4);
-        constexpr std::size_t one{1};
-        const PrecisionT cr = std::cos(angle / 2);
-        const PrecisionT sj =
-            inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
-
-        const std::array<std::size_t, 4> rev_wires{
-            num_qubits - wires[3] - 1, num_qubits - wires[2] - 1,
-            num_qubits - wires[1] - 1, num_qubits - wires[0] - 1};
-
-        const std::array<std::size_t, 4> rev_wire_shifts{
-            one << rev_wires[0], one << rev_wires[1], one << rev_wires[2],
-            one << rev_wires[3]};
-
-        const auto parity = Pennylane::Util::revWireParity(rev_wires);
-
-        for (size_t k = 0; k < exp2(num_qubits - 4); k++) {
-            const std::size_t i0000 = ((k << 4U) & parity[4]) |
-                                      ((k << 3U) & parity[3]) |
-                                      ((k << 2U) & parity[2]) |
-                                      ((k << 1U) & parity[1]) | (k & parity[0]);
-            const size_t i0011 =
-                i0000 | rev_wire_shifts[1] | rev_wire_shifts[0];
-            const size_t i1100 =
-                i0000 | rev_wire_shifts[3] | rev_wire_shifts[2];
-
-            const std::complex<PrecisionT> v3 = arr[i0011];
-            const std::complex<PrecisionT> v12 = arr[i1100];
-
-            arr[i0011] = cr * v3 - sj * v12;
-            arr[i1100] = sj * v3 + cr * v12;
-        }
+        applyPatternGate<Pattern::DoubleExcitation>(arr, num_qubits, wires,
+                                                    inverse, angle);
     }
 
     template <class PrecisionT, class ParamT>
@@ -1210,35 +1401,8 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
                                            size_t num_qubits,
                                            const std::vector<size_t> &wires,
                                            bool inverse, ParamT angle) {
-        PL_ASSERT(wires.size() == 4);
-        constexpr std::size_t one{1};
-        const PrecisionT cr = std::cos(angle / 2);
-        const PrecisionT sj =
-            inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
-        const std::complex<PrecisionT> e =
-            inverse ? std::exp(std::complex<PrecisionT>{0, angle / 2})
-                    : std::exp(std::complex<PrecisionT>{0, -angle / 2});
-
-        const std::array<std::size_t, 4> rev_wires{
-            num_qubits - wires[3] - 1, num_qubits - wires[2] - 1,
-            num_qubits - wires[1] - 1, num_qubits - wires[0] - 1};
-
-        const std::array<std::size_t, 4> rev_wire_shifts{
-            one << rev_wires[0], one << rev_wires[1], one << rev_wires[2],
-            one << rev_wires[3]};
-
-        const auto parity = Pennylane::Util::revWireParity(rev_wires);
-
-        for (size_t k = 0; k < exp2(num_qubits - 4); k++) {
-            const auto indices = parity2indices(k, parity, rev_wire_shifts);
-            const std::complex<PrecisionT> v3 = arr[indices[0B0011]];
-            const std::complex<PrecisionT> v12 = arr[indices[0B1100]];
-            for (const auto &i : indices) {
-                arr[i] *= e;
-            }
-            arr[indices[0B0011]] = cr * v3 - sj * v12;
-            arr[indices[0B1100]] = sj * v3 + cr * v12;
-        }
+        applyPatternGate<Pattern::DoubleExcitationMinus>(arr, num_qubits, wires,
+                                                         inverse, angle);
     }
 
     template <class PrecisionT, class ParamT>
@@ -1246,35 +1410,8 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
                                           size_t num_qubits,
                                           const std::vector<size_t> &wires,
                                           bool inverse, ParamT angle) {
-        PL_ASSERT(wires.size() == 4);
-        constexpr std::size_t one{1};
-        const PrecisionT cr = std::cos(angle / 2);
-        const PrecisionT sj =
-            inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
-        const std::complex<PrecisionT> e =
-            inverse ? std::exp(std::complex<PrecisionT>{0, -angle / 2})
-                    : std::exp(std::complex<PrecisionT>{0, angle / 2});
-
-        const std::array<std::size_t, 4> rev_wires{
-            num_qubits - wires[3] - 1, num_qubits - wires[2] - 1,
-            num_qubits - wires[1] - 1, num_qubits - wires[0] - 1};
-
-        const std::array<std::size_t, 4> rev_wire_shifts{
-            one << rev_wires[0], one << rev_wires[1], one << rev_wires[2],
-            one << rev_wires[3]};
-
-        const auto parity = Pennylane::Util::revWireParity(rev_wires);
-
-        for (size_t k = 0; k < exp2(num_qubits - 4); k++) {
-            const auto indices = parity2indices(k, parity, rev_wire_shifts);
-            const std::complex<PrecisionT> v3 = arr[indices[0B0011]];
-            const std::complex<PrecisionT> v12 = arr[indices[0B1100]];
-            for (const auto &i : indices) {
-                arr[i] *= e;
-            }
-            arr[indices[0B0011]] = cr * v3 - sj * v12;
-            arr[indices[0B1100]] = sj * v3 + cr * v12;
-        }
+        applyPatternGate<Pattern::DoubleExcitationPlus>(arr, num_qubits, wires,
+                                                        inverse, angle);
     }
 
     /* Multi-qubit gates */
@@ -1301,6 +1438,141 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
         }
     }
 
+    /**
+     * @brief Apply the quantum Fourier transform, with `wires[0]` as the
+     * most significant bit, as a radix-2 FFT over each block of amplitudes
+     * sharing the bits outside the wires.
+     *
+     * Blocks of up to `qft_buffer_qubits` wires are copied into a contiguous
+     * buffer, so that the whole transform takes a single pass over the
+     * state vector. Larger blocks are transformed in place. Blocks are
+     * distributed over OpenMP threads, each with its own buffer.
+     */
+    template <class PrecisionT>
+    static void applyQFT(std::complex<PrecisionT> *arr, size_t num_qubits,
+                         const std::vector<size_t> &wires, bool inverse) {
+        using ComplexT = std::complex<PrecisionT>;
+        const size_t n_wires = wires.size();
+        PL_ASSERT(n_wires >= 1 && n_wires <= num_qubits);
+        const size_t dim = exp2(n_wires);
+
+        std::vector<size_t> rev_wires(n_wires);
+        for (size_t k = 0; k < n_wires; k++) {
+            rev_wires[k] = num_qubits - 1 - wires[k];
+        }
+        const auto parity = Pennylane::Util::revWireParity(rev_wires);
+        auto blockBase = [&parity](size_t k) {
+            size_t base = (k & parity[0]);
+            for (size_t i = 1; i < parity.size(); i++) {
+                base |= ((k << i) & parity[i]);
+            }
+            return base;
+        };
+
+        // Offsets of the amplitudes of a block, split into two tables over
+        // the high and low bits of the amplitude index.
+        auto offsetTable = [&rev_wires](size_t first, size_t count) {
+            std::vector<size_t> offsets(exp2(count), 0);
+            for (size_t k = 0; k < count; k++) {
+                const size_t half = size_t{1} << k;
+                const size_t shift = size_t{1}
+                                     << rev_wires[first + count - 1 - k];
+                for (size_t i = 0; i < half; i++) {
+                    offsets[half + i] = offsets[i] | shift;
+                }
+            }
+            return offsets;
+        };
+        const size_t lo_bits = n_wires / 2;
+        const size_t lo_mask = exp2(lo_bits) - 1;
+        const auto offsets_hi = offsetTable(0, n_wires - lo_bits);
+        const auto offsets_lo = offsetTable(n_wires - lo_bits, lo_bits);
+
+        // Entry t of a twiddle table is exp(+-2 pi i t * step / dim)
+        const double sign = inverse ? -1.0 : 1.0;
+        auto twiddleTable = [dim, sign](size_t count, size_t step) {
+            std::vector<ComplexT> table(count);
+            for (size_t t = 0; t < count; t++) {
+                const double angle = sign * 2 * M_PI *
+                                     static_cast<double>(t * step) /
+                                     static_cast<double>(dim);
+                table[t] = {static_cast<PrecisionT>(std::cos(angle)),
+                            static_cast<PrecisionT>(std::sin(angle))};
+            }
+            return table;
+        };
+
+        const size_t num_blocks = exp2(num_qubits - n_wires);
+        [[maybe_unused]] const bool parallel =
+            num_blocks > 1 && num_blocks * dim >= qft_omp_threshold;
+        if (n_wires <= qft_buffer_qubits) {
+            const auto twiddles = twiddleTable(dim / 2, 1);
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp parallel default(none)                             \
+                    shared(arr, blockBase, offsets_hi, offsets_lo, twiddles,   \
+                           dim, lo_bits, lo_mask, n_wires, num_blocks)         \
+                    if (parallel)
+            #endif
+            // clang-format on
+            {
+                std::vector<ComplexT> buffer(dim);
+                // clang-format off
+                #if defined(_OPENMP)
+                    #pragma omp for
+                #endif
+                // clang-format on
+                for (size_t k = 0; k < num_blocks; k++) {
+                    const size_t base = blockBase(k);
+                    for (size_t j = 0; j < dim; j++) {
+                        buffer[j] = arr[base | offsets_hi[j >> lo_bits] |
+                                        offsets_lo[j & lo_mask]];
+                    }
+                    fftRadix2<PrecisionT>(
+                        [&buffer](size_t j) -> ComplexT & {
+                            return buffer[j];
+                        },
+                        n_wires,
+                        [&twiddles](size_t t) { return twiddles[t]; });
+                    for (size_t j = 0; j < dim; j++) {
+                        arr[base | offsets_hi[j >> lo_bits] |
+                            offsets_lo[j & lo_mask]] = buffer[j];
+                    }
+                }
+            }
+            return;
+        }
+
+        // Twiddles are also split into two tables, so that none of the
+        // tables grows as the whole block.
+        const size_t tw_bits = (n_wires - 1) / 2;
+        const size_t tw_mask = exp2(tw_bits) - 1;
+        const auto twiddles_hi =
+            twiddleTable(exp2(n_wires - 1 - tw_bits), exp2(tw_bits));
+        const auto twiddles_lo = twiddleTable(exp2(tw_bits), 1);
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none)                             \
+                shared(arr, blockBase, offsets_hi, offsets_lo, twiddles_hi,    \
+                       twiddles_lo, lo_bits, lo_mask, tw_bits, tw_mask,        \
+                       n_wires, num_blocks)                                    \
+                if (parallel)
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < num_blocks; k++) {
+            const size_t base = blockBase(k);
+            fftRadix2<PrecisionT>(
+                [&](size_t j) -> ComplexT & {
+                    return arr[base | offsets_hi[j >> lo_bits] |
+                               offsets_lo[j & lo_mask]];
+                },
+                n_wires,
+                [&](size_t t) {
+                    return twiddles_hi[t >> tw_bits] * twiddles_lo[t & tw_mask];
+                });
+        }
+    }
+
     /* Define generators */
     template <class PrecisionT>
     [[nodiscard]] static auto
@@ -1628,6 +1900,12 @@ extern template void GateImplementationsLM::applyMultiQubitOp<float>(
 extern template void GateImplementationsLM::applyMultiQubitOp<double>(
     std::complex<double> *, size_t, const std::complex<double> *,
     const std::vector<size_t> &, bool);
+extern template void GateImplementationsLM::applyDiagonalOp<float>(
+    std::complex<float> *, size_t, const std::complex<float> *,
+    const std::vector<size_t> &, bool);
+extern template void GateImplementationsLM::applyDiagonalOp<double>(
+    std::complex<double> *, size_t, const std::complex<double> *,
+    const std::vector<size_t> &, bool);
 
 // Single-qubit gates
 extern template void
@@ -1792,6 +2070,12 @@ extern template void GateImplementationsLM::applyMultiRZ<float, float>(
     std::complex<float> *, size_t, const std::vector<size_t> &, bool, float);
 extern template void GateImplementationsLM::applyMultiRZ<double, double>(
     std::complex<double> *, size_t, const std::vector<size_t> &, bool, double);
+extern template void
+GateImplementationsLM::applyQFT<float>(std::complex<float> *, size_t,
+                                       const std::vector<size_t> &, bool);
+extern template void
+GateImplementationsLM::applyQFT<double>(std::complex<double> *, size_t,
+                                        const std::vector<size_t> &, bool);
 
 // Three-qubit gates
 extern template void
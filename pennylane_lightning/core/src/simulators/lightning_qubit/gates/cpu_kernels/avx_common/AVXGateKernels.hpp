@@ -32,6 +32,7 @@
 #include "ApplyIsingXY.hpp"
 #include "ApplyIsingYY.hpp"
 #include "ApplyIsingZZ.hpp"
+#include "ApplyPatternGate.hpp"
 #include "ApplyPauliX.hpp"
 #include "ApplyPauliY.hpp"
 #include "ApplyPauliZ.hpp"
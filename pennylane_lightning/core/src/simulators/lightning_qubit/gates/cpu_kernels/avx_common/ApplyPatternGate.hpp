@@ -0,0 +1,170 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines gates declared by their sparsity pattern (see GatePatterns.hpp)
+ * for AVX
+ */
+#pragma once
+#include "AVXConceptType.hpp"
+#include "AVXUtil.hpp"
+#include "BitUtil.hpp"
+#include "GatePatterns.hpp"
+#include "Permutation.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <vector>
+
+namespace Pennylane::LightningQubit::Gates::AVXCommon {
+/**
+ * @brief Gate kernel generated from a gate pattern.
+ *
+ * When every wire of the gate is outside the register (external), the
+ * amplitudes of a row of the pattern are contiguous within a block of
+ * `packed_size / 2` amplitudes. The kernel then loads one register per row of
+ * the pattern, multiplies them by the entries of the pattern and stores the
+ * rows back, as GateImplementationsLM::applyPatternGate does amplitude by
+ * amplitude. Gates acting on a wire inside the register are left to the LM
+ * kernel.
+ *
+ * @tparam PrecisionT Floating point precision of the statevector.
+ * @tparam packed_size Number of floating point values in a register.
+ * @tparam GatePattern Gate pattern declaration.
+ */
+template <typename PrecisionT, size_t packed_size, class GatePattern>
+struct ApplyPatternGate {
+    using PrecisionAVXConcept = AVXConceptType<PrecisionT, packed_size>;
+    using Traits = Pennylane::Gates::Pattern::PatternTraits<GatePattern>;
+
+    constexpr static size_t packed_size_ = packed_size;
+    constexpr static size_t n_wires = Traits::num_wires;
+
+    /**
+     * @brief Check that all wires of the gate are external.
+     */
+    static bool isExternal(const size_t num_qubits,
+                           const std::vector<size_t> &wires) {
+        return std::all_of(wires.begin(), wires.end(), [=](size_t wire) {
+            return wire + internal_wires_v<packed_size> < num_qubits;
+        });
+    }
+
+    /**
+     * @brief Apply the gate when all its wires are external.
+     *
+     * @param arr Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     * @param wires Wires the gate applies to.
+     * @param inverse Indicate whether inverse should be taken.
+     * @param params Parameters of the gate.
+     */
+    template <class... ParamT>
+    static void applyExternal(std::complex<PrecisionT> *arr,
+                              const size_t num_qubits,
+                              const std::vector<size_t> &wires, bool inverse,
+                              ParamT... params) {
+        static_assert(sizeof...(ParamT) == GatePattern::num_params);
+        constexpr size_t one{1};
+        constexpr size_t num_active = Traits::num_active;
+        PL_ASSERT(wires.size() == n_wires);
+        PL_ASSERT(isExternal(num_qubits, wires));
+
+        std::array<size_t, n_wires> rev_wires{};
+        std::array<size_t, n_wires> rev_wire_shifts{};
+        for (size_t k = 0; k < n_wires; k++) {
+            rev_wires[k] = (num_qubits - 1) - wires[(n_wires - 1) - k];
+            rev_wire_shifts[k] = (one << rev_wires[k]);
+        }
+        const auto parity = Pennylane::Util::revWireParity(rev_wires);
+
+        std::array<size_t, num_active> offsets{};
+        for (size_t a = 0; a < num_active; a++) {
+            for (size_t i = 0; i < n_wires; i++) {
+                if ((Traits::active_indices[a] & (one << i)) != 0) {
+                    offsets[a] |= rev_wire_shifts[i];
+                }
+            }
+        }
+
+        const auto coeffs =
+            GatePattern::template coefficients<std::complex, PrecisionT>(
+                static_cast<PrecisionT>(params)...);
+        if (inverse) {
+            applyExternalBlocks<true>(arr, num_qubits, parity, offsets,
+                                      coeffs);
+        } else {
+            applyExternalBlocks<false>(arr, num_qubits, parity, offsets,
+                                       coeffs);
+        }
+    }
+
+    /**
+     * @brief Loop of applyExternal over the blocks of the statevector.
+     *
+     * The adjoint is applied as the conjugate transpose of the pattern.
+     */
+    template <bool inverse, size_t n_parity, size_t num_active, size_t nnz>
+    static void applyExternalBlocks(
+        std::complex<PrecisionT> *arr, const size_t num_qubits,
+        const std::array<size_t, n_parity> &parity,
+        const std::array<size_t, num_active> &offsets,
+        const std::array<std::complex<PrecisionT>, nnz> &coeffs) {
+        using namespace Permutation;
+        // Arrays of intrinsic types, whose alignment std::array would drop
+        using AVXT = AVXIntrinsicType<PrecisionT, packed_size>;
+        constexpr auto entries = Traits::local_entries;
+        constexpr static auto swap_real_imag = compilePermutation<PrecisionT>(
+            swapRealImag(identity<packed_size>()));
+
+        AVXT coeffs_real[nnz];
+        AVXT coeffs_imag[nnz];
+        for (size_t e = 0; e < nnz; e++) {
+            const PrecisionT imag_part =
+                inverse ? -std::imag(coeffs[e]) : std::imag(coeffs[e]);
+            coeffs_real[e] =
+                set1<PrecisionT, packed_size>(std::real(coeffs[e]));
+            coeffs_imag[e] = set1<PrecisionT, packed_size>(imag_part) *
+                             imagFactor<PrecisionT, packed_size>();
+        }
+
+        for (size_t k = 0; k < exp2(num_qubits - (n_parity - 1));
+             k += packed_size / 2) {
+            size_t base = (k & parity[0]);
+            for (size_t i = 1; i < n_parity; i++) {
+                base |= ((k << i) & parity[i]);
+            }
+            AVXT v[num_active];
+            AVXT v_swapped[num_active];
+            AVXT out[num_active];
+            for (size_t a = 0; a < num_active; a++) {
+                v[a] = PrecisionAVXConcept::load(arr + (base | offsets[a]));
+                v_swapped[a] = permute<swap_real_imag>(v[a]);
+                out[a] = set1<PrecisionT, packed_size>(0.0);
+            }
+            for (size_t e = 0; e < nnz; e++) {
+                const size_t dst = inverse ? entries[e].col : entries[e].row;
+                const size_t src = inverse ? entries[e].row : entries[e].col;
+                out[dst] += coeffs_real[e] * v[src] +
+                            coeffs_imag[e] * v_swapped[src];
+            }
+            for (size_t a = 0; a < num_active; a++) {
+                PrecisionAVXConcept::store(arr + (base | offsets[a]), out[a]);
+            }
+        }
+    }
+};
+} // namespace Pennylane::LightningQubit::Gates::AVXCommon
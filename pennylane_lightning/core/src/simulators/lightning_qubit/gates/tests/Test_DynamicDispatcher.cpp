@@ -65,6 +65,17 @@ TEMPLATE_TEST_CASE("Test DynamicDispatcher constructors", "[DynamicDispatcher]",
                   "DynamicDispatcher is not copy constructible.");
 }
 
+TEMPLATE_TEST_CASE("DynamicDispatcher registers kernels on first use",
+                   "[DynamicDispatcher]", float, double) {
+    using Pennylane::Gates::KernelType;
+    using DispatcherT = DynamicDispatcher<TestType>;
+    auto &dispatcher = DispatcherT::getInstance();
+
+    REQUIRE(&dispatcher == &DispatcherT::getRegistrationInstance());
+    REQUIRE(dispatcher.isRegisteredKernel(KernelType::LM));
+    REQUIRE(dispatcher.isRegisteredKernel(KernelType::PI));
+}
+
 TEMPLATE_TEST_CASE("Print registered kernels", "[DynamicDispatcher]", float,
                    double) {
     using Pennylane::Util::operator<<;
@@ -770,6 +770,46 @@ void testApplyMultiQubitOp() {
     }
 }
 
+template <typename PrecisionT, class GateImplementation>
+void testApplyDiagonalOp() {
+    using Pennylane::LightningQubit::Gates::GateImplementationsLM;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 4;
+    const auto margin = PrecisionT{1e-5};
+
+    for (const auto &wires : std::vector<std::vector<size_t>>{
+             {2}, {3, 1}, {2, 0, 3}, {0, 1, 2, 3}}) {
+        for (const bool inverse : {false, true}) {
+            DYNAMIC_SECTION(GateImplementation::name
+                            << ", wires = " << wires.size()
+                            << ", inverse = " << inverse << " - "
+                            << PrecisionToName<PrecisionT>::value) {
+                const size_t dim = size_t{1} << wires.size();
+                std::uniform_real_distribution<PrecisionT> dist(-M_PI, M_PI);
+                std::vector<std::complex<PrecisionT>> diag(dim);
+                std::vector<std::complex<PrecisionT>> matrix(dim * dim, 0.0);
+                for (size_t i = 0; i < dim; i++) {
+                    diag[i] = std::polar(PrecisionT{1.0}, dist(re));
+                    matrix[i * dim + i] = diag[i];
+                }
+                const auto ini_st =
+                    createRandomStateVectorData<PrecisionT>(re, num_qubits);
+
+                auto expected = ini_st;
+                GateImplementationsLM::applyMultiQubitOp(
+                    expected.data(), num_qubits, matrix.data(), wires,
+                    inverse);
+
+                auto st = ini_st;
+                GateImplementation::applyDiagonalOp(
+                    st.data(), num_qubits, diag.data(), wires, inverse);
+
+                REQUIRE(st == approx(expected).margin(margin));
+            }
+        }
+    }
+}
+
 template <typename PrecisionT, typename TypeList>
 void testApplyMatrixForKernels() {
     using Pennylane::Gates::MatrixOperation;
@@ -788,6 +828,10 @@ void testApplyMatrixForKernels() {
                                      MatrixOperation::MultiQubitOp)) {
             testApplyMultiQubitOp<PrecisionT, GateImplementation>();
         }
+        if constexpr (array_has_elem(GateImplementation::implemented_matrices,
+                                     MatrixOperation::DiagonalOp)) {
+            testApplyDiagonalOp<PrecisionT, GateImplementation>();
+        }
         testApplyMatrixForKernels<PrecisionT, typename TypeList::Next>();
     }
 }
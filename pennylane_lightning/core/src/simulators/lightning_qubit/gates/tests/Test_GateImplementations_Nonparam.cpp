@@ -12,8 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include <algorithm>
+#include <cmath>
 #include <complex>
 #include <limits>
+#include <random>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -25,11 +27,16 @@
 #include "TestKernels.hpp"
 #include "Util.hpp" // ConstMult, INVSQRT2, IMAG, ZERO
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 /**
  * @file Test_GateImplementations_Nonparam.cpp
  *
  * This file contains tests for non-parameterized gates. List of such gates are
- * [PauliX, PauliY, PauliZ, Hadamard, S, T, CNOT, SWAP, CZ, Toffoli, CSWAP].
+ * [PauliX, PauliY, PauliZ, Hadamard, S, T, CNOT, SWAP, CZ, Toffoli, CSWAP,
+ * QFT].
  */
 
 /// @cond DEV
@@ -651,3 +658,152 @@ template <typename PrecisionT, class GateImplementation> void testApplyCSWAP() {
     }
 }
 PENNYLANE_RUN_TEST(CSWAP);
+
+/*******************************************************************************
+ * Multi-qubit gates
+ ******************************************************************************/
+/**
+ * @brief Index of the amplitude `idx` in the basis of the given wires, with
+ * `wires[0]` as the most significant bit.
+ */
+inline auto localIndex(size_t idx, size_t num_qubits,
+                       const std::vector<size_t> &wires) -> size_t {
+    size_t local = 0;
+    for (const size_t wire : wires) {
+        local = (local << 1U) | ((idx >> (num_qubits - 1 - wire)) & 1U);
+    }
+    return local;
+}
+
+/**
+ * @brief Apply the dense QFT matrix `exp(+-2 pi i m n / 2^k) / sqrt(2^k)` to
+ * the given wires.
+ */
+template <class ComplexVectorT>
+auto applyDenseQFT(const ComplexVectorT &st, size_t num_qubits,
+                   const std::vector<size_t> &wires, bool inverse)
+    -> ComplexVectorT {
+    using ComplexT = typename ComplexVectorT::value_type;
+    const size_t dim = exp2(wires.size());
+    const double sign = inverse ? -1.0 : 1.0;
+    size_t wires_mask = 0;
+    for (const size_t wire : wires) {
+        wires_mask |= size_t{1} << (num_qubits - 1 - wire);
+    }
+
+    auto result = st;
+    for (size_t idx = 0; idx < st.size(); idx++) {
+        const size_t row = localIndex(idx, num_qubits, wires);
+        std::complex<double> sum{0.0, 0.0};
+        for (size_t src = idx & ~wires_mask; src < st.size(); src++) {
+            if ((src & ~wires_mask) != (idx & ~wires_mask)) {
+                continue;
+            }
+            const size_t col = localIndex(src, num_qubits, wires);
+            const double angle = sign * 2 * M_PI *
+                                 static_cast<double>((row * col) % dim) /
+                                 static_cast<double>(dim);
+            sum += std::polar(1.0, angle) * std::complex<double>(st[src]);
+        }
+        result[idx] = ComplexT(sum / std::sqrt(static_cast<double>(dim)));
+    }
+    return result;
+}
+
+template <typename PrecisionT, class GateImplementation> void testApplyQFT() {
+    std::mt19937 re{1337};
+
+    const size_t num_qubits = 6;
+    const auto ini_st = createRandomStateVectorData<PrecisionT>(re, num_qubits);
+    const std::vector<std::vector<size_t>> all_wires{
+        {2},          {4, 1},          {0, 3, 5},
+        {5, 1, 3, 0}, {1, 2, 3, 4, 5}, {3, 0, 5, 2, 4, 1}};
+
+    for (const auto &wires : all_wires) {
+        for (const bool inverse : {false, true}) {
+            DYNAMIC_SECTION(GateImplementation::name
+                            << ", QFT on " << wires.size()
+                            << " wires, inverse = " << inverse << " - "
+                            << PrecisionToName<PrecisionT>::value) {
+                const auto expected =
+                    applyDenseQFT(ini_st, num_qubits, wires, inverse);
+                auto st = ini_st;
+                GateImplementation::applyQFT(st.data(), num_qubits, wires,
+                                             inverse);
+                REQUIRE(st == approx(expected).margin(PrecisionT{1e-6}));
+            }
+        }
+    }
+
+    // Blocks too large to be copied into a buffer are transformed in place.
+    // The QFT maps |x> to sum_y exp(2 pi i x y / N) |y> / sqrt(N).
+    DYNAMIC_SECTION(GateImplementation::name
+                    << ", QFT on 15 of 16 wires - "
+                    << PrecisionToName<PrecisionT>::value) {
+        const size_t num_qubits = 16;
+        std::vector<size_t> wires{15, 2, 0, 1};
+        for (size_t wire = 4; wire < 15; wire++) {
+            wires.push_back(wire);
+        }
+        const size_t dim = exp2(wires.size());
+        const size_t x = 12345;
+
+        // Wire 3 is set and the other wires are in the state |x>
+        size_t ini_idx = size_t{1} << (num_qubits - 1 - 3);
+        for (size_t i = 0; i < wires.size(); i++) {
+            if (((x >> (wires.size() - 1 - i)) & 1U) != 0) {
+                ini_idx |= size_t{1} << (num_qubits - 1 - wires[i]);
+            }
+        }
+
+        for (const bool inverse : {false, true}) {
+            const double sign = inverse ? -1.0 : 1.0;
+            std::vector<std::complex<PrecisionT>> expected(exp2(num_qubits));
+            for (size_t idx = 0; idx < expected.size(); idx++) {
+                if (((idx >> (num_qubits - 1 - 3)) & 1U) == 0) {
+                    continue;
+                }
+                const size_t y = localIndex(idx, num_qubits, wires);
+                const double angle = sign * 2 * M_PI *
+                                     static_cast<double>((x * y) % dim) /
+                                     static_cast<double>(dim);
+                expected[idx] = std::complex<PrecisionT>(
+                    std::polar(1.0, angle) /
+                    std::sqrt(static_cast<double>(dim)));
+            }
+
+            std::vector<std::complex<PrecisionT>> st(exp2(num_qubits));
+            st[ini_idx] = 1.0;
+            GateImplementation::applyQFT(st.data(), num_qubits, wires,
+                                         inverse);
+            REQUIRE(st == approx(expected).margin(PrecisionT{1e-6}));
+        }
+    }
+
+#if defined(_OPENMP)
+    // Blocks of large state vectors are distributed over threads.
+    DYNAMIC_SECTION(GateImplementation::name
+                    << ", QFT with several threads - "
+                    << PrecisionToName<PrecisionT>::value) {
+        const size_t num_qubits = 17;
+        const auto ini_st =
+            createRandomStateVectorData<PrecisionT>(re, num_qubits);
+        const int prev_threads = omp_get_max_threads();
+        for (const auto &wires : std::vector<std::vector<size_t>>{
+                 {3, 16, 0, 9}, {16, 2, 0, 1, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+                                 13, 14, 15}}) {
+            auto expected = ini_st;
+            omp_set_num_threads(1);
+            GateImplementation::applyQFT(expected.data(), num_qubits, wires,
+                                         false);
+            auto st = ini_st;
+            omp_set_num_threads(4);
+            GateImplementation::applyQFT(st.data(), num_qubits, wires,
+                                         false);
+            REQUIRE(st == approx(expected).margin(PrecisionT{1e-6}));
+        }
+        omp_set_num_threads(prev_threads);
+    }
+#endif
+}
+PENNYLANE_RUN_TEST(QFT);
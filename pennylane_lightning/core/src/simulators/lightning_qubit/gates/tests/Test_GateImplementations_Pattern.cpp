@@ -0,0 +1,142 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "ConstantUtil.hpp" // lookup
+#include "DynamicDispatcher.hpp"
+#include "GatePatterns.hpp"
+#include "TestHelpers.hpp"
+#include "cpu_kernels/GateImplementationsLM.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <complex>
+#include <random>
+#include <vector>
+
+/**
+ * @file
+ * We test the kernels generated from gate patterns, and every kernel
+ * registered for the pattern gates, against the dense matrix of the pattern
+ * applied by the PI kernel. The gate values themselves are covered by the LM
+ * tests of each gate.
+ */
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::LightningQubit;
+using namespace Pennylane::Util;
+using namespace Pennylane::LightningQubit::Gates;
+namespace Pattern = Pennylane::Gates::Pattern;
+} // namespace
+/// @endcond
+
+static_assert(Pattern::PatternTraits<Pattern::DoubleExcitation>::num_active ==
+              2);
+static_assert(Pattern::PatternTraits<Pattern::DoubleExcitation>::
+                  active_indices[1] == 0b1100);
+static_assert(
+    Pattern::PatternTraits<Pattern::DoubleExcitationMinus>::num_active == 16);
+static_assert(Pattern::PatternTraits<Pattern::SingleExcitation>::
+                  local_entries[1]
+                      .col == 1);
+
+/**
+ * @brief Dense matrix of a gate pattern, with identity rows for the rows
+ * missing from the pattern.
+ */
+template <typename PrecisionT, class GatePattern>
+auto createPatternMatrix(PrecisionT angle)
+    -> std::vector<std::complex<PrecisionT>> {
+    const size_t dim = size_t{1} << GatePattern::num_wires;
+    const auto coeffs =
+        GatePattern::template coefficients<std::complex, PrecisionT>(angle);
+    std::vector<std::complex<PrecisionT>> matrix(dim * dim, 0.0);
+    std::vector<bool> active(dim, false);
+    for (size_t e = 0; e < coeffs.size(); e++) {
+        const auto &entry = GatePattern::entries[e];
+        matrix[entry.row * dim + entry.col] = coeffs[e];
+        active[entry.row] = true;
+    }
+    for (size_t idx = 0; idx < dim; idx++) {
+        if (!active[idx]) {
+            matrix[idx * dim + idx] = 1.0;
+        }
+    }
+    return matrix;
+}
+
+template <typename PrecisionT, class GatePattern>
+void testPatternGate(std::mt19937 &re) {
+    const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+    const auto gate_name = lookup(Constant::gate_names, GatePattern::op);
+    const size_t num_qubits = 8;
+    const PrecisionT angle = 0.312;
+
+    // The first two wire sets of each gate only act on wires outside the AVX
+    // registers, which the generated AVX kernels apply without LM.
+    const std::vector<std::vector<size_t>> all_wires =
+        (GatePattern::num_wires == 2)
+            ? std::vector<std::vector<size_t>>{{0, 1}, {4, 1}, {7, 2}}
+            : std::vector<std::vector<size_t>>{
+                  {0, 1, 2, 3}, {3, 0, 4, 1}, {5, 1, 3, 0}, {2, 4, 0, 7}};
+
+    std::vector<KernelType> kernels;
+    for (const auto kernel : dispatcher.registeredKernels()) {
+        if (dispatcher.registeredGatesForKernel(kernel).contains(
+                GatePattern::op)) {
+            kernels.push_back(kernel);
+        }
+    }
+
+    for (const auto &wires : all_wires) {
+        for (const bool inverse : {false, true}) {
+            DYNAMIC_SECTION(gate_name << " - wires = " << wires[0] << ", "
+                                      << wires[1] << ", inverse = "
+                                      << inverse) {
+                const auto ini_st =
+                    createRandomStateVectorData<PrecisionT>(re, num_qubits);
+
+                auto expected = ini_st;
+                dispatcher.applyMatrix(
+                    KernelType::PI, expected.data(), num_qubits,
+                    createPatternMatrix<PrecisionT, GatePattern>(angle).data(),
+                    wires, inverse);
+
+                auto result = ini_st;
+                GateImplementationsLM::applyPatternGate<GatePattern>(
+                    result.data(), num_qubits, wires, inverse, angle);
+                REQUIRE(result == approx(expected).margin(PrecisionT{1e-6}));
+
+                for (const auto kernel : kernels) {
+                    INFO("Kernel " << dispatcher.getKernelName(kernel));
+                    auto st = ini_st;
+                    dispatcher.applyOperation(kernel, st.data(), num_qubits,
+                                              GatePattern::op, wires, inverse,
+                                              {angle});
+                    REQUIRE(st == approx(expected).margin(PrecisionT{1e-6}));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("GateImplementationsLM::applyPatternGate",
+                   "[GateImplementations_Pattern]", float, double) {
+    std::mt19937 re{1337};
+    testPatternGate<TestType, Pattern::SingleExcitation>(re);
+    testPatternGate<TestType, Pattern::SingleExcitationMinus>(re);
+    testPatternGate<TestType, Pattern::SingleExcitationPlus>(re);
+    testPatternGate<TestType, Pattern::DoubleExcitation>(re);
+    testPatternGate<TestType, Pattern::DoubleExcitationMinus>(re);
+    testPatternGate<TestType, Pattern::DoubleExcitationPlus>(re);
+}
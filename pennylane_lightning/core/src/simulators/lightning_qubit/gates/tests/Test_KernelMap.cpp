@@ -51,6 +51,15 @@ TEST_CASE("Test PriorityDispatchSet", "[PriorityDispatchSet]") {
     }
 }
 
+TEST_CASE("Test default kernels are assigned on first use", "[KernelMap]") {
+    using Pennylane::Gates::GateOperation;
+    auto &instance = OperationKernelMap<GateOperation>::getInstance();
+    REQUIRE(&instance ==
+            &OperationKernelMap<GateOperation>::getAssignmentInstance());
+    REQUIRE_NOTHROW(instance.getKernelMap(4, Threading::SingleThread,
+                                          CPUMemoryModel::Unaligned));
+}
+
 TEST_CASE("Test default kernels for gates are well defined", "[KernelMap]") {
     auto &instance =
         OperationKernelMap<Pennylane::Gates::GateOperation>::getInstance();
@@ -116,7 +125,9 @@ TEST_CASE("Test several limiting cases of default kernels", "[KernelMap]") {
         for_each_enum<Pennylane::Gates::GateOperation>(
             [&gate_map](Pennylane::Gates::GateOperation gate_op) {
                 INFO(lookup(Pennylane::Gates::Constant::gate_names, gate_op));
-                if (gate_op == Pennylane::Gates::GateOperation::MultiRZ) {
+                if (array_has_elem(
+                        Pennylane::Gates::Constant::multi_qubit_gates,
+                        gate_op)) {
                     REQUIRE(gate_map[gate_op] ==
                             Pennylane::Gates::KernelType::LM);
                 } else if (lookup(Pennylane::Gates::Constant::gate_wires,
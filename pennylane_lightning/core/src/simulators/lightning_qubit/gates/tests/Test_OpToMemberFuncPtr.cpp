@@ -164,6 +164,7 @@ class DummyImplementation {
     PENNYLANE_TESTS_DEFINE_GATE_OP(DoubleExcitationMinus, 1)
     PENNYLANE_TESTS_DEFINE_GATE_OP(DoubleExcitationPlus, 1)
     PENNYLANE_TESTS_DEFINE_GATE_OP(MultiRZ, 1)
+    PENNYLANE_TESTS_DEFINE_GATE_OP(QFT, 0)
 
     PENNYLANE_TESTS_DEFINE_GENERATOR_OP(PhaseShift)
     PENNYLANE_TESTS_DEFINE_GENERATOR_OP(RX)
@@ -21,14 +21,21 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
 #include <complex>
 #include <cstdio>
+#include <numeric>
 #include <random>
+#include <span>
 #include <stack>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
 
+#include "BitUtil.hpp" // revWireParity
 #include "LinearAlgebra.hpp"
 #include "MeasurementsBase.hpp"
 #include "Observables.hpp"
@@ -36,7 +43,7 @@
 #include "StateVectorLQubitManaged.hpp"
 #include "StateVectorLQubitRaw.hpp"
 #include "TransitionKernels.hpp"
-#include "Util.hpp" //transpose_state_tensor, sorting_indices
+#include "Util.hpp" //transposed_state_index, sorting_indices
 
 /// @cond DEV
 namespace {
@@ -97,6 +104,24 @@ class Measurements final
     std::vector<PrecisionT>
     probs(const std::vector<size_t> &wires,
           [[maybe_unused]] const std::vector<size_t> &device_wires = {}) {
+        std::vector<PrecisionT> probabilities(size_t{1} << wires.size());
+        probs(wires, std::span{probabilities});
+        return probabilities;
+    }
+
+    /**
+     * @brief Probabilities for a subset of the full system, written into a
+     * caller-provided buffer.
+     *
+     * @param wires Wires will restrict probabilities to a subset
+     * of the full system.
+     * @param probabilities Buffer of size `2^wires.size()` receiving the
+     * probabilities. The basis columns are rearranged according to wires.
+     */
+    void probs(const std::vector<size_t> &wires,
+               std::span<PrecisionT> probabilities) {
+        PL_ABORT_IF_NOT(probabilities.size() == (size_t{1} << wires.size()),
+                        "The output array has the wrong size.");
         // Determining index that would sort the vector.
         // This information is needed later.
         const auto sorted_ind_wires = Pennylane::Util::sorting_indices(wires);
@@ -116,20 +141,132 @@ class Measurements final
             Gates::getIndicesAfterExclusion(sorted_wires, num_qubits),
             num_qubits);
 
-        std::vector<PrecisionT> probabilities(all_indices.size(), 0);
-
-        size_t ind_probs = 0;
-        for (auto index : all_indices) {
+        // Each output index reads the sorted-wire index it is transposed
+        // from, so the probabilities are rearranged according to wires
+        // without an intermediate buffer.
+        const bool transpose = (wires != sorted_wires);
+        for (size_t ind_probs = 0; ind_probs < all_indices.size();
+             ind_probs++) {
+            const size_t index =
+                all_indices[transpose ? Pennylane::Util::transposed_state_index(
+                                            ind_probs, sorted_ind_wires)
+                                      : ind_probs];
+            PrecisionT probability{0.0};
             for (auto offset : all_offsets) {
-                probabilities[ind_probs] += std::norm(arr_data[index + offset]);
+                probability += std::norm(arr_data[index + offset]);
+            }
+            probabilities[ind_probs] = probability;
+        }
+    }
+
+    /**
+     * @brief Probabilities for a subset of the full system, measured in the
+     * eigenbases of single-qubit observables.
+     *
+     * The basis change is applied to blocks of `2^wires.size()` amplitudes
+     * held in a local buffer, so the statevector is read once and never
+     * copied or modified.
+     *
+     * @param wires Wires to measure. Output indices follow this order, with
+     * `wires[0]` as the most significant bit.
+     * @param bases Observable measured on each wire. One of PauliX, PauliY,
+     * PauliZ and Hadamard.
+     * @return Floating point std::vector with probabilities.
+     */
+    auto probsInBasis(const std::vector<size_t> &wires,
+                      const std::vector<std::string> &bases)
+        -> std::vector<PrecisionT> {
+        const size_t num_qubits = this->_statevector.getNumQubits();
+        const size_t num_wires = wires.size();
+        PL_ABORT_IF_NOT(num_wires == bases.size(),
+                        "The number of wires and bases must be equal.");
+        PL_ABORT_IF_NOT(num_wires <= num_qubits,
+                        "The number of wires must not exceed the number of "
+                        "qubits.");
+        if (num_wires == 0) {
+            const auto all_probs = probs();
+            return {std::accumulate(all_probs.begin(), all_probs.end(),
+                                    PrecisionT{0.0})};
+        }
+
+        std::vector<size_t> rev_wires(num_wires);
+        std::vector<std::array<ComplexT, 4>> rotations(num_wires);
+        for (size_t i = 0; i < num_wires; i++) {
+            PL_ABORT_IF_NOT(wires[i] < num_qubits, "Invalid wire index.");
+            rev_wires[i] = num_qubits - 1 - wires[i];
+            rotations[i] = getBasisRotation(bases[i]);
+        }
+        auto sorted_wires = rev_wires;
+        std::sort(sorted_wires.begin(), sorted_wires.end());
+        PL_ABORT_IF(std::adjacent_find(sorted_wires.begin(),
+                                       sorted_wires.end()) !=
+                        sorted_wires.end(),
+                    "Wires must be unique.");
+
+        const size_t dim = Pennylane::Util::exp2(num_wires);
+        std::vector<size_t> local_offsets(dim, 0);
+        for (size_t j = 0; j < dim; j++) {
+            for (size_t i = 0; i < num_wires; i++) {
+                local_offsets[j] |= ((j >> (num_wires - 1 - i)) & 1U)
+                                    << rev_wires[i];
             }
-            ind_probs++;
         }
-        // Transposing the probabilities tensor with the indices determined
-        // at the beginning.
-        if (wires != sorted_wires) {
-            probabilities = Pennylane::Util::transpose_state_tensor(
-                probabilities, sorted_ind_wires);
+        const auto parity = Pennylane::Util::revWireParity(rev_wires);
+
+        const ComplexT *arr = this->_statevector.getData();
+        const size_t num_blocks =
+            Pennylane::Util::exp2(num_qubits - num_wires);
+        const size_t num_parity = parity.size();
+        std::vector<PrecisionT> probabilities(dim, 0);
+
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel default(none)                                 \
+                shared(arr, parity, local_offsets, rotations, probabilities,   \
+                       dim, num_blocks, num_parity, num_wires)                 \
+                if (num_blocks * dim > fused_probs_omp_threshold)
+        #endif
+        // clang-format on
+        {
+            std::vector<ComplexT> buffer(dim);
+            std::vector<PrecisionT> local_probs(dim, 0);
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp for
+            #endif
+            // clang-format on
+            for (size_t k = 0; k < num_blocks; k++) {
+                size_t offset = (k & parity[0]);
+                for (size_t i = 1; i < num_parity; i++) {
+                    offset |= ((k << i) & parity[i]);
+                }
+                for (size_t j = 0; j < dim; j++) {
+                    buffer[j] = arr[offset | local_offsets[j]];
+                }
+                for (size_t i = 0; i < num_wires; i++) {
+                    const auto &rot = rotations[i];
+                    const size_t mask = size_t{1U} << (num_wires - 1 - i);
+                    for (size_t j = 0; j < dim; j++) {
+                        if ((j & mask) == 0) {
+                            const ComplexT v0 = buffer[j];
+                            const ComplexT v1 = buffer[j | mask];
+                            buffer[j] = rot[0] * v0 + rot[1] * v1;
+                            buffer[j | mask] = rot[2] * v0 + rot[3] * v1;
+                        }
+                    }
+                }
+                for (size_t j = 0; j < dim; j++) {
+                    local_probs[j] += std::norm(buffer[j]);
+                }
+            }
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp critical
+            #endif
+            // clang-format on
+            for (size_t j = 0; j < dim; j++) {
+                probabilities[j] += local_probs[j];
+            }
         }
         return probabilities;
     }
@@ -182,6 +319,8 @@ class Measurements final
      * @brief Expected value of a Sparse Hamiltonian.
      *
      * @tparam index_type integer type used as indices of the sparse matrix.
+     * @tparam entry_index_type integer type of the column indices, which can
+     * be narrower than `index_type`.
      * @param row_map_ptr   row_map array pointer.
      *                      The j element encodes the number of non-zeros
      above
@@ -193,23 +332,18 @@ class Measurements final
      * @param numNNZ        number of non-zero elements.
      * @return Floating point expected value of the observable.
      */
-    template <class index_type>
+    template <class index_type, class entry_index_type = index_type>
     PrecisionT expval(const index_type *row_map_ptr,
                       const index_type row_map_size,
-                      const index_type *entries_ptr, const ComplexT *values_ptr,
-                      const index_type numNNZ) {
+                      const entry_index_type *entries_ptr,
+                      const ComplexT *values_ptr,
+                      [[maybe_unused]] const index_type numNNZ) {
         PL_ABORT_IF(
             (this->_statevector.getLength() != (size_t(row_map_size) - 1)),
             "Statevector and Hamiltonian have incompatible sizes.");
-        auto operator_vector = Util::apply_Sparse_Matrix(
-            this->_statevector.getData(),
-            static_cast<index_type>(this->_statevector.getLength()),
-            row_map_ptr, row_map_size, entries_ptr, values_ptr, numNNZ);
-
-        ComplexT expected_value =
-            innerProdC(this->_statevector.getData(), operator_vector.data(),
-                       this->_statevector.getLength());
-        return std::real(expected_value);
+        return Util::sparseExpval(
+            this->_statevector.getData(), this->_statevector.getLength(),
+            row_map_ptr, entries_ptr, values_ptr);
     };
 
     /**
@@ -245,6 +379,10 @@ class Measurements final
      * @return Floating point expected value of the observable.
      */
     auto expval(const Observable<StateVectorT> &ob) -> PrecisionT {
+        if (const auto *projector =
+                dynamic_cast<const ProjectorObsBase<StateVectorT> *>(&ob)) {
+            return projectorExpval(*projector);
+        }
         PrecisionT result{};
 
         if constexpr (std::is_same_v<typename StateVectorT::MemoryStorageT,
@@ -282,6 +420,63 @@ class Measurements final
         return BaseType::expval(obs, num_shots, shot_range);
     }
 
+    /**
+     * @brief Eigenvalue samples of an observable.
+     *
+     * Samples are drawn from the distribution returned by `probsInBasis`,
+     * which avoids copying and rotating the statevector. Observables acting
+     * on more than `fused_sampling_max_wires` non-identity wires fall back to
+     * the generic implementation.
+     *
+     * @param obs Observable.
+     * @param num_shots Number of shots.
+     * @param shot_range Vector of shot number to measurement.
+     * @param term_idx Index of a Hamiltonian term.
+     * @return Vector of eigenvalue samples, each `1` or `-1`.
+     */
+    auto measure_with_samples(const Observable<StateVectorT> &obs,
+                              const size_t &num_shots,
+                              const std::vector<size_t> &shot_range,
+                              size_t term_idx = 0) -> std::vector<PrecisionT> {
+        std::vector<size_t> ob_wires;
+        std::vector<std::string> ob_names;
+        obs.getShotsBasis(ob_wires, ob_names, term_idx);
+
+        std::vector<size_t> wires;
+        std::vector<std::string> bases;
+        for (size_t i = 0; i < ob_wires.size(); i++) {
+            if (ob_names[i] != "Identity") {
+                wires.push_back(ob_wires[i]);
+                bases.push_back(ob_names[i]);
+            }
+        }
+        if (wires.size() > fused_sampling_max_wires) {
+            return BaseType::measure_with_samples(obs, num_shots, shot_range,
+                                                  term_idx);
+        }
+
+        const size_t num_samples =
+            shot_range.empty() ? num_shots : shot_range.size();
+        std::vector<PrecisionT> obs_samples(num_samples, 1);
+        if (wires.empty()) {
+            // eigen value for Identity gate is `1`
+            return obs_samples;
+        }
+
+        const auto probabilities = probsInBasis(wires, bases);
+        std::mt19937 generator(std::random_device{}());
+        std::discrete_distribution<size_t> distribution(probabilities.begin(),
+                                                        probabilities.end());
+        for (size_t i = 0; i < num_samples; i++) {
+            // the eigen value is -1 if an odd number of wires is measured in
+            // the `1` state
+            if ((std::popcount(distribution(generator)) & 1) == 1) {
+                obs_samples[i] = -1;
+            }
+        }
+        return obs_samples;
+    }
+
     /**
      * @brief Variance value for a general Observable
      *
@@ -289,6 +484,12 @@ class Measurements final
      * @return Floating point with the variance of the observable.
      */
     auto var(const Observable<StateVectorT> &ob) -> PrecisionT {
+        if (const auto *projector =
+                dynamic_cast<const ProjectorObsBase<StateVectorT> *>(&ob)) {
+            // A projector squares to itself
+            const PrecisionT expval = projectorExpval(*projector);
+            return expval - expval * expval;
+        }
         PrecisionT result{};
         if constexpr (std::is_same_v<typename StateVectorT::MemoryStorageT,
                                      MemoryStorageLocation::Internal>) {
@@ -460,6 +661,8 @@ class Measurements final
      * @brief Variance of a sparse Hamiltonian.
      *
      * @tparam index_type integer type used as indices of the sparse matrix.
+     * @tparam entry_index_type integer type of the column indices, which can
+     * be narrower than `index_type`.
      * @param row_map_ptr   row_map array pointer.
      *                      The j element encodes the number of non-zeros
      above
@@ -471,17 +674,19 @@ class Measurements final
      * @param numNNZ        number of non-zero elements.
      * @return Floating point with the variance of the sparse Hamiltonian.
      */
-    template <class index_type>
+    template <class index_type, class entry_index_type = index_type>
     PrecisionT var(const index_type *row_map_ptr, const index_type row_map_size,
-                   const index_type *entries_ptr, const ComplexT *values_ptr,
-                   const index_type numNNZ) {
+                   const entry_index_type *entries_ptr,
+                   const ComplexT *values_ptr,
+                   [[maybe_unused]] const index_type numNNZ) {
         PL_ABORT_IF(
             (this->_statevector.getLength() != (size_t(row_map_size) - 1)),
             "Statevector and Hamiltonian have incompatible sizes.");
-        auto operator_vector = Util::apply_Sparse_Matrix(
-            this->_statevector.getData(),
-            static_cast<index_type>(this->_statevector.getLength()),
-            row_map_ptr, row_map_size, entries_ptr, values_ptr, numNNZ);
+        std::vector<ComplexT> operator_vector(this->_statevector.getLength());
+        Util::sparseMatrixVector(this->_statevector.getData(),
+                                 this->_statevector.getLength(), row_map_ptr,
+                                 entries_ptr, values_ptr,
+                                 operator_vector.data());
 
         const PrecisionT mean_square =
             std::real(innerProdC(operator_vector.data(), operator_vector.data(),
@@ -503,10 +708,27 @@ class Measurements final
      * separated by a stride equal to the number of qubits.
      */
     std::vector<size_t> generate_samples(size_t num_samples) {
+        std::vector<size_t> samples(
+            num_samples * this->_statevector.getNumQubits(), 0);
+        generate_samples(num_samples, std::span{samples});
+        return samples;
+    }
+
+    /**
+     * @brief Generate samples using the alias method, written into a
+     * caller-provided buffer.
+     *
+     * @param num_samples The number of samples to generate.
+     * @param samples Buffer of size `num_samples * num_qubits` receiving the
+     * samples in binary, each sample being separated by a stride equal to the
+     * number of qubits.
+     */
+    void generate_samples(size_t num_samples, std::span<size_t> samples) {
         const size_t num_qubits = this->_statevector.getNumQubits();
+        PL_ABORT_IF_NOT(samples.size() == num_samples * num_qubits,
+                        "The number of wires does not match the state vector.");
         auto &&probabilities = probs();
 
-        std::vector<size_t> samples(num_samples * num_qubits, 0);
         std::mt19937 generator(std::random_device{}());
         std::uniform_real_distribution<PrecisionT> distribution(0.0, 1.0);
         std::unordered_map<size_t, size_t> cache;
@@ -577,10 +799,86 @@ class Measurements final
                 cache[idx] = i;
             }
         }
-        return samples;
     }
 
   private:
+    constexpr static size_t fused_probs_omp_threshold = 1U << 16U;
+    constexpr static size_t fused_sampling_max_wires = 12;
+
+    /**
+     * @brief Expectation value of a projector onto a computational basis
+     * state.
+     *
+     * This is the squared norm of the amplitudes whose bits on the projector
+     * wires match the projected state. Only these 2^(n-k) amplitudes are
+     * read, a single one when the projector acts on every wire.
+     *
+     * @param projector Projector observable.
+     */
+    auto projectorExpval(const ProjectorObsBase<StateVectorT> &projector)
+        -> PrecisionT {
+        const size_t num_qubits = this->_statevector.getNumQubits();
+        const size_t value = projector.getBitMaskAndValue(num_qubits).second;
+
+        // Bit positions of the projector wires, in ascending order
+        std::vector<size_t> bits;
+        for (const size_t wire : projector.getWires()) {
+            bits.push_back(num_qubits - 1 - wire);
+        }
+        std::sort(bits.begin(), bits.end());
+
+        const ComplexT *arr_data = this->_statevector.getData();
+        const size_t num_matching =
+            Pennylane::Util::exp2(num_qubits - bits.size());
+        PrecisionT result{0.0};
+#if defined(_OPENMP)
+#pragma omp parallel for default(none) reduction(+ : result)                   \
+    firstprivate(arr_data, num_matching, value) shared(bits)                   \
+    if (num_matching >= fused_probs_omp_threshold)
+#endif
+        for (size_t k = 0; k < num_matching; k++) {
+            // Insert the projector bits of the projected state into k
+            size_t idx = k;
+            for (const size_t bit : bits) {
+                const size_t low = idx & ((size_t{1U} << bit) - 1);
+                idx = ((idx >> bit) << (bit + 1)) | low;
+            }
+            result += std::norm(arr_data[idx | value]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Single-qubit unitary rotating the eigenbasis of an observable
+     * onto the computational basis, in row-major order. These match the
+     * diagonalizing gates applied by `applyInPlaceShots`.
+     *
+     * @param name Name of the observable.
+     */
+    static auto getBasisRotation(const std::string &name)
+        -> std::array<ComplexT, 4> {
+        const PrecisionT isqrt2 = Pennylane::Util::INVSQRT2<PrecisionT>();
+        if (name == "PauliX") {
+            return {ComplexT{isqrt2, 0}, ComplexT{isqrt2, 0},
+                    ComplexT{isqrt2, 0}, ComplexT{-isqrt2, 0}};
+        }
+        if (name == "PauliY") {
+            return {ComplexT{isqrt2, 0}, ComplexT{0, -isqrt2},
+                    ComplexT{isqrt2, 0}, ComplexT{0, isqrt2}};
+        }
+        if (name == "Hadamard") {
+            const PrecisionT c = std::cos(static_cast<PrecisionT>(M_PI / 8.0));
+            const PrecisionT s = std::sin(static_cast<PrecisionT>(M_PI / 8.0));
+            return {ComplexT{c, 0}, ComplexT{s, 0}, ComplexT{-s, 0},
+                    ComplexT{c, 0}};
+        }
+        PL_ABORT_IF_NOT(name == "PauliZ",
+                        "Unsupported basis. Supported bases are PauliX, "
+                        "PauliY, PauliZ and Hadamard.");
+        return {ComplexT{1, 0}, ComplexT{0, 0}, ComplexT{0, 0},
+                ComplexT{1, 0}};
+    }
+
     /**
      * @brief Support function that calculates <bra|obs|ket> to obtain the
      * observable's expectation value.
@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <cstdio>
+#include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -20,6 +23,8 @@
 #include <catch2/catch.hpp>
 
 #include "MeasurementsLQubit.hpp"
+#include "ObservablesLQubit.hpp"
+#include "StateVectorLQubitFixed.hpp"
 #include "StateVectorLQubitManaged.hpp"
 #include "StateVectorLQubitRaw.hpp"
 #include "Util.hpp"
@@ -34,6 +39,7 @@ using namespace Pennylane::Util;
 
 using namespace Pennylane::LightningQubit;
 using namespace Pennylane::LightningQubit::Measures;
+using namespace Pennylane::LightningQubit::Observables;
 
 }; // namespace
 /// @endcond
@@ -319,3 +325,195 @@ TEMPLATE_PRODUCT_TEST_CASE("Sample with Metropolis (NonZeroRandom Kernel)",
                      Catch::Approx(expected_probabilities).margin(.05));
     }
 }
+
+TEMPLATE_PRODUCT_TEST_CASE("Probabilities in a rotated basis", "[Measurements]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+
+    auto statevector_data = createNonTrivialState<StateVectorT>();
+    StateVectorT statevector(statevector_data.data(), statevector_data.size());
+    Measurements<StateVectorT> Measurer(statevector);
+
+    const std::vector<std::pair<std::vector<size_t>, std::vector<std::string>>>
+        cases{{{0}, {"PauliX"}},
+              {{1}, {"PauliY"}},
+              {{2}, {"Hadamard"}},
+              {{2, 0}, {"PauliY", "PauliZ"}},
+              {{0, 2, 1}, {"PauliX", "Hadamard", "PauliY"}}};
+
+    for (const auto &[wires, bases] : cases) {
+        DYNAMIC_SECTION("Matches rotated statevector - wires = "
+                        << wires.size()) {
+            auto rotated_data = statevector_data;
+            StateVectorT rotated(rotated_data.data(), rotated_data.size());
+            for (size_t i = 0; i < wires.size(); i++) {
+                std::vector<size_t> identity_wires;
+                std::vector<size_t> ob_wires;
+                NamedObs<StateVectorT>(bases[i], {wires[i]})
+                    .applyInPlaceShots(rotated, identity_wires, ob_wires);
+            }
+            Measurements<StateVectorT> rotated_measurer(rotated);
+            const auto expected = rotated_measurer.probs(wires);
+            const auto probabilities = Measurer.probsInBasis(wires, bases);
+            REQUIRE_THAT(probabilities,
+                         Catch::Approx(expected).margin(1e-6));
+        }
+    }
+
+    SECTION("Sampled expectation values") {
+        const size_t num_shots = 20000;
+        auto obs = TensorProdObs<StateVectorT>::create(
+            {std::make_shared<NamedObs<StateVectorT>>(
+                 "PauliY", std::vector<size_t>{0}),
+             std::make_shared<NamedObs<StateVectorT>>(
+                 "Identity", std::vector<size_t>{1}),
+             std::make_shared<NamedObs<StateVectorT>>(
+                 "PauliX", std::vector<size_t>{2})});
+        const PrecisionT expected = Measurer.expval(*obs);
+        const PrecisionT result = Measurer.expval(*obs, num_shots, {});
+        REQUIRE(result == Approx(expected).margin(5e-2));
+
+        const auto samples =
+            Measurer.measure_with_samples(*obs, num_shots, {0, 2, 4});
+        REQUIRE(samples.size() == 3);
+    }
+
+    SECTION("Throws for invalid arguments") {
+        PL_REQUIRE_THROWS_MATCHES(Measurer.probsInBasis({0, 1}, {"PauliX"}),
+                                  LightningException,
+                                  "The number of wires and bases must be "
+                                  "equal.");
+        PL_REQUIRE_THROWS_MATCHES(Measurer.probsInBasis({0}, {"Hermitian"}),
+                                  LightningException, "Unsupported basis.");
+        PL_REQUIRE_THROWS_MATCHES(
+            Measurer.probsInBasis({1, 1}, {"PauliX", "PauliY"}),
+            LightningException, "Wires must be unique.");
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("Measurements into caller-provided buffers",
+                           "[Measurements]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+
+    auto statevector_data = createNonTrivialState<StateVectorT>();
+    StateVectorT statevector(statevector_data.data(), statevector_data.size());
+    Measurements<StateVectorT> Measurer(statevector);
+
+    SECTION("Probabilities") {
+        // Expected results calculated with Pennylane default.qubit, as in
+        // Test_MeasurementsBase.cpp
+        const std::vector<
+            std::pair<std::vector<size_t>, std::vector<PrecisionT>>>
+            cases{{{0}, {0.79249178, 0.20750821}},
+                  {{2, 0}, {0.75788676, 0.19844714, 0.03460502, 0.00906107}},
+                  {{1, 2}, {0.84642778, 0.03864779, 0.10990612, 0.0050183}},
+                  {{2, 0, 1},
+                   {0.67078706, 0.17564072, 0.03062806, 0.00801973,
+                    0.0870997, 0.02280642, 0.00397696, 0.00104134}}};
+        for (const auto &[wires, expected] : cases) {
+            INFO("wires = " << wires.size());
+            std::vector<PrecisionT> probabilities(size_t{1} << wires.size());
+            Measurer.probs(wires, std::span{probabilities});
+            CHECK_THAT(probabilities,
+                       Catch::Approx(expected).margin(1e-6));
+        }
+
+        std::vector<PrecisionT> probabilities(2);
+        PL_REQUIRE_THROWS_MATCHES(
+            Measurer.probs({0, 1}, std::span{probabilities}),
+            LightningException, "The output array has the wrong size.");
+    }
+
+    SECTION("Samples") {
+        const size_t num_samples = 100;
+        std::vector<size_t> samples(num_samples * 3);
+        Measurer.generate_samples(num_samples, std::span{samples});
+        REQUIRE(std::all_of(samples.begin(), samples.end(),
+                            [](size_t bit) { return bit <= 1; }));
+
+        samples.resize(num_samples * 2);
+        PL_REQUIRE_THROWS_MATCHES(
+            Measurer.generate_samples(num_samples, std::span{samples}),
+            LightningException,
+            "The number of wires does not match the state vector.");
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("Basis-state projectors", "[Measurements]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    auto statevector_data = createNonTrivialState<StateVectorT>();
+    StateVectorT statevector(statevector_data.data(), statevector_data.size());
+    Measurements<StateVectorT> Measurer(statevector);
+
+    const std::vector<std::pair<std::vector<size_t>, std::vector<size_t>>>
+        cases{{{1}, {0}},
+              {{0}, {2}},
+              {{1, 0}, {2, 0}},
+              {{0, 1, 1}, {0, 1, 2}}};
+
+    for (const auto &[state, wires] : cases) {
+        DYNAMIC_SECTION("Matches probabilities - wires = " << wires.size()) {
+            const auto probabilities = Measurer.probs(wires);
+            size_t index = 0;
+            for (size_t bit : state) {
+                index = (index << 1U) | bit;
+            }
+            const PrecisionT expected = probabilities[index];
+
+            ProjectorObs<StateVectorT> obs(state, wires);
+            CHECK(Measurer.expval(obs) == Approx(expected).margin(1e-6));
+            CHECK(Measurer.var(obs) ==
+                  Approx(expected - expected * expected).margin(1e-6));
+        }
+
+        DYNAMIC_SECTION("Matches HermitianObs - wires = " << wires.size()) {
+            const size_t dim = size_t{1} << wires.size();
+            size_t index = 0;
+            for (size_t bit : state) {
+                index = (index << 1U) | bit;
+            }
+            std::vector<ComplexT> matrix(dim * dim, ComplexT{0.0, 0.0});
+            matrix[index * dim + index] = ComplexT{1.0, 0.0};
+
+            ProjectorObs<StateVectorT> obs(state, wires);
+            HermitianObs<StateVectorT> hermitian(matrix, wires);
+            CHECK(Measurer.expval(obs) ==
+                  Approx(Measurer.expval(hermitian)).margin(1e-6));
+            CHECK(Measurer.var(obs) ==
+                  Approx(Measurer.var(hermitian)).margin(1e-6));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Measurements of fixed-size statevectors", "[Measurements]",
+                   float, double) {
+    using PrecisionT = TestType;
+    using StateVectorT = StateVectorLQubitFixed<PrecisionT, 2>;
+
+    StateVectorT sv;
+    sv.applyOperation("Hadamard", {0});
+    sv.applyOperation("CNOT", {0, 1});
+    Measurements<StateVectorT> Measurer(sv);
+
+    CHECK(Measurer.probs() ==
+          approx(std::vector<PrecisionT>{0.5, 0.0, 0.0, 0.5}).margin(1e-6));
+    CHECK(Measurer.expval("PauliZ", {0}) == Approx(0.0).margin(1e-6));
+
+    auto zz = TensorProdObs<StateVectorT>::create(
+        {std::make_shared<NamedObs<StateVectorT>>("PauliZ",
+                                                  std::vector<size_t>{0}),
+         std::make_shared<NamedObs<StateVectorT>>("PauliZ",
+                                                  std::vector<size_t>{1})});
+    CHECK(Measurer.expval(*zz) == Approx(1.0));
+    CHECK(Measurer.var(*zz) == Approx(0.0).margin(1e-6));
+}
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
 #include <cstdio>
 #include <vector>
 
@@ -76,6 +77,27 @@ TEMPLATE_PRODUCT_TEST_CASE("Expected Values - Sparse Hamiltonian",
         REQUIRE(var_values == Approx(var_values_ref).margin(1e-6));
     }
 
+    SECTION("Testing Sparse Hamiltonian with 32-bit column indices:") {
+        size_t num_qubits = 3;
+        size_t data_size = Pennylane::Util::exp2(num_qubits);
+
+        std::vector<size_t> row_map;
+        std::vector<size_t> entries;
+        std::vector<ComplexT> values;
+        write_CSR_vectors(row_map, entries, values, data_size);
+        const std::vector<int32_t> entries32(entries.begin(), entries.end());
+
+        PrecisionT exp_values =
+            Measurer.expval(row_map.data(), row_map.size(), entries32.data(),
+                            values.data(), values.size());
+        REQUIRE(exp_values == Approx(0.5930885).margin(1e-6));
+
+        PrecisionT var_values =
+            Measurer.var(row_map.data(), row_map.size(), entries32.data(),
+                         values.data(), values.size());
+        REQUIRE(var_values == Approx(2.4624654).margin(1e-6));
+    }
+
     SECTION("Testing Sparse Hamiltonian (incompatible sizes):") {
         size_t num_qubits = 4;
         size_t data_size = Pennylane::Util::exp2(num_qubits);
@@ -13,18 +13,24 @@
 // limitations under the License.
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <complex>
 #include <exception>
+#include <iterator>
 #include <memory>
+#include <sstream>
+#include <tuple>
 #include <type_traits>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "CPUMemoryModel.hpp" // getAllocator
 #include "Constant.hpp"
 #include "ConstantUtil.hpp" // lookup
 #include "Error.hpp"
-#include "LinearAlgebra.hpp" // scaleAndAdd
+#include "LinearAlgebra.hpp" // multiScaleAndAdd
 #include "Macros.hpp"        // use_openmp
 #include "Observables.hpp"
 #include "SparseLinAlg.hpp"
@@ -32,6 +38,10 @@
 #include "StateVectorLQubitRaw.hpp"
 #include "Util.hpp"
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 // using namespace Pennylane;
 /// @cond DEV
 namespace {
@@ -102,6 +112,52 @@ class HermitianObs final : public HermitianObsBase<StateVectorT> {
         : BaseType{matrix, wires} {}
 };
 
+/**
+ * @brief Final class for projectors onto a computational basis state
+ *
+ * @tparam StateVectorT State vector class.
+ */
+template <class StateVectorT>
+class ProjectorObs final : public ProjectorObsBase<StateVectorT> {
+  private:
+    using BaseType = ProjectorObsBase<StateVectorT>;
+
+  public:
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+
+    /**
+     * @brief Create a projector onto a computational basis state.
+     *
+     * @param state Bit taken by each wire in the basis state.
+     * @param wires Wires the observable applies to.
+     */
+    ProjectorObs(std::vector<size_t> state, std::vector<size_t> wires)
+        : BaseType{std::move(state), std::move(wires)} {}
+
+    /**
+     * @brief Zero the amplitudes of the basis states whose bits on the
+     * projector wires differ from the projected state, in place.
+     *
+     * @param sv State vector to update.
+     */
+    void applyInPlace(StateVectorT &sv) const override {
+        const auto mask_and_value = this->getBitMaskAndValue(sv.getNumQubits());
+        const size_t mask = mask_and_value.first;
+        const size_t value = mask_and_value.second;
+        ComplexT *data = sv.getData();
+        const size_t length = sv.getLength();
+#if defined(_OPENMP)
+#pragma omp parallel for default(none) firstprivate(data, length, mask, value)
+#endif
+        for (size_t idx = 0; idx < length; idx++) {
+            if ((idx & mask) != value) {
+                data[idx] = ComplexT{0.0, 0.0};
+            }
+        }
+    }
+};
+
 /**
  * @brief Final class for TensorProdObs observables
  *
@@ -150,7 +206,73 @@ class TensorProdObs final : public TensorProdObsBase<StateVectorT> {
 
 /// @cond DEV
 namespace detail {
-using Pennylane::LightningQubit::Util::scaleAndAdd;
+using Pennylane::LightningQubit::Util::multiScaleAndAdd;
+
+/// Number of Hamiltonian terms accumulated into the result in one pass.
+constexpr size_t hamiltonian_term_group_size = 4;
+
+/// Memory budget of the scratch states of a group of terms, in bytes.
+constexpr size_t hamiltonian_group_memory_budget = size_t{1} << 30U;
+
+/**
+ * @brief Number of Hamiltonian terms accumulated in one pass.
+ *
+ * Each term of a group needs its own scratch copy of the state vector, so
+ * large state vectors use smaller groups, down to a single scratch state.
+ *
+ * @param num_terms Number of terms of the Hamiltonian.
+ * @param state_bytes Memory of one state vector, in bytes.
+ */
+inline auto termGroupSize(size_t num_terms, size_t state_bytes) -> size_t {
+    const size_t affordable =
+        std::max<size_t>(hamiltonian_group_memory_budget / state_bytes, 1);
+    return std::min({hamiltonian_term_group_size, num_terms, affordable});
+}
+
+/**
+ * @brief Add the coefficient-weighted terms of a Hamiltonian applied to sv to
+ * res, one group of terms at a time.
+ *
+ * Each state vector in `tmps` receives one term of a group, and the whole
+ * group is accumulated with a single multiScaleAndAdd pass over res.
+ *
+ * @param coeffs Coefficients of the terms.
+ * @param terms Terms of the Hamiltonian.
+ * @param term_begin Index of the first term to accumulate.
+ * @param term_end Index past the last term to accumulate.
+ * @param sv State vector the terms are applied to.
+ * @param tmps Scratch state vectors holding a copy of sv, one per term of a
+ * group.
+ * @param res Result vector.
+ */
+template <class StateVectorT>
+void accumulateTermGroups(
+    const std::vector<typename StateVectorT::PrecisionT> &coeffs,
+    const std::vector<std::shared_ptr<Observable<StateVectorT>>> &terms,
+    size_t term_begin, size_t term_end, const StateVectorT &sv,
+    std::vector<StateVectorT> &tmps, typename StateVectorT::ComplexT *res) {
+    using ComplexT = typename StateVectorT::ComplexT;
+    const size_t length = sv.getLength();
+    std::array<ComplexT, hamiltonian_term_group_size> group_coeffs{};
+    std::array<const ComplexT *, hamiltonian_term_group_size> group_data{};
+
+    for (size_t group_begin = term_begin; group_begin < term_end;
+         group_begin += tmps.size()) {
+        const size_t num_terms = std::min(tmps.size(), term_end - group_begin);
+        for (size_t idx = 0; idx < num_terms; idx++) {
+            // The scratch states start as copies of sv
+            if (group_begin != term_begin) {
+                std::copy(sv.getData(), sv.getData() + length,
+                          tmps[idx].getData());
+            }
+            terms[group_begin + idx]->applyInPlace(tmps[idx]);
+            group_coeffs[idx] = ComplexT{coeffs[group_begin + idx], 0.0};
+            group_data[idx] = tmps[idx].getData();
+        }
+        multiScaleAndAdd(length, num_terms, group_coeffs.data(),
+                         group_data.data(), res);
+    }
+}
 
 // Default implementation
 template <class StateVectorT, bool use_openmp> struct HamiltonianApplyInPlace {
@@ -160,31 +282,31 @@ template <class StateVectorT, bool use_openmp> struct HamiltonianApplyInPlace {
     run(const std::vector<PrecisionT> &coeffs,
         const std::vector<std::shared_ptr<Observable<StateVectorT>>> &terms,
         StateVectorT &sv) {
+        const size_t group_size =
+            termGroupSize(terms.size(), sv.getLength() * sizeof(ComplexT));
         if constexpr (std::is_same_v<typename StateVectorT::MemoryStorageT,
                                      MemoryStorageLocation::Internal>) {
             auto allocator = sv.allocator();
             std::vector<ComplexT, decltype(allocator)> res(
                 sv.getLength(), ComplexT{0.0, 0.0}, allocator);
-            for (size_t term_idx = 0; term_idx < coeffs.size(); term_idx++) {
-                StateVectorT tmp(sv);
-                terms[term_idx]->applyInPlace(tmp);
-                scaleAndAdd(tmp.getLength(), ComplexT{coeffs[term_idx], 0.0},
-                            tmp.getData(), res.data());
-            }
+            std::vector<StateVectorT> tmps(group_size, sv);
+            accumulateTermGroups(coeffs, terms, 0, terms.size(), sv, tmps,
+                                 res.data());
             sv.updateData(res);
         } else if constexpr (std::is_same_v<
                                  typename StateVectorT::MemoryStorageT,
                                  MemoryStorageLocation::External>) {
             std::vector<ComplexT> res(sv.getLength(), ComplexT{0.0, 0.0});
-            for (size_t term_idx = 0; term_idx < coeffs.size(); term_idx++) {
-                std::vector<ComplexT> tmp_data_storage(
-                    sv.getData(), sv.getData() + sv.getLength());
-                StateVectorT tmp(tmp_data_storage.data(),
-                                 tmp_data_storage.size());
-                terms[term_idx]->applyInPlace(tmp);
-                scaleAndAdd(tmp.getLength(), ComplexT{coeffs[term_idx], 0.0},
-                            tmp.getData(), res.data());
+            std::vector<std::vector<ComplexT>> tmp_data_storage(
+                group_size, std::vector<ComplexT>(
+                                sv.getData(), sv.getData() + sv.getLength()));
+            std::vector<StateVectorT> tmps;
+            tmps.reserve(group_size);
+            for (auto &storage : tmp_data_storage) {
+                tmps.emplace_back(storage.data(), storage.size());
             }
+            accumulateTermGroups(coeffs, terms, 0, terms.size(), sv, tmps,
+                                 res.data());
             sv.updateData(res);
         } else {
             /// LCOV_EXCL_START
@@ -195,6 +317,53 @@ template <class StateVectorT, bool use_openmp> struct HamiltonianApplyInPlace {
 };
 
 #if defined(_OPENMP)
+/**
+ * @brief Sum the per-thread partial results into res in a single
+ * multiScaleAndAdd pass.
+ *
+ * @param length Length of the result vector.
+ * @param local_svs Per-thread partial results of size `length`. Empty vectors
+ * are skipped.
+ * @param res Result vector.
+ */
+template <class ComplexT, class VectorT>
+void reduceLocalResults(size_t length, const std::vector<VectorT> &local_svs,
+                        ComplexT *res) {
+    std::vector<const ComplexT *> data;
+    for (const auto &local_sv : local_svs) {
+        if (!local_sv.empty()) {
+            PL_ASSERT(local_sv.size() == length);
+            data.push_back(local_sv.data());
+        }
+    }
+    const std::vector<ComplexT> ones(data.size(), ComplexT{1.0, 0.0});
+    if (!data.empty()) {
+        multiScaleAndAdd(length, data.size(), ones.data(), data.data(), res);
+    }
+}
+
+/**
+ * @brief Range of the Hamiltonian terms accumulated by the calling thread of
+ * a parallel region, and the number of terms it groups in one pass.
+ *
+ * The terms are split into contiguous slices, one per thread, and the memory
+ * budget of the scratch states is shared by all threads.
+ *
+ * @param num_terms Number of terms of the Hamiltonian.
+ * @param state_bytes Memory of one state vector, in bytes.
+ * @return Tuple of the first term, the term past the last one, and the
+ * group size.
+ */
+inline auto threadTermSlice(size_t num_terms, size_t state_bytes)
+    -> std::tuple<size_t, size_t, size_t> {
+    const auto num_threads = static_cast<size_t>(omp_get_num_threads());
+    const auto thread_idx = static_cast<size_t>(omp_get_thread_num());
+    const size_t term_begin = num_terms * thread_idx / num_threads;
+    const size_t term_end = num_terms * (thread_idx + 1) / num_threads;
+    return {term_begin, term_end,
+            termGroupSize(term_end - term_begin, state_bytes * num_threads)};
+}
+
 template <class PrecisionT>
 struct HamiltonianApplyInPlace<StateVectorLQubitManaged<PrecisionT>, true> {
     using ComplexT = std::complex<PrecisionT>;
@@ -210,38 +379,35 @@ struct HamiltonianApplyInPlace<StateVectorLQubitManaged<PrecisionT>, true> {
 
         std::vector<ComplexT, decltype(allocator)> sum(length, ComplexT{},
                                                        allocator);
+        std::vector<std::vector<ComplexT, decltype(allocator)>> local_svs(
+            static_cast<size_t>(omp_get_max_threads()),
+            std::vector<ComplexT, decltype(allocator)>(allocator));
 
-#pragma omp parallel default(none) firstprivate(length, allocator)             \
-    shared(coeffs, terms, sv, sum, ex)
+#pragma omp parallel default(none) firstprivate(length)                        \
+    shared(coeffs, terms, sv, local_svs, ex)
         {
-            StateVectorLQubitManaged<PrecisionT> tmp(sv.getNumQubits());
-
-            std::vector<ComplexT, decltype(allocator)> local_sv(
-                length, ComplexT{}, allocator);
-
-#pragma omp for
-            for (size_t term_idx = 0; term_idx < terms.size(); term_idx++) {
+            const auto [term_begin, term_end, group_size] =
+                threadTermSlice(terms.size(), length * sizeof(ComplexT));
+            if (term_begin < term_end) {
                 try {
-                    tmp.updateData(sv.getDataVector());
-                    terms[term_idx]->applyInPlace(tmp);
+                    std::vector<StateVectorLQubitManaged<PrecisionT>> tmps(
+                        group_size, sv);
+                    auto &local_sv =
+                        local_svs[static_cast<size_t>(omp_get_thread_num())];
+                    local_sv.assign(length, ComplexT{});
+                    accumulateTermGroups(coeffs, terms, term_begin, term_end,
+                                         sv, tmps, local_sv.data());
                 } catch (...) {
 #pragma omp critical
                     ex = std::current_exception();
-#pragma omp cancel for
                 }
-                scaleAndAdd(length, ComplexT{coeffs[term_idx], 0.0},
-                            tmp.getData(), local_sv.data());
-            }
-            if (ex) {
-#pragma omp cancel parallel
-                std::rethrow_exception(ex);
-            } else {
-#pragma omp critical
-                scaleAndAdd(length, ComplexT{1.0, 0.0}, local_sv.data(),
-                            sum.data());
             }
         }
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
 
+        reduceLocalResults(length, local_svs, sum.data());
         sv.updateData(sum);
     }
 };
@@ -256,53 +422,41 @@ struct HamiltonianApplyInPlace<StateVectorLQubitRaw<PrecisionT>, true> {
         std::exception_ptr ex = nullptr;
         const size_t length = sv.getLength();
         std::vector<ComplexT> sum(length, ComplexT{});
+        std::vector<std::vector<ComplexT>> local_svs(
+            static_cast<size_t>(omp_get_max_threads()));
 
 #pragma omp parallel default(none) firstprivate(length)                        \
-    shared(coeffs, terms, sv, sum, ex)
+    shared(coeffs, terms, sv, local_svs, ex)
         {
-            std::unique_ptr<std::vector<ComplexT>> tmp_data_storage{nullptr};
-            std::unique_ptr<StateVectorLQubitRaw<PrecisionT>> tmp{nullptr};
-            std::unique_ptr<std::vector<ComplexT>> local_sv{nullptr};
-
-            try {
-                tmp_data_storage.reset(new std::vector<ComplexT>(
-                    sv.getData(), sv.getData() + sv.getLength()));
-                tmp.reset(new StateVectorLQubitRaw<PrecisionT>(
-                    tmp_data_storage->data(), tmp_data_storage->size()));
-                local_sv.reset(new std::vector<ComplexT>(length, ComplexT{}));
-            } catch (...) {
-#pragma omp critical
-                ex = std::current_exception();
-            }
-            if (ex) {
-#pragma omp cancel parallel
-                std::rethrow_exception(ex);
-            }
-
-#pragma omp for
-            for (size_t term_idx = 0; term_idx < terms.size(); term_idx++) {
-                std::copy(sv.getData(), sv.getData() + sv.getLength(),
-                          tmp_data_storage->data());
+            const auto [term_begin, term_end, group_size] =
+                threadTermSlice(terms.size(), length * sizeof(ComplexT));
+            if (term_begin < term_end) {
                 try {
-                    terms[term_idx]->applyInPlace(*tmp);
+                    std::vector<std::vector<ComplexT>> tmp_data_storage(
+                        group_size,
+                        std::vector<ComplexT>(sv.getData(),
+                                              sv.getData() + length));
+                    std::vector<StateVectorLQubitRaw<PrecisionT>> tmps;
+                    tmps.reserve(group_size);
+                    for (auto &storage : tmp_data_storage) {
+                        tmps.emplace_back(storage.data(), storage.size());
+                    }
+                    auto &local_sv =
+                        local_svs[static_cast<size_t>(omp_get_thread_num())];
+                    local_sv.assign(length, ComplexT{});
+                    accumulateTermGroups(coeffs, terms, term_begin, term_end,
+                                         sv, tmps, local_sv.data());
                 } catch (...) {
 #pragma omp critical
                     ex = std::current_exception();
-#pragma omp cancel for
                 }
-                scaleAndAdd(length, ComplexT{coeffs[term_idx], 0.0},
-                            tmp->getData(), local_sv->data());
-            }
-            if (ex) {
-#pragma omp cancel parallel
-                std::rethrow_exception(ex);
-            } else {
-#pragma omp critical
-                scaleAndAdd(length, ComplexT{1.0, 0.0}, local_sv->data(),
-                            sum.data());
             }
         }
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
 
+        reduceLocalResults(length, local_svs, sum.data());
         sv.updateData(sum);
     }
 };
@@ -373,6 +527,9 @@ class Hamiltonian final : public HamiltonianBase<StateVectorT> {
 /**
  * @brief Sparse representation of Hamiltonian<StateVectorT>
  *
+ * The CSR data is kept in a compact form: 32-bit column indices when the
+ * dimension allows, real values when all coefficients are real, and
+ * optionally only the upper triangle of the Hermitian matrix.
  */
 template <class StateVectorT>
 class SparseHamiltonian final : public SparseHamiltonianBase<StateVectorT> {
@@ -384,6 +541,18 @@ class SparseHamiltonian final : public SparseHamiltonianBase<StateVectorT> {
     using ComplexT = typename StateVectorT::ComplexT;
     using IdxT = typename BaseType::IdxT;
 
+  private:
+    Util::CompactCSRMatrix<PrecisionT> matrix_;
+
+    [[nodiscard]] bool
+    isEqual(const Observable<StateVectorT> &other) const override {
+        const auto &other_cast =
+            static_cast<const SparseHamiltonian<StateVectorT> &>(other);
+        return matrix_ == other_cast.matrix_ &&
+               this->wires_ == other_cast.wires_;
+    }
+
+  public:
     /**
      * @brief Create a SparseHamiltonian from data, indices and offsets in CSR
      * format.
@@ -392,11 +561,20 @@ class SparseHamiltonian final : public SparseHamiltonianBase<StateVectorT> {
      * @param indices Arguments to construct indices
      * @param offsets Arguments to construct offsets
      * @param wires Arguments to construct wires
+     * @param upper_triangle Only store the entries on or above the diagonal.
+     * Entries below the diagonal in the arguments are ignored.
      */
     template <typename T1, typename T2, typename T3 = T2, typename T4>
     explicit SparseHamiltonian(T1 &&data, T2 &&indices, T3 &&offsets,
-                               T4 &&wires)
-        : BaseType{data, indices, offsets, wires} {}
+                               T4 &&wires, bool upper_triangle = false)
+        : BaseType{std::vector<ComplexT>{}, std::vector<IdxT>{},
+                   std::vector<IdxT>{}, std::forward<T4>(wires)},
+          matrix_{std::data(data),    std::data(indices),
+                  std::size(data),    std::data(offsets),
+                  std::size(offsets), upper_triangle} {
+        PL_ABORT_IF_NOT(std::size(data) == std::size(indices),
+                        "The number of data and indices must be equal.");
+    }
 
     /**
      * @brief Convenient wrapper for the constructor as the constructor does not
@@ -409,20 +587,30 @@ class SparseHamiltonian final : public SparseHamiltonianBase<StateVectorT> {
      * @param indices Argument to construct indices
      * @param offsets Argument to construct ofsets
      * @param wires Argument to construct wires
+     * @param upper_triangle Only store the entries on or above the diagonal.
      */
     static auto create(std::initializer_list<ComplexT> data,
                        std::initializer_list<IdxT> indices,
                        std::initializer_list<IdxT> offsets,
-                       std::initializer_list<std::size_t> wires)
+                       std::initializer_list<std::size_t> wires,
+                       bool upper_triangle = false)
         -> std::shared_ptr<SparseHamiltonian<StateVectorT>> {
         // NOLINTBEGIN(*-move-const-arg)
         return std::shared_ptr<SparseHamiltonian<StateVectorT>>(
             new SparseHamiltonian<StateVectorT>{
                 std::move(data), std::move(indices), std::move(offsets),
-                std::move(wires)});
+                std::move(wires), upper_triangle});
         // NOLINTEND(*-move-const-arg)
     }
 
+    /**
+     * @brief Get the compact CSR matrix of the observable.
+     */
+    [[nodiscard]] auto getMatrix() const
+        -> const Util::CompactCSRMatrix<PrecisionT> & {
+        return matrix_;
+    }
+
     /**
      * @brief Updates the statevector SV:->SV', where SV' = a*H*SV, and where H
      * is a sparse Hamiltonian.
@@ -431,13 +619,32 @@ class SparseHamiltonian final : public SparseHamiltonianBase<StateVectorT> {
     void applyInPlace(StateVectorT &sv) const override {
         PL_ABORT_IF_NOT(this->wires_.size() == sv.getNumQubits(),
                         "SparseH wire count does not match state-vector size");
-        auto operator_vector = Util::apply_Sparse_Matrix(
-            sv.getData(), sv.getLength(), this->offsets_.data(),
-            this->offsets_.size(), this->indices_.data(), this->data_.data(),
-            this->data_.size());
+        PL_ABORT_IF_NOT(matrix_.numRows() == sv.getLength(),
+                        "SparseH dimension does not match state-vector size");
+        std::vector<ComplexT> operator_vector(sv.getLength());
+        matrix_.apply(sv.getData(), operator_vector.data());
 
         sv.updateData(operator_vector);
     }
+
+    [[nodiscard]] auto getObsName() const -> std::string override {
+        std::ostringstream ss;
+        ss << "SparseHamiltonian: {\n'data' : \n";
+        for (size_t k = 0; k < matrix_.numNonZeros(); k++) {
+            const ComplexT value = matrix_.getValue(k);
+            ss << "{" << value.real() << ", " << value.imag() << "}, ";
+        }
+        ss << ",\n'indices' : \n";
+        for (size_t k = 0; k < matrix_.numNonZeros(); k++) {
+            ss << matrix_.getColumn(k) << ", ";
+        }
+        ss << ",\n'offsets' : \n";
+        for (const auto &o : matrix_.getRowMap()) {
+            ss << o << ", ";
+        }
+        ss << "\n}";
+        return ss.str();
+    }
 };
 
 } // namespace Pennylane::LightningQubit::Observables
\ No newline at end of file
@@ -17,6 +17,10 @@
 
 #include <catch2/catch.hpp>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 // using namespace Pennylane;
 /// @cond DEV
 namespace {
@@ -95,6 +99,69 @@ TEMPLATE_PRODUCT_TEST_CASE("HermitianObs", "[Observables]",
     }
 }
 
+TEMPLATE_PRODUCT_TEST_CASE("ProjectorObs", "[Observables]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using ProjectorObsT = ProjectorObs<StateVectorT>;
+
+    SECTION("Constructibility") {
+        REQUIRE(std::is_constructible_v<ProjectorObsT, std::vector<size_t>,
+                                        std::vector<size_t>>);
+    }
+
+    SECTION("Copy constructibility") {
+        REQUIRE(std::is_copy_constructible_v<ProjectorObsT>);
+    }
+
+    SECTION("Constructor checks") {
+        PL_REQUIRE_THROWS_MATCHES(ProjectorObsT({0, 1}, {0}),
+                                  LightningException,
+                                  "The basis state must have one bit per "
+                                  "wire.");
+        PL_REQUIRE_THROWS_MATCHES(ProjectorObsT({0, 2}, {0, 1}),
+                                  LightningException,
+                                  "The basis state must only contain 0 and "
+                                  "1.");
+        PL_REQUIRE_THROWS_MATCHES(ProjectorObsT({1, 0}, {1, 1}),
+                                  LightningException,
+                                  "The projector wires must be distinct.");
+    }
+
+    SECTION("getObsName") {
+        REQUIRE(ProjectorObsT({1, 0}, {2, 0}).getObsName() ==
+                "Projector[1, 0][2, 0]");
+    }
+
+    SECTION("ApplyInPlace zeroes non-matching amplitudes") {
+        using PrecisionT = typename StateVectorT::PrecisionT;
+        const size_t num_qubits = 3;
+        std::mt19937 re{1337};
+        const auto st_data =
+            createRandomStateVectorData<PrecisionT>(re, num_qubits);
+        auto sv_data = st_data;
+        StateVectorT state_vector(sv_data.data(), sv_data.size());
+
+        ProjectorObsT({1, 0}, {2, 0}).applyInPlace(state_vector);
+
+        std::vector<ComplexT> expected(st_data.size(), ComplexT{0.0, 0.0});
+        // Wire 0 is the most significant bit: wire 0 = 0, wire 2 = 1.
+        for (size_t idx : {size_t{1}, size_t{3}}) {
+            expected[idx] = st_data[idx];
+        }
+        std::vector<ComplexT> result(state_vector.getData(),
+                                     state_vector.getData() +
+                                         state_vector.getLength());
+        REQUIRE(result == approx(expected));
+
+        PL_REQUIRE_THROWS_MATCHES(
+            ProjectorObsT({1}, {3}).applyInPlace(state_vector),
+            LightningException,
+            "The projector wires must be smaller than the number of qubits.");
+    }
+}
+
 TEMPLATE_PRODUCT_TEST_CASE("TensorProdObs", "[Observables]",
                            (StateVectorLQubitManaged, StateVectorLQubitRaw),
                            (float, double)) {
@@ -174,6 +241,74 @@ TEMPLATE_PRODUCT_TEST_CASE("SparseHamiltonian", "[Observables]",
     }
 }
 
+TEMPLATE_PRODUCT_TEST_CASE("SparseHamiltonian::ApplyInPlace", "[Observables]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using SparseHamiltonianT = SparseHamiltonian<StateVectorT>;
+
+    // 0.5 X0 + Y1 + Z0 Z1
+    auto full = SparseHamiltonianT::create(
+        {ComplexT{1.0, 0.0}, ComplexT{0.0, -1.0}, ComplexT{0.5, 0.0},
+         ComplexT{0.0, 1.0}, ComplexT{-1.0, 0.0}, ComplexT{0.5, 0.0},
+         ComplexT{0.5, 0.0}, ComplexT{-1.0, 0.0}, ComplexT{0.0, -1.0},
+         ComplexT{0.5, 0.0}, ComplexT{0.0, 1.0}, ComplexT{1.0, 0.0}},
+        {0, 1, 2, 0, 1, 3, 0, 2, 3, 1, 2, 3}, {0, 3, 6, 9, 12}, {0, 1});
+    auto upper = SparseHamiltonianT::create(
+        {ComplexT{1.0, 0.0}, ComplexT{0.0, -1.0}, ComplexT{0.5, 0.0},
+         ComplexT{0.0, 1.0}, ComplexT{-1.0, 0.0}, ComplexT{0.5, 0.0},
+         ComplexT{0.5, 0.0}, ComplexT{-1.0, 0.0}, ComplexT{0.0, -1.0},
+         ComplexT{0.5, 0.0}, ComplexT{0.0, 1.0}, ComplexT{1.0, 0.0}},
+        {0, 1, 2, 0, 1, 3, 0, 2, 3, 1, 2, 3}, {0, 3, 6, 9, 12}, {0, 1},
+        true);
+
+    SECTION("Compact storage") {
+        REQUIRE(full->getMatrix().hasCompactIndices());
+        REQUIRE(!full->getMatrix().hasRealValues());
+        REQUIRE(full->getMatrix().numNonZeros() == 12);
+        REQUIRE(upper->getMatrix().numNonZeros() == 8);
+        REQUIRE(*full != *upper);
+        REQUIRE(*upper == *SparseHamiltonianT::create(
+                              {ComplexT{1.0, 0.0}, ComplexT{0.0, -1.0},
+                               ComplexT{0.5, 0.0}, ComplexT{-1.0, 0.0},
+                               ComplexT{0.5, 0.0}, ComplexT{-1.0, 0.0},
+                               ComplexT{0.0, -1.0}, ComplexT{1.0, 0.0}},
+                              {0, 1, 2, 1, 3, 2, 3, 3}, {0, 3, 5, 7, 8},
+                              {0, 1}, true));
+        REQUIRE(upper->getObsName() ==
+                "SparseHamiltonian: {\n'data' : \n{1, 0}, {0, -1}, {0.5, 0}, "
+                "{-1, 0}, {0.5, 0}, {-1, 0}, {0, -1}, {1, 0}, ,\n'indices' : "
+                "\n0, 1, 2, 1, 3, 2, 3, 3, ,\n'offsets' : \n0, 3, 5, 7, 8, "
+                "\n}");
+    }
+
+    SECTION("Upper triangle gives the same result") {
+        std::mt19937 re{1337};
+        // Raw state vectors wrap their data, so each gets its own copy.
+        auto st_data_1 = createRandomStateVectorData<PrecisionT>(re, 2);
+        auto st_data_2 = st_data_1;
+        StateVectorT state_vector_1(st_data_1.data(), st_data_1.size());
+        StateVectorT state_vector_2(st_data_2.data(), st_data_2.size());
+
+        full->applyInPlace(state_vector_1);
+        upper->applyInPlace(state_vector_2);
+
+        REQUIRE(isApproxEqual(state_vector_1.getData(),
+                              state_vector_1.getLength(),
+                              state_vector_2.getData(),
+                              state_vector_2.getLength()));
+    }
+
+    SECTION("Invalid state vector size") {
+        std::vector<ComplexT> st_data(8, ComplexT{0.0, 0.0});
+        StateVectorT state_vector(st_data.data(), st_data.size());
+        REQUIRE_THROWS_WITH(upper->applyInPlace(state_vector),
+                            Catch::Contains("SparseH wire count"));
+    }
+}
+
 TEMPLATE_PRODUCT_TEST_CASE("Hamiltonian::ApplyInPlace", "[Observables]",
                            (StateVectorLQubitManaged, StateVectorLQubitRaw),
                            (float, double)) {
@@ -232,4 +367,98 @@ TEMPLATE_PRODUCT_TEST_CASE("Hamiltonian::ApplyInPlace", "[Observables]",
                                   expected.size()));
         }
     }
-}
\ No newline at end of file
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("Hamiltonian::ApplyInPlace term groups",
+                           "[Observables]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using NamedObsT = NamedObs<StateVectorT>;
+    using HamiltonianT = Hamiltonian<StateVectorT>;
+
+    std::mt19937 re{1337};
+    const size_t num_qubits = 3;
+
+    // More terms than accumulated in one pass, with a partial last group
+    std::vector<PrecisionT> coeffs;
+    std::vector<std::shared_ptr<Observable<StateVectorT>>> terms;
+    for (const auto *name : {"PauliX", "PauliY", "PauliZ"}) {
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            coeffs.push_back(PrecisionT{0.1} * (coeffs.size() + 1));
+            terms.push_back(std::make_shared<NamedObsT>(
+                name, std::vector<size_t>{wire}));
+        }
+    }
+    auto ham = std::make_shared<HamiltonianT>(coeffs, terms);
+
+    auto st_data = createRandomStateVectorData<PrecisionT>(re, num_qubits);
+
+    std::vector<ComplexT> expected(st_data.size(), ComplexT{0.0, 0.0});
+    for (size_t term_idx = 0; term_idx < terms.size(); term_idx++) {
+        auto term_data = st_data;
+        StateVectorT term_sv(term_data.data(), term_data.size());
+        terms[term_idx]->applyInPlace(term_sv);
+        for (size_t idx = 0; idx < expected.size(); idx++) {
+            expected[idx] += coeffs[term_idx] * term_sv.getData()[idx];
+        }
+    }
+
+    SECTION("Hamiltonian::applyInPlace") {
+        StateVectorT state_vector(st_data.data(), st_data.size());
+        ham->applyInPlace(state_vector);
+
+        REQUIRE(isApproxEqual(state_vector.getData(),
+                              state_vector.getLength(), expected.data(),
+                              expected.size()));
+    }
+
+    SECTION("Grouped default implementation") {
+        // OpenMP builds select the per-thread specialisations in
+        // applyInPlace, so the grouped path is run explicitly.
+        StateVectorT state_vector(st_data.data(), st_data.size());
+        detail::HamiltonianApplyInPlace<StateVectorT, false>::run(
+            coeffs, terms, state_vector);
+
+        REQUIRE(isApproxEqual(state_vector.getData(),
+                              state_vector.getLength(), expected.data(),
+                              expected.size()));
+    }
+
+#if defined(_OPENMP)
+    SECTION("Grouped per-thread implementation") {
+        // With one and two threads, the slices hold several groups of terms,
+        // and with more threads than terms some threads have no terms.
+        const int prev_threads = omp_get_max_threads();
+        for (const int num_threads : {1, 2, 4, 16}) {
+            omp_set_num_threads(num_threads);
+            // Raw state vectors write into their data
+            auto data = st_data;
+            StateVectorT state_vector(data.data(), data.size());
+            detail::HamiltonianApplyInPlace<StateVectorT, true>::run(
+                coeffs, terms, state_vector);
+
+            CHECK(isApproxEqual(state_vector.getData(),
+                                state_vector.getLength(), expected.data(),
+                                expected.size()));
+        }
+        omp_set_num_threads(prev_threads);
+    }
+#endif
+}
+
+TEST_CASE("Hamiltonian term group size", "[Observables]") {
+    using detail::hamiltonian_group_memory_budget;
+    using detail::hamiltonian_term_group_size;
+    using detail::termGroupSize;
+
+    CHECK(termGroupSize(9, 128) == hamiltonian_term_group_size);
+    CHECK(termGroupSize(2, 128) == 2);
+    CHECK(termGroupSize(0, 128) == 0);
+    // Large state vectors use fewer scratch states, but at least one
+    CHECK(termGroupSize(9, hamiltonian_group_memory_budget / 2) == 2);
+    CHECK(termGroupSize(9, hamiltonian_group_memory_budget) == 1);
+    CHECK(termGroupSize(9, 2 * hamiltonian_group_memory_budget) == 1);
+}
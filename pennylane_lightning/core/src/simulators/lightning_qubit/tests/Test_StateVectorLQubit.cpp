@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <complex>
 #include <limits> // numeric_limits
+#include <numeric>
 #include <random>
 #include <type_traits>
 #include <vector>
@@ -163,6 +164,389 @@ TEMPLATE_PRODUCT_TEST_CASE("StateVectorLQubit::applyMatrix with a pointer",
     }
 }
 
+TEMPLATE_PRODUCT_TEST_CASE("StateVectorLQubit::applyDiagonal",
+                           "[applyDiagonal]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using VectorT = TestVector<ComplexT>;
+
+    const size_t num_qubits = 4;
+
+    SECTION("Test wrong diagonal size") {
+        std::vector<ComplexT> diag(3, 1.0);
+        VectorT st_data =
+            createRandomStateVectorData<PrecisionT>(re, num_qubits);
+
+        StateVectorT state_vector(st_data.data(), st_data.size());
+        REQUIRE_THROWS_WITH(
+            state_vector.applyDiagonal(diag, {0, 1}),
+            Catch::Contains(
+                "The size of the diagonal does not match with the given"));
+        REQUIRE_THROWS_WITH(state_vector.applyDiagonal(diag.data(), {}),
+                            Catch::Contains("must be larger than 0"));
+    }
+
+    SECTION("Test against the dense matrix") {
+        const std::vector<size_t> wires{3, 0, 2};
+        const size_t dim = 8;
+        std::vector<ComplexT> diag(dim);
+        std::vector<ComplexT> matrix(dim * dim, 0.0);
+        for (size_t i = 0; i < dim; i++) {
+            diag[i] = std::polar(PrecisionT{1.0}, PrecisionT{0.3} * i);
+            matrix[i * dim + i] = diag[i];
+        }
+
+        for (const bool inverse : {false, true}) {
+            VectorT st_data_1 =
+                createRandomStateVectorData<PrecisionT>(re, num_qubits);
+            VectorT st_data_2 = st_data_1;
+
+            StateVectorT state_vector_1(st_data_1.data(), st_data_1.size());
+            StateVectorT state_vector_2(st_data_2.data(), st_data_2.size());
+
+            state_vector_1.applyDiagonal(diag, wires, inverse);
+            state_vector_2.applyMatrix(matrix, wires, inverse);
+
+            PrecisionT eps = std::numeric_limits<PrecisionT>::epsilon() * 10E3;
+            REQUIRE(isApproxEqual(
+                state_vector_1.getData(), state_vector_1.getLength(),
+                state_vector_2.getData(), state_vector_2.getLength(), eps));
+        }
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("StateVectorLQubit::applyReflection",
+                           "[applyReflection]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using VectorT = TestVector<ComplexT>;
+
+    const size_t num_qubits = 5;
+    const PrecisionT eps = std::numeric_limits<PrecisionT>::epsilon() * 10E3;
+
+    auto getData = [](const StateVectorT &sv) {
+        return std::vector<ComplexT>(sv.getData(),
+                                     sv.getData() + sv.getLength());
+    };
+
+    // Dense matrix of 2|s><s| - I
+    auto reflectionMatrix = [](const std::vector<ComplexT> &s) {
+        const size_t dim = s.size();
+        std::vector<ComplexT> matrix(dim * dim);
+        for (size_t i = 0; i < dim; i++) {
+            for (size_t j = 0; j < dim; j++) {
+                matrix[i * dim + j] = PrecisionT{2} * s[i] * std::conj(s[j]);
+            }
+            matrix[i * dim + i] -= 1;
+        }
+        return matrix;
+    };
+
+    SECTION("Test invalid arguments") {
+        VectorT st_data =
+            createRandomStateVectorData<PrecisionT>(re, num_qubits);
+        StateVectorT state_vector(st_data.data(), st_data.size());
+        const std::vector<ComplexT> state(3, 1.0);
+        REQUIRE_THROWS_WITH(
+            state_vector.applyReflection(state, {0, 1}),
+            Catch::Contains(
+                "The size of the state does not match with the given"));
+        REQUIRE_THROWS_WITH(state_vector.applyGroverOperator({}),
+                            Catch::Contains("must be larger than 0"));
+        REQUIRE_THROWS_WITH(state_vector.applyGroverOperator({1, 1}),
+                            Catch::Contains("Wires must be unique"));
+        REQUIRE_THROWS_WITH(state_vector.applyGroverOperator({0, 5}),
+                            Catch::Contains("Invalid wire index"));
+    }
+
+    for (const auto &wires : std::vector<std::vector<size_t>>{
+             {2}, {3, 0}, {4, 1, 2}, {0, 1, 2, 3, 4}, {3, 0, 4, 2, 1}}) {
+        DYNAMIC_SECTION("Test against the dense matrix - num_wires = "
+                        << wires.size() << ", wires[0] = " << wires[0]) {
+            const size_t dim = size_t{1} << wires.size();
+            const auto state_data = createRandomStateVectorData<PrecisionT>(
+                re, wires.size());
+            const std::vector<ComplexT> state(state_data.begin(),
+                                              state_data.end());
+            const std::vector<ComplexT> uniform(
+                dim, ComplexT{1 / std::sqrt(static_cast<PrecisionT>(dim)), 0});
+
+            const VectorT ini_st =
+                createRandomStateVectorData<PrecisionT>(re, num_qubits);
+            VectorT st_data_1 = ini_st;
+            VectorT st_data_2 = ini_st;
+            VectorT st_data_3 = ini_st;
+            VectorT st_data_4 = ini_st;
+
+            StateVectorT state_vector_1(st_data_1.data(), st_data_1.size());
+            StateVectorT state_vector_2(st_data_2.data(), st_data_2.size());
+            StateVectorT state_vector_3(st_data_3.data(), st_data_3.size());
+            StateVectorT state_vector_4(st_data_4.data(), st_data_4.size());
+
+            state_vector_1.applyReflection(state, wires);
+            state_vector_2.applyMatrix(reflectionMatrix(state), wires);
+            state_vector_3.applyGroverOperator(wires);
+            state_vector_4.applyMatrix(reflectionMatrix(uniform), wires);
+
+            // Absolute margins, since amplitudes close to zero have no
+            // meaningful relative error
+            REQUIRE(getData(state_vector_1) ==
+                    approx(getData(state_vector_2)).margin(eps));
+            REQUIRE(getData(state_vector_3) ==
+                    approx(getData(state_vector_4)).margin(eps));
+
+            // The reflection is its own inverse
+            state_vector_1.applyReflection(state, wires);
+            state_vector_3.applyGroverOperator(wires);
+            REQUIRE(getData(state_vector_1) == approx(ini_st).margin(eps));
+            REQUIRE(getData(state_vector_3) == approx(ini_st).margin(eps));
+        }
+    }
+
+    SECTION("Test applyOperation without a matrix") {
+        const std::vector<size_t> wires{4, 0, 2};
+        VectorT st_data_1 =
+            createRandomStateVectorData<PrecisionT>(re, num_qubits);
+        VectorT st_data_2 = st_data_1;
+        StateVectorT state_vector_1(st_data_1.data(), st_data_1.size());
+        StateVectorT state_vector_2(st_data_2.data(), st_data_2.size());
+
+        state_vector_1.applyOperation("GroverOperator", wires, true, {},
+                                      std::vector<ComplexT>{});
+        state_vector_2.applyGroverOperator(wires);
+        REQUIRE(isApproxEqual(
+            state_vector_1.getData(), state_vector_1.getLength(),
+            state_vector_2.getData(), state_vector_2.getLength(), eps));
+    }
+
+    SECTION("Test a large state against the provided uniform state") {
+        const size_t large_qubits = 16;
+        for (const auto &wires : std::vector<std::vector<size_t>>{
+                 {15, 3, 0, 7, 12, 1, 9, 4, 10, 2, 14, 5, 8, 11},
+                 {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+                 {6, 2}}) {
+            const size_t dim = size_t{1} << wires.size();
+            const std::vector<ComplexT> uniform(
+                dim, ComplexT{1 / std::sqrt(static_cast<PrecisionT>(dim)), 0});
+
+            VectorT st_data_1 =
+                createRandomStateVectorData<PrecisionT>(re, large_qubits);
+            VectorT st_data_2 = st_data_1;
+            StateVectorT state_vector_1(st_data_1.data(), st_data_1.size());
+            StateVectorT state_vector_2(st_data_2.data(), st_data_2.size());
+
+            state_vector_1.applyGroverOperator(wires);
+            state_vector_2.applyReflection(uniform, wires);
+            // Threaded reductions may sum in a different order
+            const std::vector<ComplexT> result_1(
+                state_vector_1.getData(),
+                state_vector_1.getData() + state_vector_1.getLength());
+            const std::vector<ComplexT> result_2(
+                state_vector_2.getData(),
+                state_vector_2.getData() + state_vector_2.getLength());
+            REQUIRE(result_1 == approx(result_2).margin(PrecisionT{1e-6}));
+        }
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("StateVectorLQubit::applyPermutation",
+                           "[applyPermutation]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using VectorT = TestVector<ComplexT>;
+
+    const size_t num_qubits = 5;
+
+    // Dense matrix of a permutation table
+    auto permutationMatrix = [](const std::vector<size_t> &perm) {
+        const size_t dim = perm.size();
+        std::vector<ComplexT> matrix(dim * dim);
+        for (size_t x = 0; x < dim; x++) {
+            matrix[perm[x] * dim + x] = 1.0;
+        }
+        return matrix;
+    };
+
+    // Amplitudes of a statevector
+    auto amplitudes = [](const StateVectorT &sv) {
+        return std::vector<ComplexT>(sv.getData(),
+                                     sv.getData() + sv.getLength());
+    };
+
+    // Local index of an amplitude in the basis of the wires
+    auto localIndex = [](size_t idx, size_t n_qubits,
+                         const std::vector<size_t> &wires) {
+        size_t local = 0;
+        for (const size_t wire : wires) {
+            local = (local << 1U) | ((idx >> (n_qubits - 1 - wire)) & 1U);
+        }
+        return local;
+    };
+
+    SECTION("Test invalid arguments") {
+        VectorT st_data =
+            createRandomStateVectorData<PrecisionT>(re, num_qubits);
+        StateVectorT state_vector(st_data.data(), st_data.size());
+        REQUIRE_THROWS_WITH(
+            state_vector.applyPermutation({1, 0, 2}, {0, 1}),
+            Catch::Contains("The size of the permutation table does not"));
+        REQUIRE_THROWS_WITH(state_vector.applyPermutation({1, 1, 2, 3}, {0, 1}),
+                            Catch::Contains("The table is not a permutation"));
+        REQUIRE_THROWS_WITH(state_vector.applyPermutation({1, 0}, {5}),
+                            Catch::Contains("Invalid wire index"));
+        REQUIRE_THROWS_WITH(state_vector.applyOracle({0, 4}, {0}, {1, 2}),
+                            Catch::Contains("must fit in the output wires"));
+        REQUIRE_THROWS_WITH(state_vector.applyOracle({0, 1}, {0}, {0}),
+                            Catch::Contains("Wires must be unique"));
+        REQUIRE_THROWS_WITH(state_vector.applyModularMultiply(3, 6, {0, 1, 2}),
+                            Catch::Contains("must be coprime to the modulus"));
+        REQUIRE_THROWS_WITH(state_vector.applyModularMultiply(3, 9, {0, 1, 2}),
+                            Catch::Contains("The modulus must be between"));
+    }
+
+    for (const auto &wires : std::vector<std::vector<size_t>>{
+             {2}, {3, 0}, {4, 1, 2}, {0, 1, 2, 3, 4}, {3, 0, 4, 2, 1}}) {
+        DYNAMIC_SECTION("Test against the dense matrix - num_wires = "
+                        << wires.size() << ", wires[0] = " << wires[0]) {
+            std::vector<size_t> perm(size_t{1} << wires.size());
+            std::iota(perm.begin(), perm.end(), 0);
+            std::shuffle(perm.begin(), perm.end(), re);
+
+            const VectorT ini_st =
+                createRandomStateVectorData<PrecisionT>(re, num_qubits);
+            VectorT st_data_1 = ini_st;
+            VectorT st_data_2 = ini_st;
+            VectorT st_data_3 = ini_st;
+            StateVectorT state_vector_1(st_data_1.data(), st_data_1.size());
+            StateVectorT state_vector_2(st_data_2.data(), st_data_2.size());
+            StateVectorT state_vector_3(st_data_3.data(), st_data_3.size());
+
+            state_vector_1.applyPermutation(perm, wires);
+            state_vector_2.applyPermutation(perm, wires, true);
+            state_vector_3.applyMatrix(permutationMatrix(perm), wires);
+
+            const auto expected = amplitudes(state_vector_3);
+            CHECK(amplitudes(state_vector_1) == approx(expected));
+            CHECK(amplitudes(state_vector_2) == approx(expected));
+        }
+    }
+
+    SECTION("Test applyOracle") {
+        const std::vector<size_t> x_wires{3, 0};
+        const std::vector<size_t> y_wires{4, 1, 2};
+        const std::vector<size_t> f{5, 0, 7, 2};
+
+        std::vector<size_t> wires = x_wires;
+        wires.insert(wires.end(), y_wires.begin(), y_wires.end());
+        std::vector<size_t> perm(32);
+        for (size_t x = 0; x < 4; x++) {
+            for (size_t y = 0; y < 8; y++) {
+                perm[x * 8 + y] = x * 8 + (y ^ f[x]);
+            }
+        }
+
+        const VectorT ini_st =
+            createRandomStateVectorData<PrecisionT>(re, num_qubits);
+        VectorT st_data_1 = ini_st;
+        VectorT st_data_2 = ini_st;
+        StateVectorT state_vector_1(st_data_1.data(), st_data_1.size());
+        StateVectorT state_vector_2(st_data_2.data(), st_data_2.size());
+
+        state_vector_1.applyOracle(f, x_wires, y_wires);
+        state_vector_2.applyMatrix(permutationMatrix(perm), wires);
+        CHECK(amplitudes(state_vector_1) ==
+              approx(amplitudes(state_vector_2)));
+
+        // The oracle is its own inverse
+        state_vector_1.applyOracle(f, x_wires, y_wires);
+        CHECK(amplitudes(state_vector_1) ==
+              approx(std::vector<ComplexT>(ini_st.begin(), ini_st.end())));
+    }
+
+    SECTION("Test modular arithmetic on basis states") {
+        const std::vector<size_t> wires{1, 4, 0, 3};
+        for (size_t x = 0; x < 16; x++) {
+            // Wire 2 is set and the register is in the state |x>
+            size_t idx = size_t{1} << (num_qubits - 1 - 2);
+            for (size_t i = 0; i < wires.size(); i++) {
+                if (((x >> (wires.size() - 1 - i)) & 1U) != 0) {
+                    idx |= size_t{1} << (num_qubits - 1 - wires[i]);
+                }
+            }
+
+            std::vector<ComplexT> st_data_1(size_t{1} << num_qubits);
+            st_data_1[idx] = 1.0;
+            std::vector<ComplexT> st_data_2 = st_data_1;
+            StateVectorT state_vector_1(st_data_1.data(), st_data_1.size());
+            StateVectorT state_vector_2(st_data_2.data(), st_data_2.size());
+
+            state_vector_1.applyModularAdd(11, wires);
+            state_vector_2.applyModularMultiply(7, 15, wires);
+
+            const auto nonzero = [&](const std::vector<ComplexT> &st) {
+                const auto it = std::find_if(
+                    st.begin(), st.end(),
+                    [](const ComplexT &amp) { return std::abs(amp) > 0.5; });
+                REQUIRE((it - st.begin()) & (size_t{1} << (num_qubits - 3)));
+                return localIndex(static_cast<size_t>(it - st.begin()),
+                                  num_qubits, wires);
+            };
+            CHECK(nonzero(amplitudes(state_vector_1)) == (x + 11) % 16);
+            CHECK(nonzero(amplitudes(state_vector_2)) ==
+                  ((x < 15) ? (7 * x) % 15 : x));
+        }
+    }
+
+    SECTION("Test a large state") {
+        const size_t large_qubits = 16;
+        for (const auto &wires : std::vector<std::vector<size_t>>{
+                 {15, 3, 0, 7, 12, 1, 9, 4, 10, 2, 14, 5, 8, 11},
+                 {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+                 {6, 2}}) {
+            const size_t a = 12345;
+            const size_t dim = size_t{1} << wires.size();
+
+            const VectorT ini_st =
+                createRandomStateVectorData<PrecisionT>(re, large_qubits);
+            VectorT st_data_1 = ini_st;
+            VectorT st_data_2 = ini_st;
+            StateVectorT state_vector_1(st_data_1.data(), st_data_1.size());
+            StateVectorT state_vector_2(st_data_2.data(), st_data_2.size());
+
+            state_vector_1.applyModularAdd(a, wires);
+            state_vector_2.applyPermutation(
+                Pennylane::LightningQubit::Util::modularAddTable(wires.size(),
+                                                                 a),
+                wires, true);
+
+            const auto result_1 = amplitudes(state_vector_1);
+            const auto result_2 = amplitudes(state_vector_2);
+            for (size_t idx = 0; idx < ini_st.size(); idx++) {
+                const size_t x = localIndex(idx, large_qubits, wires);
+                const size_t y = (x + a) % dim;
+                size_t new_idx = idx;
+                for (size_t i = 0; i < wires.size(); i++) {
+                    const size_t shift = large_qubits - 1 - wires[i];
+                    const size_t bit = (y >> (wires.size() - 1 - i)) & 1U;
+                    new_idx =
+                        (new_idx & ~(size_t{1} << shift)) | (bit << shift);
+                }
+                REQUIRE(result_1[new_idx] == ini_st[idx]);
+                REQUIRE(result_2[new_idx] == ini_st[idx]);
+            }
+        }
+    }
+}
+
 TEMPLATE_PRODUCT_TEST_CASE("StateVectorLQubit::applyOperations",
                            "[applyOperations invalid arguments]",
                            (StateVectorLQubitManaged, StateVectorLQubitRaw),
@@ -214,3 +598,123 @@ TEMPLATE_PRODUCT_TEST_CASE("StateVectorLQubit::applyOperations",
             LightningException, "must all be equal"); // invalid parameters
     }
 }
+
+TEMPLATE_PRODUCT_TEST_CASE("StateVectorLQubit::getAmplitudes",
+                           "[getAmplitudes]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using VectorT = TestVector<ComplexT>;
+
+    const size_t num_qubits = 5;
+    VectorT st_data = createRandomStateVectorData<PrecisionT>(re, num_qubits);
+    StateVectorT state_vector(st_data.data(), st_data.size());
+
+    SECTION("Index list") {
+        const std::vector<size_t> indices{31, 0, 7, 7, 16};
+        const auto amps = state_vector.getAmplitudes(indices);
+        REQUIRE(amps.size() == indices.size());
+        for (size_t k = 0; k < indices.size(); k++) {
+            CHECK(amps[k] == st_data[indices[k]]);
+        }
+        PL_REQUIRE_THROWS_MATCHES(state_vector.getAmplitudes({32}),
+                                  LightningException, "out of range");
+    }
+
+    SECTION("Contiguous range") {
+        const auto amps = state_vector.getAmplitudesRange(3, 11);
+        REQUIRE(amps.size() == 8);
+        for (size_t k = 0; k < amps.size(); k++) {
+            CHECK(amps[k] == st_data[3 + k]);
+        }
+        CHECK(state_vector.getAmplitudesRange(4, 4).empty());
+        PL_REQUIRE_THROWS_MATCHES(state_vector.getAmplitudesRange(4, 33),
+                                  LightningException, "Invalid basis-state");
+    }
+
+    SECTION("Fixed-bitstring slice") {
+        const std::vector<size_t> wires{3, 0};
+        const std::vector<size_t> values{1, 0};
+        const auto amps = state_vector.getAmplitudesSlice(wires, values);
+        REQUIRE(amps.size() == 8);
+
+        // Remaining wires {1, 2, 4}, in order, index the slice.
+        for (size_t k = 0; k < amps.size(); k++) {
+            const size_t b1 = (k >> 2U) & 1U;
+            const size_t b2 = (k >> 1U) & 1U;
+            const size_t b4 = k & 1U;
+            const size_t idx = (b1 << 3U) | (b2 << 2U) | (1U << 1U) | b4;
+            CHECK(amps[k] == st_data[idx]);
+        }
+
+        const auto full = state_vector.getAmplitudesSlice({}, {});
+        REQUIRE(full.size() == st_data.size());
+        CHECK(std::equal(full.begin(), full.end(), st_data.begin()));
+
+        PL_REQUIRE_THROWS_MATCHES(
+            state_vector.getAmplitudesSlice({1, 1}, {0, 0}),
+            LightningException, "Wires must be unique");
+        PL_REQUIRE_THROWS_MATCHES(state_vector.getAmplitudesSlice({1}, {2}),
+                                  LightningException, "must be 0 or 1");
+        PL_REQUIRE_THROWS_MATCHES(state_vector.getAmplitudesSlice({5}, {0}),
+                                  LightningException, "Invalid wire index");
+        PL_REQUIRE_THROWS_MATCHES(state_vector.getAmplitudesSlice({1}, {0, 1}),
+                                  LightningException, "must be equal");
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("StateVectorLQubit::snapshot", "[snapshot]",
+                           (StateVectorLQubitManaged, StateVectorLQubitRaw),
+                           (float, double)) {
+    using StateVectorT = TestType;
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = typename StateVectorT::ComplexT;
+    using VectorT = TestVector<ComplexT>;
+
+    const size_t num_qubits = 6;
+    VectorT st_data = createRandomStateVectorData<PrecisionT>(re, num_qubits);
+    const VectorT expected = st_data;
+    StateVectorT state_vector(st_data.data(), st_data.size());
+
+    SECTION("Restore") {
+        const auto snap = state_vector.snapshot(3);
+        REQUIRE(snap.getNumQubits() == num_qubits);
+        REQUIRE(snap.getNumChunks() == 8);
+
+        state_vector.applyOperation("Hadamard", {0});
+        state_vector.restore(snap);
+        CHECK(std::equal(expected.begin(), expected.end(),
+                         state_vector.getData()));
+    }
+
+    SECTION("Chunks are shared with the base snapshot") {
+        const auto base = state_vector.snapshot(3);
+        std::fill(state_vector.getData() + 16,
+                  state_vector.getData() + state_vector.getLength(),
+                  ComplexT{0.0, 0.0});
+        const auto zeroed = state_vector.snapshot(base);
+        CHECK(zeroed.getNumSharedChunks(base) == 2);
+
+        // PauliX on the last wire leaves the zeroed chunks unchanged
+        state_vector.applyOperation("PauliX", {num_qubits - 1});
+        const auto flipped = state_vector.snapshot(zeroed);
+        CHECK(flipped.getNumSharedChunks(zeroed) == 6);
+
+        state_vector.restore(base);
+        CHECK(std::equal(expected.begin(), expected.end(),
+                         state_vector.getData()));
+    }
+
+    SECTION("Mismatched number of qubits") {
+        StateVectorLQubitManaged<PrecisionT> other(num_qubits - 1);
+        const auto snap = other.snapshot();
+        PL_REQUIRE_THROWS_MATCHES(state_vector.restore(snap),
+                                  LightningException,
+                                  "same number of qubits");
+        PL_REQUIRE_THROWS_MATCHES(state_vector.snapshot(snap),
+                                  LightningException,
+                                  "same number of qubits");
+    }
+}
@@ -0,0 +1,272 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "StateVectorLQubitFixed.hpp"
+#include "StateVectorLQubitManaged.hpp"
+#include "TestHelpers.hpp" // createRandomStateVectorData, approx
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+/**
+ * @file
+ *  Tests for the StateVectorLQubitFixed class.
+ */
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::LightningQubit;
+using Pennylane::Gates::GateOperation;
+using Pennylane::Util::approx;
+using Pennylane::Util::createRandomStateVectorData;
+using Pennylane::Util::LightningException;
+std::mt19937_64 re{1337};
+
+// Heap allocations of the calling thread are counted while enabled
+thread_local bool count_allocations = false;
+thread_local size_t num_allocations = 0;
+} // namespace
+/// @endcond
+
+auto operator new(size_t size) -> void * {
+    if (count_allocations) {
+        num_allocations++;
+    }
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, [[maybe_unused]] size_t size) noexcept {
+    std::free(ptr);
+}
+
+TEMPLATE_TEST_CASE("StateVectorLQubitFixed::StateVectorLQubitFixed",
+                   "[StateVectorLQubitFixed]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexT = std::complex<PrecisionT>;
+
+    SECTION("StateVectorLQubitFixed<TestType, 4> {}") {
+        StateVectorLQubitFixed<PrecisionT, 4> sv;
+
+        REQUIRE(sv.getNumQubits() == 4);
+        REQUIRE(sv.getLength() == 16);
+        REQUIRE(sv.getDataArray().size() == 16);
+        REQUIRE(sv.getData()[0] == ComplexT{1.0, 0.0});
+        REQUIRE(reinterpret_cast<std::uintptr_t>(sv.getData()) % 64 == 0);
+    }
+    SECTION("StateVectorLQubitFixed<TestType, 3> {std::vector}") {
+        auto st_data = createRandomStateVectorData<PrecisionT>(re, 3);
+        StateVectorLQubitFixed<PrecisionT, 3> sv(st_data);
+
+        REQUIRE(std::vector<ComplexT>(sv.getData(), sv.getData() + 8) ==
+                approx(st_data));
+
+        sv.resetStateVector();
+        REQUIRE(sv.getData()[0] == ComplexT{1.0, 0.0});
+        REQUIRE(std::all_of(sv.getData() + 1, sv.getData() + 8,
+                            [](auto amp) { return amp == ComplexT{}; }));
+    }
+    SECTION("Kernel maps are built on first use") {
+        const std::vector<size_t> wire0{0};
+        const std::vector<size_t> wires01{0, 1};
+        const std::vector<PrecisionT> angle{0.3};
+
+        num_allocations = 0;
+        count_allocations = true;
+        StateVectorLQubitFixed<PrecisionT, 3> sv;
+        sv.template applyGate<GateOperation::RY>(wire0, false, PrecisionT{0.3});
+        sv.applyOperation(GateOperation::RX, wire0, false, angle);
+        sv.applyOperation(GateOperation::CNOT, wires01);
+        count_allocations = false;
+        CHECK(num_allocations == 0);
+
+        count_allocations = true;
+        const auto &[gate_kernels, generator_kernels, matrix_kernels] =
+            sv.getSupportedKernels();
+        count_allocations = false;
+        CHECK(num_allocations > 0);
+        CHECK(!gate_kernels.empty());
+        CHECK(!generator_kernels.empty());
+        CHECK(!matrix_kernels.empty());
+    }
+    SECTION("Data of a wrong size") {
+        std::vector<ComplexT> st_data(4);
+        using SVT = StateVectorLQubitFixed<PrecisionT, 3>;
+        REQUIRE_THROWS_AS(SVT(st_data), LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorLQubitFixed::applyOperation",
+                   "[StateVectorLQubitFixed]", float, double) {
+    using PrecisionT = TestType;
+    constexpr size_t num_qubits = 4;
+
+    const std::vector<std::string> ops{"Hadamard", "CNOT",  "RX",
+                                       "Rot",      "CRY",   "IsingXY",
+                                       "Toffoli",  "QFT",   "SWAP"};
+    const std::vector<std::vector<size_t>> wires{
+        {0}, {0, 2}, {3}, {1}, {2, 1}, {0, 3}, {3, 0, 1}, {1, 2, 3}, {0, 2}};
+    const std::vector<std::vector<PrecisionT>> params{
+        {}, {}, {0.3}, {0.1, -0.4, 0.7}, {1.2}, {-0.8}, {}, {}, {}};
+
+    auto st_data = createRandomStateVectorData<PrecisionT>(re, num_qubits);
+
+    for (const bool inverse : {false, true}) {
+        StateVectorLQubitManaged<PrecisionT> expected(st_data);
+        StateVectorLQubitFixed<PrecisionT, num_qubits> by_name(st_data);
+        StateVectorLQubitFixed<PrecisionT, num_qubits> by_op(st_data);
+
+        const auto &dispatcher =
+            DynamicDispatcher<PrecisionT>::getInstance();
+        for (size_t idx = 0; idx < ops.size(); idx++) {
+            expected.applyOperation(ops[idx], wires[idx], inverse,
+                                    params[idx]);
+            by_name.applyOperation(ops[idx], wires[idx], inverse,
+                                   params[idx]);
+            by_op.applyOperation(dispatcher.strToGateOp(ops[idx]),
+                                 wires[idx], inverse, params[idx]);
+        }
+
+        const auto &data = expected.getDataVector();
+        const std::vector<std::complex<PrecisionT>> ref{data.begin(),
+                                                        data.end()};
+        const auto &by_name_data = by_name.getDataArray();
+        const auto &by_op_data = by_op.getDataArray();
+        CHECK(std::vector<std::complex<PrecisionT>>(by_name_data.begin(),
+                                                    by_name_data.end()) ==
+              approx(ref).margin(1e-5));
+        CHECK(std::vector<std::complex<PrecisionT>>(
+                  by_op_data.begin(), by_op_data.end()) ==
+              approx(ref).margin(1e-5));
+    }
+
+    SECTION("applyGate") {
+        StateVectorLQubitFixed<PrecisionT, num_qubits> sv(st_data);
+        StateVectorLQubitManaged<PrecisionT> expected(st_data);
+
+        sv.template applyGate<GateOperation::RY>({2}, false, 0.4);
+        sv.template applyGate<GateOperation::CZ>({1, 2}, false);
+        sv.template applyGate<GateOperation::Rot>({3}, true, 0.1, 0.2, 0.3);
+        expected.applyOperation("RY", {2}, false, {0.4});
+        expected.applyOperation("CZ", {1, 2}, false);
+        expected.applyOperation("Rot", {3}, true, {0.1, 0.2, 0.3});
+
+        const auto &data = expected.getDataVector();
+        CHECK(std::vector<std::complex<PrecisionT>>(sv.getData(),
+                                                    sv.getData() + 16) ==
+              approx(std::vector<std::complex<PrecisionT>>(data.begin(),
+                                                           data.end()))
+                  .margin(1e-5));
+    }
+
+    SECTION("GroverOperator") {
+        StateVectorLQubitFixed<PrecisionT, num_qubits> sv(st_data);
+        StateVectorLQubitManaged<PrecisionT> expected(st_data);
+
+        sv.applyOperation("GroverOperator", {3, 0, 2});
+        expected.applyGroverOperator({3, 0, 2});
+
+        const auto &data = expected.getDataVector();
+        CHECK(std::vector<std::complex<PrecisionT>>(sv.getData(),
+                                                    sv.getData() + 16) ==
+              approx(std::vector<std::complex<PrecisionT>>(data.begin(),
+                                                           data.end()))
+                  .margin(1e-5));
+    }
+
+    SECTION("Unknown operation") {
+        StateVectorLQubitFixed<PrecisionT, num_qubits> sv(st_data);
+        PL_REQUIRE_THROWS_MATCHES(
+            sv.applyOperation("NotAGate", {0}), LightningException,
+            "The operation NotAGate is not supported by "
+            "StateVectorLQubitFixed.");
+    }
+
+    SECTION("applyMatrix") {
+        StateVectorLQubitFixed<PrecisionT, 2> sv;
+        const std::vector<std::complex<PrecisionT>> pauli_x{
+            {0.0, 0.0}, {1.0, 0.0}, {1.0, 0.0}, {0.0, 0.0}};
+        sv.applyMatrix(pauli_x, {1});
+        CHECK(sv.getData()[1] == std::complex<PrecisionT>{1.0, 0.0});
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorLQubitFixed::runBatched",
+                   "[StateVectorLQubitFixed]", float, double) {
+    using PrecisionT = TestType;
+    using StateVectorT = StateVectorLQubitFixed<PrecisionT, 3>;
+    const size_t num_circuits = 200;
+
+    SECTION("Expectation values") {
+        std::vector<PrecisionT> results(num_circuits);
+        runBatched<PrecisionT, 3>(
+            num_circuits, [&results](size_t idx, StateVectorT &sv) {
+                const auto angle = static_cast<PrecisionT>(0.01 * idx);
+                sv.template applyGate<GateOperation::RY>({1}, false, angle);
+                sv.applyOperation("CNOT", {1, 2});
+                // <Z_2> from the amplitudes, wire 2 being the last bit
+                PrecisionT expval{0.0};
+                for (size_t i = 0; i < StateVectorT::length; i++) {
+                    const PrecisionT sign = (i & 1U) ? -1.0 : 1.0;
+                    expval += sign * std::norm(sv.getData()[i]);
+                }
+                results[idx] = expval;
+            });
+
+        for (size_t idx = 0; idx < num_circuits; idx++) {
+            CHECK(results[idx] == Approx(std::cos(0.01 * idx)).margin(1e-5));
+        }
+    }
+
+    SECTION("Exceptions are rethrown") {
+        auto circuit = [](size_t idx, StateVectorT &sv) {
+            sv.applyOperation(idx == 17 ? "NotAGate" : "PauliX", {0});
+        };
+        REQUIRE_THROWS(runBatched<PrecisionT, 3>(num_circuits, circuit));
+    }
+
+    SECTION("The first exception is rethrown") {
+        // Every circuit from 17 on fails. With a single thread, circuits run
+        // in order, so circuit 17 fails first.
+        auto circuit = [](size_t idx, StateVectorT &sv) {
+            sv.applyOperation("PauliX", {0});
+            PL_ABORT_IF(idx >= 17, "Circuit " + std::to_string(idx));
+        };
+#if defined(_OPENMP)
+        const int prev_threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+#endif
+        PL_CHECK_THROWS_MATCHES((runBatched<PrecisionT, 3>(num_circuits,
+                                                           circuit)),
+                                LightningException, "Circuit 17");
+#if defined(_OPENMP)
+        omp_set_num_threads(prev_threads);
+#endif
+    }
+}
@@ -36,7 +36,11 @@
 /// @cond DEV
 namespace {
 using namespace Pennylane::LightningQubit;
+using Pennylane::LightningQubit::Util::Threading;
+using Pennylane::Util::CPUMemoryModel;
 using Pennylane::Util::createRandomStateVectorData;
+using Pennylane::Util::exp2;
+using Pennylane::Util::getMemoryModel;
 using Pennylane::Util::randomUnitary;
 using Pennylane::Util::TestVector;
 std::mt19937_64 re{1337};
@@ -107,4 +111,93 @@ TEMPLATE_TEST_CASE("StateVectorLQubitManaged::StateVectorLQubitManaged",
 
         REQUIRE(sv.getDataVector() == approx(st_data));
     }
-}
\ No newline at end of file
+}
+
+TEMPLATE_TEST_CASE("StateVectorLQubitManaged::fork",
+                   "[StateVectorLQubitManaged]", float, double) {
+    using PrecisionT = TestType;
+    using PoolT = AmplitudeBufferPool<PrecisionT>;
+
+    const size_t num_qubits = 4;
+    auto st_data = createRandomStateVectorData<PrecisionT>(re, num_qubits);
+    StateVectorLQubitManaged<PrecisionT> parent(st_data.data(),
+                                                st_data.size());
+
+    PoolT::getInstance().clear();
+    {
+        auto child = parent.fork();
+        REQUIRE(child.getDataVector() == parent.getDataVector());
+
+        child.applyOperation("PauliX", {0});
+        REQUIRE(child.getDataVector() != parent.getDataVector());
+        REQUIRE(std::equal(st_data.begin(), st_data.end(), parent.getData()));
+    }
+    // The buffer of the destroyed fork is kept for the next one.
+    REQUIRE(PoolT::getInstance().getNumPooledAmplitudes() == st_data.size());
+    {
+        const auto child = parent.fork();
+        REQUIRE(PoolT::getInstance().getNumPooledAmplitudes() == 0);
+        REQUIRE(std::equal(st_data.begin(), st_data.end(), child.getData()));
+    }
+    PoolT::getInstance().clear();
+    REQUIRE(PoolT::getInstance().getNumPooledAmplitudes() == 0);
+}
+
+TEMPLATE_TEST_CASE("StateVectorLQubitManaged::fork memory model",
+                   "[StateVectorLQubitManaged]", float, double) {
+    using PrecisionT = TestType;
+    using PoolT = AmplitudeBufferPool<PrecisionT>;
+
+    const size_t num_qubits = 4;
+    auto st_data = createRandomStateVectorData<PrecisionT>(re, num_qubits);
+    StateVectorLQubitManaged<PrecisionT> unaligned(
+        st_data.data(), st_data.size(), Threading::SingleThread,
+        CPUMemoryModel::Unaligned);
+    StateVectorLQubitManaged<PrecisionT> aligned(
+        st_data.data(), st_data.size(), Threading::SingleThread,
+        CPUMemoryModel::Aligned256);
+
+    PoolT::getInstance().clear();
+    {
+        const auto child = unaligned.fork();
+        REQUIRE(child.memoryModel() == CPUMemoryModel::Unaligned);
+    }
+    REQUIRE(PoolT::getInstance().getNumPooledAmplitudes() == st_data.size());
+    {
+        // The pooled unaligned buffer is not handed to an aligned fork.
+        const auto child = aligned.fork();
+        REQUIRE(PoolT::getInstance().getNumPooledAmplitudes() ==
+                st_data.size());
+        REQUIRE(child.memoryModel() == CPUMemoryModel::Aligned256);
+        REQUIRE(getMemoryModel(child.getData()) != CPUMemoryModel::Unaligned);
+        REQUIRE(std::equal(st_data.begin(), st_data.end(), child.getData()));
+    }
+    PoolT::getInstance().clear();
+}
+
+TEMPLATE_TEST_CASE("AmplitudeBufferPool::setCapacity",
+                   "[StateVectorLQubitManaged]", float, double) {
+    using PrecisionT = TestType;
+    using PoolT = AmplitudeBufferPool<PrecisionT>;
+    auto &pool = PoolT::getInstance();
+
+    const size_t num_qubits = 4;
+    StateVectorLQubitManaged<PrecisionT> parent(num_qubits);
+
+    pool.clear();
+    { const auto child = parent.fork(); }
+    REQUIRE(pool.getNumPooledAmplitudes() == exp2(num_qubits));
+
+    // Lowering the capacity below the pooled amplitudes frees them.
+    pool.setCapacity(exp2(num_qubits) - 1);
+    REQUIRE(pool.getNumPooledAmplitudes() == 0);
+    { const auto child = parent.fork(); }
+    REQUIRE(pool.getNumPooledAmplitudes() == 0);
+
+    // A capacity of 0 disables pooling.
+    pool.setCapacity(0);
+    { const auto child = parent.fork(); }
+    REQUIRE(pool.getNumPooledAmplitudes() == 0);
+
+    pool.setCapacity(PoolT::default_capacity);
+}
@@ -0,0 +1,140 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BasisPermutation.hpp
+ * @brief Lookup tables of basis permutations and their cycle decomposition.
+ *
+ * A permutation of `n_bits` bits is given as a table `perm` of size
+ * `2^n_bits`, which maps the basis state `|x>` to `|perm[x]>`.
+ */
+
+#pragma once
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::LightningQubit::Util {
+/**
+ * @brief Cycles of a permutation, without its fixed points.
+ *
+ * Cycle `c` is `elements[offsets[c]], ..., elements[offsets[c + 1] - 1]`,
+ * where each element is mapped to the next one and the last element to the
+ * first one.
+ */
+struct PermutationCycles {
+    std::vector<std::size_t> elements;
+    std::vector<std::size_t> offsets{0};
+
+    [[nodiscard]] auto numCycles() const -> std::size_t {
+        return offsets.size() - 1;
+    }
+};
+
+/**
+ * @brief Decompose a permutation table into cycles.
+ *
+ * @param perm Permutation table.
+ * @return PermutationCycles
+ */
+inline auto permutationCycles(const std::vector<std::size_t> &perm)
+    -> PermutationCycles {
+    PermutationCycles cycles;
+    std::vector<bool> visited(perm.size(), false);
+    for (std::size_t start = 0; start < perm.size(); start++) {
+        PL_ABORT_IF_NOT(perm[start] < perm.size(),
+                        "The table is not a permutation.");
+        if (visited[start] || perm[start] == start) {
+            continue;
+        }
+        std::size_t x = start;
+        do {
+            PL_ABORT_IF(visited[x], "The table is not a permutation.");
+            visited[x] = true;
+            cycles.elements.push_back(x);
+            x = perm[x];
+            PL_ABORT_IF_NOT(x < perm.size(), "The table is not a permutation.");
+        } while (x != start);
+        cycles.offsets.push_back(cycles.elements.size());
+    }
+    return cycles;
+}
+
+/**
+ * @brief Permutation table of the oracle `|x>|y> -> |x>|y XOR f(x)>`, with
+ * `x` as the most significant bits.
+ *
+ * @param f Values of the function, one per value of `x`.
+ * @param y_bits Number of bits of `y`.
+ * @return Permutation table of `log2(f.size()) + y_bits` bits.
+ */
+inline auto oracleTable(const std::vector<std::size_t> &f, std::size_t y_bits)
+    -> std::vector<std::size_t> {
+    const std::size_t y_dim = std::size_t{1} << y_bits;
+    std::vector<std::size_t> perm(f.size() * y_dim);
+    for (std::size_t x = 0; x < f.size(); x++) {
+        PL_ABORT_IF_NOT(f[x] < y_dim,
+                        "The function values must fit in the output wires.");
+        for (std::size_t y = 0; y < y_dim; y++) {
+            perm[x * y_dim + y] = x * y_dim + (y ^ f[x]);
+        }
+    }
+    return perm;
+}
+
+/**
+ * @brief Permutation table of `|x> -> |x + a mod 2^n_bits>`.
+ *
+ * @param n_bits Number of bits.
+ * @param a Constant to add.
+ */
+inline auto modularAddTable(std::size_t n_bits, std::size_t a)
+    -> std::vector<std::size_t> {
+    const std::size_t dim = std::size_t{1} << n_bits;
+    std::vector<std::size_t> perm(dim);
+    for (std::size_t x = 0; x < dim; x++) {
+        perm[x] = (x + a) & (dim - 1);
+    }
+    return perm;
+}
+
+/**
+ * @brief Permutation table of `|x> -> |a x mod N>` for `x < N`, which leaves
+ * the basis states `x >= N` unchanged.
+ *
+ * @param n_bits Number of bits.
+ * @param a Multiplier, coprime to `N`.
+ * @param N Modulus, at most `2^n_bits`.
+ */
+inline auto modularMultiplyTable(std::size_t n_bits, std::size_t a,
+                                 std::size_t N) -> std::vector<std::size_t> {
+    const std::size_t dim = std::size_t{1} << n_bits;
+    PL_ABORT_IF_NOT(N >= 1 && N <= dim,
+                    "The modulus must be between 1 and 2^(number of wires).");
+    PL_ABORT_IF_NOT(std::gcd(a, N) == 1,
+                    "The multiplier must be coprime to the modulus.");
+    std::vector<std::size_t> perm(dim);
+    std::iota(perm.begin(), perm.end(), 0);
+    const std::size_t a_mod = a % N;
+    std::size_t ax = 0; // a * x mod N
+    for (std::size_t x = 0; x < N; x++) {
+        perm[x] = ax;
+        ax += a_mod;
+        ax = (ax >= N) ? ax - N : ax;
+    }
+    return perm;
+}
+} // namespace Pennylane::LightningQubit::Util
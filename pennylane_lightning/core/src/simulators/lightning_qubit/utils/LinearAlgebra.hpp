@@ -853,4 +853,55 @@ void scaleAndAdd(std::complex<T> a, const std::vector<std::complex<T>> &x,
     }
     scaleAndAdd(x.size(), a, x.data(), y.data());
 }
+
+/**
+ * @brief @rst
+ * Calculate :math:`y += \sum_k a_k x_k` for scalars :math:`a_k` and vectors
+ * :math:`x_k` in a single pass over :math:`y`.
+ * @endrst
+ *
+ * The vectors are processed in blocks of `BLOCK_SIZE` elements. Each block of
+ * y is updated by every x_k while it stays in cache, so y is read and written
+ * once instead of once per vector.
+ *
+ * @tparam BLOCK_SIZE Number of elements of y updated together.
+ * @tparam STD_CROSSOVER The number of dimension after which OpenMP version
+ * outperforms the standard method.
+ *
+ * @param dim Dimension of data
+ * @param num_vecs Number of vectors to add
+ * @param a Scalars to scale each x_k
+ * @param x Pointers to the vectors to add
+ * @param y Vector to be added
+ */
+template <class T,
+          size_t BLOCK_SIZE = 1U << 10U,   // NOLINT(readability-magic-numbers)
+          size_t STD_CROSSOVER = 1U << 12U> // NOLINT(readability-magic-numbers)
+void multiScaleAndAdd(size_t dim, size_t num_vecs, const std::complex<T> *a,
+                      const std::complex<T> *const *x, std::complex<T> *y) {
+    const size_t num_blocks = (dim + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    const auto update_block = [=](size_t block) {
+        const size_t begin = block * BLOCK_SIZE;
+        const size_t end = std::min(begin + BLOCK_SIZE, dim);
+        for (size_t k = 0; k < num_vecs; k++) {
+            const std::complex<T> a_k = a[k];
+            const std::complex<T> *x_k = x[k];
+            for (size_t i = begin; i < end; i++) {
+                y[i] += a_k * x_k[i];
+            }
+        }
+    };
+    if (dim < STD_CROSSOVER) {
+        for (size_t block = 0; block < num_blocks; block++) {
+            update_block(block);
+        }
+    } else {
+#if defined(_OPENMP)
+#pragma omp parallel for default(none) firstprivate(num_blocks, update_block)
+#endif
+        for (size_t block = 0; block < num_blocks; block++) {
+            update_block(block);
+        }
+    }
+}
 } // namespace Pennylane::LightningQubit::Util
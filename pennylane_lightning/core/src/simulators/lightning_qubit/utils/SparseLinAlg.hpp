@@ -18,9 +18,15 @@
  */
 
 #pragma once
+#include <algorithm>
 #include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
+#include "Error.hpp"
+
 namespace Pennylane::LightningQubit::Util {
 /**
  * @brief Apply a sparse matrix to a vector.
@@ -57,4 +63,299 @@ apply_Sparse_Matrix(const std::complex<fp_precision> *vector_ptr,
     }
     return result;
 };
+
+/// @cond DEV
+namespace Internal {
+/// Minimal number of rows for which sparse kernels use OpenMP.
+constexpr std::size_t sparse_omp_threshold = std::size_t{1} << 12U;
+} // namespace Internal
+/// @endcond
+
+/**
+ * @brief Apply a sparse matrix in CSR format to a vector.
+ *
+ * When `upper_triangle` is set, the matrix is Hermitian and only its entries
+ * on or above the diagonal are stored. Each off-diagonal entry is then also
+ * applied as its conjugate at the transposed position. As these entries
+ * scatter over the rows, this mode runs on a single thread.
+ *
+ * @tparam PrecisionT Floating point precision of the vector.
+ * @tparam ValueT Type of the non-zero elements, real or complex.
+ * @tparam RowIdxT Integer type of the row map.
+ * @tparam ColIdxT Integer type of the column indices.
+ * @param vector_ptr Pointer to the vector.
+ * @param vector_size Size of the vector, which is the number of rows.
+ * @param row_map_ptr Pointer to the row map of `vector_size + 1` elements.
+ * @param entries_ptr Pointer to the column indices of the non-zero elements.
+ * @param values_ptr Pointer to the non-zero elements.
+ * @param result_ptr Pointer to the result of `vector_size` elements.
+ * @param upper_triangle Whether only the upper triangle is stored.
+ */
+template <class PrecisionT, class ValueT, class RowIdxT, class ColIdxT>
+void sparseMatrixVector(const std::complex<PrecisionT> *vector_ptr,
+                        std::size_t vector_size, const RowIdxT *row_map_ptr,
+                        const ColIdxT *entries_ptr, const ValueT *values_ptr,
+                        std::complex<PrecisionT> *result_ptr,
+                        bool upper_triangle = false) {
+    using ComplexT = std::complex<PrecisionT>;
+    if (!upper_triangle) {
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none)                             \
+                shared(vector_ptr, vector_size, row_map_ptr, entries_ptr,      \
+                       values_ptr, result_ptr)                                 \
+                if (vector_size >= Internal::sparse_omp_threshold)
+        #endif
+        // clang-format on
+        for (std::size_t i = 0; i < vector_size; i++) {
+            ComplexT sum{0.0, 0.0};
+            for (auto k = static_cast<std::size_t>(row_map_ptr[i]);
+                 k < static_cast<std::size_t>(row_map_ptr[i + 1]); k++) {
+                sum += values_ptr[k] * vector_ptr[entries_ptr[k]];
+            }
+            result_ptr[i] = sum;
+        }
+        return;
+    }
+    std::fill(result_ptr, result_ptr + vector_size, ComplexT{0.0, 0.0});
+    for (std::size_t i = 0; i < vector_size; i++) {
+        ComplexT sum{0.0, 0.0};
+        for (auto k = static_cast<std::size_t>(row_map_ptr[i]);
+             k < static_cast<std::size_t>(row_map_ptr[i + 1]); k++) {
+            const auto j = static_cast<std::size_t>(entries_ptr[k]);
+            sum += values_ptr[k] * vector_ptr[j];
+            if (j != i) {
+                result_ptr[j] += std::conj(values_ptr[k]) * vector_ptr[i];
+            }
+        }
+        result_ptr[i] += sum;
+    }
+}
+
+/**
+ * @brief Expected value `<v|H|v>` of a Hermitian sparse matrix in CSR format,
+ * without storing `H|v>`.
+ *
+ * @tparam PrecisionT Floating point precision of the vector.
+ * @tparam ValueT Type of the non-zero elements, real or complex.
+ * @tparam RowIdxT Integer type of the row map.
+ * @tparam ColIdxT Integer type of the column indices.
+ * @param vector_ptr Pointer to the vector.
+ * @param vector_size Size of the vector, which is the number of rows.
+ * @param row_map_ptr Pointer to the row map of `vector_size + 1` elements.
+ * @param entries_ptr Pointer to the column indices of the non-zero elements.
+ * @param values_ptr Pointer to the non-zero elements.
+ * @param upper_triangle Whether only the upper triangle is stored.
+ * @return Expected value.
+ */
+template <class PrecisionT, class ValueT, class RowIdxT, class ColIdxT>
+auto sparseExpval(const std::complex<PrecisionT> *vector_ptr,
+                  std::size_t vector_size, const RowIdxT *row_map_ptr,
+                  const ColIdxT *entries_ptr, const ValueT *values_ptr,
+                  bool upper_triangle = false) -> PrecisionT {
+    PrecisionT result{0.0};
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for default(none)                                 \
+            shared(vector_ptr, vector_size, row_map_ptr, entries_ptr,          \
+                   values_ptr, upper_triangle)                                 \
+            reduction(+ : result)                                              \
+            if (vector_size >= Internal::sparse_omp_threshold)
+    #endif
+    // clang-format on
+    for (std::size_t i = 0; i < vector_size; i++) {
+        std::complex<PrecisionT> sum{0.0, 0.0};
+        for (auto k = static_cast<std::size_t>(row_map_ptr[i]);
+             k < static_cast<std::size_t>(row_map_ptr[i + 1]); k++) {
+            const auto j = static_cast<std::size_t>(entries_ptr[k]);
+            // The entry below the diagonal adds the conjugate term
+            const PrecisionT weight = (upper_triangle && j != i) ? 2 : 1;
+            sum += weight * values_ptr[k] * vector_ptr[j];
+        }
+        result += std::real(std::conj(vector_ptr[i]) * sum);
+    }
+    return result;
+}
+
+/**
+ * @brief Square sparse matrix in CSR format with compact storage.
+ *
+ * Column indices are stored on 32 bits when the dimension allows, and the
+ * non-zero elements are stored as real numbers when none of them has an
+ * imaginary part. A Hermitian matrix can also keep only its entries on or
+ * above the diagonal.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT> class CompactCSRMatrix {
+  public:
+    using ComplexT = std::complex<PrecisionT>;
+
+  private:
+    std::size_t num_rows_{0};
+    bool upper_triangle_{false};
+    bool real_values_{false};
+    bool compact_indices_{false};
+    std::vector<std::size_t> row_map_;
+    std::vector<std::uint32_t> indices32_;
+    std::vector<std::size_t> indices64_;
+    std::vector<PrecisionT> values_re_;
+    std::vector<ComplexT> values_;
+
+    /**
+     * @brief Call a function with pointers to the stored non-zero elements
+     * and column indices.
+     */
+    template <class FuncT> decltype(auto) dispatch(FuncT &&func) const {
+        if (real_values_) {
+            return compact_indices_
+                       ? func(values_re_.data(), indices32_.data())
+                       : func(values_re_.data(), indices64_.data());
+        }
+        return compact_indices_ ? func(values_.data(), indices32_.data())
+                                : func(values_.data(), indices64_.data());
+    }
+
+  public:
+    CompactCSRMatrix() = default;
+
+    /**
+     * @brief Create a compact matrix from CSR data.
+     *
+     * @tparam ColIdxT Integer type of the column indices.
+     * @tparam RowIdxT Integer type of the row map.
+     * @param values_ptr Pointer to the non-zero elements.
+     * @param entries_ptr Pointer to the column indices of the non-zero
+     * elements.
+     * @param num_nnz Number of non-zero elements.
+     * @param row_map_ptr Pointer to the row map.
+     * @param row_map_size Size of the row map, the number of rows plus one.
+     * @param upper_triangle Keep only the entries of a Hermitian matrix on or
+     * above the diagonal.
+     */
+    template <class ColIdxT, class RowIdxT>
+    CompactCSRMatrix(const ComplexT *values_ptr, const ColIdxT *entries_ptr,
+                     std::size_t num_nnz, const RowIdxT *row_map_ptr,
+                     std::size_t row_map_size, bool upper_triangle = false)
+        : num_rows_{row_map_size - 1}, upper_triangle_{upper_triangle},
+          real_values_{true},
+          compact_indices_{row_map_size - 1 <=
+                           std::numeric_limits<std::uint32_t>::max()},
+          row_map_(row_map_size, 0) {
+        PL_ABORT_IF(row_map_size == 0, "The row map must not be empty.");
+        PL_ABORT_IF_NOT(static_cast<std::size_t>(row_map_ptr[num_rows_]) ==
+                            num_nnz,
+                        "The row map does not match with the number of "
+                        "non-zero elements.");
+
+        for (std::size_t i = 0; i < num_rows_; i++) {
+            std::size_t kept = 0;
+            for (auto k = static_cast<std::size_t>(row_map_ptr[i]);
+                 k < static_cast<std::size_t>(row_map_ptr[i + 1]); k++) {
+                const auto j = static_cast<std::size_t>(entries_ptr[k]);
+                PL_ABORT_IF_NOT(j < num_rows_,
+                                "A column index is out of range.");
+                if (!upper_triangle || j >= i) {
+                    kept++;
+                    real_values_ = real_values_ && values_ptr[k].imag() == 0;
+                }
+            }
+            row_map_[i + 1] = row_map_[i] + kept;
+        }
+
+        const std::size_t nnz = row_map_[num_rows_];
+        if (real_values_) {
+            values_re_.reserve(nnz);
+        } else {
+            values_.reserve(nnz);
+        }
+        if (compact_indices_) {
+            indices32_.reserve(nnz);
+        } else {
+            indices64_.reserve(nnz);
+        }
+        for (std::size_t i = 0; i < num_rows_; i++) {
+            for (auto k = static_cast<std::size_t>(row_map_ptr[i]);
+                 k < static_cast<std::size_t>(row_map_ptr[i + 1]); k++) {
+                const auto j = static_cast<std::size_t>(entries_ptr[k]);
+                if (upper_triangle && j < i) {
+                    continue;
+                }
+                if (real_values_) {
+                    values_re_.push_back(values_ptr[k].real());
+                } else {
+                    values_.push_back(values_ptr[k]);
+                }
+                if (compact_indices_) {
+                    indices32_.push_back(static_cast<std::uint32_t>(j));
+                } else {
+                    indices64_.push_back(j);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] auto numRows() const -> std::size_t { return num_rows_; }
+
+    /**
+     * @brief Number of stored non-zero elements.
+     */
+    [[nodiscard]] auto numNonZeros() const -> std::size_t {
+        return row_map_.empty() ? 0 : row_map_.back();
+    }
+
+    [[nodiscard]] auto isUpperTriangle() const -> bool {
+        return upper_triangle_;
+    }
+    [[nodiscard]] auto hasRealValues() const -> bool { return real_values_; }
+    [[nodiscard]] auto hasCompactIndices() const -> bool {
+        return compact_indices_;
+    }
+
+    [[nodiscard]] auto getRowMap() const -> const std::vector<std::size_t> & {
+        return row_map_;
+    }
+
+    /**
+     * @brief Column index of the `k`-th stored element.
+     */
+    [[nodiscard]] auto getColumn(std::size_t k) const -> std::size_t {
+        return compact_indices_ ? std::size_t{indices32_[k]} : indices64_[k];
+    }
+
+    /**
+     * @brief Value of the `k`-th stored element.
+     */
+    [[nodiscard]] auto getValue(std::size_t k) const -> ComplexT {
+        return real_values_ ? ComplexT{values_re_[k], 0.0} : values_[k];
+    }
+
+    /**
+     * @brief Apply the matrix to a vector.
+     *
+     * @param vector_ptr Pointer to the vector of `numRows()` elements.
+     * @param result_ptr Pointer to the result of `numRows()` elements.
+     */
+    void apply(const ComplexT *vector_ptr, ComplexT *result_ptr) const {
+        dispatch([&](const auto *values_ptr, const auto *entries_ptr) {
+            sparseMatrixVector(vector_ptr, num_rows_, row_map_.data(),
+                               entries_ptr, values_ptr, result_ptr,
+                               upper_triangle_);
+        });
+    }
+
+    /**
+     * @brief Expected value of the matrix, which must be Hermitian.
+     *
+     * @param vector_ptr Pointer to the vector of `numRows()` elements.
+     */
+    [[nodiscard]] auto expval(const ComplexT *vector_ptr) const -> PrecisionT {
+        return dispatch([&](const auto *values_ptr, const auto *entries_ptr) {
+            return sparseExpval(vector_ptr, num_rows_, row_map_.data(),
+                                entries_ptr, values_ptr, upper_triangle_);
+        });
+    }
+
+    bool operator==(const CompactCSRMatrix &other) const = default;
+};
 } // namespace Pennylane::LightningQubit::Util
@@ -20,6 +20,9 @@
 #include "CPUMemoryModel.hpp"
 #include "Macros.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
 
 #if defined(PL_USE_OMP)
@@ -69,4 +72,89 @@ inline auto bestThreading() -> Threading {
     return Threading::SingleThread;
 }
 
+/**
+ * @brief Maximal number of threads available to a parallel region.
+ *
+ * @return Number of threads
+ */
+inline auto maxThreads() -> size_t {
+#ifdef PL_USE_OMP
+    return static_cast<size_t>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
+/**
+ * @brief Split of the available threads between independent statevectors
+ * and amplitude chunks of each statevector.
+ */
+struct ThreadPartition {
+    /// Number of statevectors processed concurrently.
+    size_t state_threads;
+    /// Number of threads working on the amplitudes of one statevector.
+    size_t amplitude_threads;
+    /// Number of leading qubits over which each statevector is split.
+    size_t chunk_qubits;
+};
+
+/**
+ * @brief Choose how to split threads between statevector-level and
+ * amplitude-level work.
+ *
+ * Threads are first given to independent statevectors. When there are more
+ * threads than statevectors, each statevector is split into
+ * `2^chunk_qubits` contiguous chunks over its leading qubits, as long as a
+ * chunk keeps at least `min_chunk_qubits` qubits.
+ *
+ * @param num_states Number of independent statevectors.
+ * @param num_qubits Number of qubits of each statevector.
+ * @param num_threads Number of available threads.
+ * @param min_chunk_qubits Minimal number of qubits of a chunk.
+ * @return ThreadPartition
+ */
+inline auto partitionThreads(size_t num_states, size_t num_qubits,
+                             size_t num_threads, size_t min_chunk_qubits)
+    -> ThreadPartition {
+    num_threads = std::max<size_t>(num_threads, 1);
+    const size_t state_threads =
+        std::clamp<size_t>(num_states, 1, num_threads);
+    const size_t spare_threads = num_threads / state_threads;
+    if (spare_threads < 2 || num_qubits <= min_chunk_qubits) {
+        return {state_threads, 1, 0};
+    }
+    const auto chunk_qubits = std::min<size_t>(
+        std::bit_width(spare_threads - 1), num_qubits - min_chunk_qubits);
+    return {state_threads,
+            std::min<size_t>(spare_threads, size_t{1} << chunk_qubits),
+            chunk_qubits};
+}
+
+/**
+ * @brief Choose the number of segments of a time-parallel backward pass.
+ *
+ * Segments are only used when a sequential backward pass would leave at
+ * least half of the threads idle. Every segment but the first keeps a copy
+ * of the backward states at its boundary, which must fit in the memory
+ * budget.
+ *
+ * @param num_threads Number of available threads.
+ * @param busy_threads Number of threads used by a sequential backward pass.
+ * @param num_trainable Number of trainable operations.
+ * @param segment_bytes Memory of the backward states of one segment.
+ * @param memory_budget Memory available for the boundary states.
+ * @return Number of segments, 1 for a sequential backward pass.
+ */
+inline auto numSegments(size_t num_threads, size_t busy_threads,
+                        size_t num_trainable, size_t segment_bytes,
+                        size_t memory_budget) -> size_t {
+    if (num_threads < 2 * busy_threads || num_trainable < 2) {
+        return 1;
+    }
+    const size_t max_copies = (segment_bytes == 0)
+                                  ? num_trainable
+                                  : memory_budget / segment_bytes;
+    return std::min({num_threads, num_trainable, max_copies + 1});
+}
+
 } // namespace Pennylane::LightningQubit::Util
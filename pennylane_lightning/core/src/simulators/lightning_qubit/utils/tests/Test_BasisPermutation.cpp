@@ -0,0 +1,72 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+// http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "BasisPermutation.hpp"
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::LightningQubit::Util;
+} // namespace
+/// @endcond
+
+TEST_CASE("Test permutationCycles", "[Util][Permutation]") {
+    SECTION("Identity has no cycles") {
+        const auto cycles = permutationCycles({0, 1, 2, 3});
+        REQUIRE(cycles.numCycles() == 0);
+        REQUIRE(cycles.elements.empty());
+    }
+    SECTION("Cycles skip fixed points") {
+        // 0 -> 3 -> 5 -> 0, 1 -> 4 -> 1, 2 and 6 are fixed
+        const auto cycles = permutationCycles({3, 4, 2, 5, 1, 0, 6});
+        REQUIRE(cycles.numCycles() == 2);
+        REQUIRE(cycles.elements == std::vector<size_t>{0, 3, 5, 1, 4});
+        REQUIRE(cycles.offsets == std::vector<size_t>{0, 3, 5});
+    }
+    SECTION("Invalid tables") {
+        REQUIRE_THROWS_WITH(permutationCycles({1, 1, 2}),
+                            Catch::Contains("The table is not a permutation"));
+        REQUIRE_THROWS_WITH(permutationCycles({0, 3, 1}),
+                            Catch::Contains("The table is not a permutation"));
+    }
+}
+
+TEST_CASE("Test permutation tables", "[Util][Permutation]") {
+    SECTION("oracleTable") {
+        REQUIRE(oracleTable({1, 0}, 1) == std::vector<size_t>{1, 0, 2, 3});
+        REQUIRE(oracleTable({2, 3}, 2) ==
+                std::vector<size_t>{2, 3, 0, 1, 7, 6, 5, 4});
+        REQUIRE_THROWS_WITH(oracleTable({0, 2}, 1),
+                            Catch::Contains("must fit in the output wires"));
+    }
+    SECTION("modularAddTable") {
+        REQUIRE(modularAddTable(2, 3) == std::vector<size_t>{3, 0, 1, 2});
+        REQUIRE(modularAddTable(2, 6) == std::vector<size_t>{2, 3, 0, 1});
+    }
+    SECTION("modularMultiplyTable") {
+        REQUIRE(modularMultiplyTable(3, 2, 5) ==
+                std::vector<size_t>{0, 2, 4, 1, 3, 5, 6, 7});
+        REQUIRE(modularMultiplyTable(2, 3, 4) ==
+                std::vector<size_t>{0, 3, 2, 1});
+        REQUIRE_THROWS_WITH(modularMultiplyTable(3, 2, 4),
+                            Catch::Contains("must be coprime to the modulus"));
+        REQUIRE_THROWS_WITH(modularMultiplyTable(3, 1, 9),
+                            Catch::Contains("The modulus must be between"));
+        REQUIRE_THROWS_WITH(modularMultiplyTable(3, 1, 0),
+                            Catch::Contains("The modulus must be between"));
+    }
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 #include <algorithm>
 #include <complex>
+#include <random>
 #include <vector>
 
 #include <catch2/catch.hpp>
@@ -823,6 +824,40 @@ TEMPLATE_TEST_CASE("Util::scaleAndAdd", "[Util][LinearAlgebra]", float,
     }
 }
 
+TEMPLATE_TEST_CASE("Util::multiScaleAndAdd", "[Util][LinearAlgebra]", float,
+                   double) {
+    using PrecisionT = TestType;
+    using ComplexT = std::complex<PrecisionT>;
+    std::mt19937 re{1337};
+
+    const std::vector<ComplexT> a{{0.5, 0.2}, {-1.0, 0.3}, {0.25, -0.7}};
+
+    std::uniform_real_distribution<PrecisionT> dist(-1.0, 1.0);
+
+    for (size_t dim : {size_t{5}, size_t{64}, size_t{100}}) {
+        std::vector<std::vector<ComplexT>> x(a.size(),
+                                             std::vector<ComplexT>(dim));
+        for (auto &x_k : x) {
+            std::generate(x_k.begin(), x_k.end(), [&] {
+                return ComplexT{dist(re), dist(re)};
+            });
+        }
+        std::vector<ComplexT> y(dim, ComplexT{0.3, 0.4});
+
+        std::vector<ComplexT> expected = y;
+        for (size_t k = 0; k < a.size(); k++) {
+            Util::scaleAndAdd(a[k], x[k], expected);
+        }
+
+        const std::vector<const ComplexT *> x_ptrs{x[0].data(), x[1].data(),
+                                                   x[2].data()};
+        // Blocks of 16 elements and the OpenMP path above 32 elements
+        Util::multiScaleAndAdd<PrecisionT, 16, 32>(dim, a.size(), a.data(),
+                                                   x_ptrs.data(), y.data());
+        REQUIRE(y == approx(expected));
+    }
+}
+
 /**
  * @brief Test randomUnitary is correct
  */
@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include <complex>
+#include <cstdint>
 #include <cstdio>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -81,4 +83,157 @@ TEMPLATE_TEST_CASE("apply_Sparse_Matrix", "[Sparse]", float, double) {
             REQUIRE(result_refs[vec] == approx(result).margin(1e-6));
         };
     }
-}
\ No newline at end of file
+}
+/**
+ * @brief Random Hermitian matrix with about a quarter of non-zero elements,
+ * in CSR format.
+ */
+template <class PrecisionT>
+void writeHermitianCSR(std::mt19937 &re, size_t dim, bool real,
+                       std::vector<size_t> &row_map,
+                       std::vector<size_t> &entries,
+                       std::vector<complex<PrecisionT>> &values) {
+    std::uniform_real_distribution<PrecisionT> dist(-1.0, 1.0);
+    std::vector<complex<PrecisionT>> dense(dim * dim);
+    for (size_t i = 0; i < dim; i++) {
+        dense[i * dim + i] = dist(re);
+        for (size_t j = i + 1; j < dim; j++) {
+            if (dist(re) < -0.5) {
+                const complex<PrecisionT> value{dist(re),
+                                                real ? 0 : dist(re)};
+                dense[i * dim + j] = value;
+                dense[j * dim + i] = std::conj(value);
+            }
+        }
+    }
+    row_map.assign(1, 0);
+    entries.clear();
+    values.clear();
+    for (size_t i = 0; i < dim; i++) {
+        for (size_t j = 0; j < dim; j++) {
+            if (dense[i * dim + j] != complex<PrecisionT>{0.0, 0.0}) {
+                entries.push_back(j);
+                values.push_back(dense[i * dim + j]);
+            }
+        }
+        row_map.push_back(entries.size());
+    }
+}
+
+TEMPLATE_TEST_CASE("CompactCSRMatrix", "[Sparse]", float, double) {
+    using ComplexT = complex<TestType>;
+    std::mt19937 re{1337};
+    const size_t dim = 64;
+
+    for (const bool real : {true, false}) {
+        DYNAMIC_SECTION("Random Hermitian matrix - real = " << real) {
+            std::vector<size_t> row_map;
+            std::vector<size_t> entries;
+            std::vector<ComplexT> values;
+            writeHermitianCSR(re, dim, real, row_map, entries, values);
+
+            std::vector<ComplexT> vector(dim);
+            std::uniform_real_distribution<TestType> dist(-1.0, 1.0);
+            for (auto &v : vector) {
+                v = {dist(re), dist(re)};
+            }
+            const auto expected = apply_Sparse_Matrix(
+                vector.data(), dim, row_map.data(), row_map.size(),
+                entries.data(), values.data(), values.size());
+            TestType expected_expval = 0.0;
+            for (size_t i = 0; i < dim; i++) {
+                expected_expval +=
+                    std::real(std::conj(vector[i]) * expected[i]);
+            }
+
+            const CompactCSRMatrix<TestType> full(
+                values.data(), entries.data(), values.size(), row_map.data(),
+                row_map.size());
+            const CompactCSRMatrix<TestType> upper(
+                values.data(), entries.data(), values.size(), row_map.data(),
+                row_map.size(), true);
+
+            REQUIRE(full.numRows() == dim);
+            REQUIRE(full.numNonZeros() == values.size());
+            REQUIRE(full.hasCompactIndices());
+            REQUIRE(full.hasRealValues() == real);
+            REQUIRE(!full.isUpperTriangle());
+            REQUIRE(upper.isUpperTriangle());
+            // The diagonal is dense, so the upper triangle keeps it
+            REQUIRE(2 * upper.numNonZeros() == values.size() + dim);
+            REQUIRE(!(full == upper));
+
+            for (const auto *matrix : {&full, &upper}) {
+                std::vector<ComplexT> result(dim);
+                matrix->apply(vector.data(), result.data());
+                CHECK(result == approx(expected).margin(1e-5));
+                CHECK(matrix->expval(vector.data()) ==
+                      Approx(expected_expval).margin(1e-4));
+            }
+
+            // Column indices of another type give the same matrix
+            const std::vector<int32_t> entries32(entries.begin(),
+                                                 entries.end());
+            REQUIRE(CompactCSRMatrix<TestType>(
+                        values.data(), entries32.data(), values.size(),
+                        row_map.data(), row_map.size(), true) == upper);
+            CHECK(sparseExpval(vector.data(), dim, row_map.data(),
+                               entries32.data(), values.data()) ==
+                  Approx(expected_expval).margin(1e-4));
+        }
+    }
+
+    SECTION("Large matrix") {
+        const size_t large_dim = size_t{1} << 13U;
+        std::vector<size_t> row_map;
+        std::vector<size_t> entries;
+        std::vector<ComplexT> values;
+        write_CSR_vectors(row_map, entries, values, large_dim);
+
+        std::vector<ComplexT> vector(large_dim);
+        std::uniform_real_distribution<TestType> dist(-1.0, 1.0);
+        for (auto &v : vector) {
+            v = {dist(re), dist(re)};
+        }
+        const auto expected = apply_Sparse_Matrix(
+            vector.data(), large_dim, row_map.data(), row_map.size(),
+            entries.data(), values.data(), values.size());
+
+        for (const bool upper_triangle : {false, true}) {
+            const CompactCSRMatrix<TestType> matrix(
+                values.data(), entries.data(), values.size(), row_map.data(),
+                row_map.size(), upper_triangle);
+            REQUIRE(matrix.hasRealValues());
+
+            std::vector<ComplexT> result(large_dim);
+            matrix.apply(vector.data(), result.data());
+            CHECK(result == approx(expected).margin(1e-5));
+
+            // <v|H|v> is the inner product of v and Hv
+            ComplexT expected_expval{0.0, 0.0};
+            for (size_t i = 0; i < large_dim; i++) {
+                expected_expval += std::conj(vector[i]) * expected[i];
+            }
+            CHECK(matrix.expval(vector.data()) ==
+                  Approx(std::real(expected_expval)).epsilon(1e-4));
+        }
+    }
+
+    SECTION("Invalid CSR data") {
+        const std::vector<ComplexT> values{1.0, 1.0};
+        const std::vector<size_t> entries{0, 2};
+        const std::vector<size_t> row_map{0, 1, 2};
+        REQUIRE_THROWS_WITH(
+            CompactCSRMatrix<TestType>(values.data(), entries.data(), 2,
+                                       row_map.data(), row_map.size()),
+            Catch::Contains("A column index is out of range."));
+        REQUIRE_THROWS_WITH(
+            CompactCSRMatrix<TestType>(values.data(), entries.data(), 1,
+                                       row_map.data(), row_map.size()),
+            Catch::Contains("The row map does not match"));
+        REQUIRE_THROWS_WITH(
+            CompactCSRMatrix<TestType>(values.data(), entries.data(), 0,
+                                       row_map.data(), 0),
+            Catch::Contains("The row map must not be empty."));
+    }
+}
@@ -0,0 +1,509 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines the binary circuit format, a flat serialization of a list of
+ * operations and observables which is read in place.
+ *
+ * A binary circuit is a little-endian byte buffer made of a
+ * `BinaryCircuitHeader`, a table of `BinaryCircuitSection` entries and the
+ * arrays of the sections, each aligned to 8 bytes. Operations and the factors
+ * of the observables are both "items": item `i < num_ops` is operation `i`,
+ * and item `num_ops + f` is factor `f`. Each item has a name, wires and an
+ * optional row-major matrix, and operations also have parameters. An
+ * observable is a linear combination of terms, and a term is a tensor product
+ * of factors.
+ */
+#pragma once
+
+#include <array>
+#include <bit>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Error.hpp"
+
+namespace Pennylane::Util {
+/// Magic number at the start of a binary circuit.
+inline constexpr std::array<char, 4> binary_circuit_magic{'P', 'L', 'B', 'C'};
+/// Readers accept any binary circuit with the same major version.
+inline constexpr uint16_t binary_circuit_version_major = 1;
+/// Minor versions only append sections.
+inline constexpr uint16_t binary_circuit_version_minor = 0;
+/// Flag of the inverse operations in `BinarySection::ItemNames`.
+inline constexpr uint32_t binary_circuit_inverse_flag = uint32_t{1} << 31U;
+
+/**
+ * @brief Sections of a binary circuit, in the order of the section table.
+ */
+enum class BinarySection : uint32_t {
+    /// uint32[num_names + 1]: offsets of the names in `Names`
+    NameOffsets,
+    /// char[]: names, without separators
+    Names,
+    /// uint32[num_items]: index of the name, with `binary_circuit_inverse_flag`
+    ItemNames,
+    /// uint32[num_items + 1]: offsets of the wires of the items in `Wires`
+    WireOffsets,
+    /// uint32[]: wires
+    Wires,
+    /// uint32[num_ops + 1]: offsets of the parameters of the operations
+    ParamOffsets,
+    /// double[]: parameters
+    Params,
+    /// uint32[num_items + 1]: offsets of the matrices in `Matrices`
+    MatrixOffsets,
+    /// complex<double>[]: matrices, as interleaved pairs of doubles
+    Matrices,
+    /// uint32[num_observables + 1]: offsets of the terms in `Coeffs`
+    ObservableOffsets,
+    /// double[num_terms]: coefficients of the terms
+    Coeffs,
+    /// uint32[num_terms + 1]: offsets of the factors of the terms
+    TermOffsets,
+    /// Number of sections
+    Count
+};
+
+/**
+ * @brief Fixed-size header of a binary circuit.
+ */
+struct BinaryCircuitHeader {
+    std::array<char, 4> magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    uint32_t num_qubits;
+    uint32_t num_ops;
+    uint32_t num_observables;
+    uint32_t num_terms;
+    uint32_t num_factors;
+    uint32_t num_sections;
+    /// Size of the binary circuit in bytes
+    uint64_t size;
+};
+
+/**
+ * @brief Entry of the section table.
+ */
+struct BinaryCircuitSection {
+    /// Offset of the section from the start of the buffer, in bytes
+    uint64_t offset;
+    /// Number of elements of the section
+    uint64_t count;
+};
+
+static_assert(sizeof(BinaryCircuitHeader) == 40);
+static_assert(sizeof(BinaryCircuitSection) == 16);
+static_assert(sizeof(std::complex<double>) == 2 * sizeof(double));
+
+/**
+ * @brief Read-only view of a binary circuit.
+ *
+ * The constructor checks the header and that every offset stays within its
+ * section, so accessors do not copy or parse anything. The buffer, e.g. a
+ * memory-mapped file, must outlive the view and be aligned to 8 bytes.
+ */
+class BinaryCircuitView {
+  private:
+    std::span<const std::byte> buffer_;
+    BinaryCircuitHeader header_{};
+
+    std::span<const uint32_t> name_offsets_;
+    std::span<const char> names_;
+    std::span<const uint32_t> item_names_;
+    std::span<const uint32_t> wire_offsets_;
+    std::span<const uint32_t> wires_;
+    std::span<const uint32_t> param_offsets_;
+    std::span<const double> params_;
+    std::span<const uint32_t> matrix_offsets_;
+    std::span<const std::complex<double>> matrices_;
+    std::span<const uint32_t> observable_offsets_;
+    std::span<const double> coeffs_;
+    std::span<const uint32_t> term_offsets_;
+
+    template <class T>
+    [[nodiscard]] auto section(BinarySection sec) const
+        -> std::span<const T> {
+        BinaryCircuitSection entry{};
+        std::memcpy(&entry,
+                    buffer_.data() + sizeof(BinaryCircuitHeader) +
+                        static_cast<size_t>(sec) * sizeof(BinaryCircuitSection),
+                    sizeof(BinaryCircuitSection));
+        const auto count = entry.count;
+        PL_ABORT_IF(entry.offset % alignof(T) != 0 ||
+                        entry.offset > buffer_.size() ||
+                        count > (buffer_.size() - entry.offset) / sizeof(T),
+                    "A section of the binary circuit is out of range.");
+        // The arrays are read in place, as for a memory-mapped file
+        return {reinterpret_cast<const T *>(buffer_.data() + entry.offset),
+                static_cast<size_t>(count)};
+    }
+
+    static void checkOffsets(std::span<const uint32_t> offsets, size_t length,
+                             size_t target_size) {
+        PL_ABORT_IF_NOT(offsets.size() == length + 1 && offsets[0] == 0 &&
+                            offsets[length] == target_size,
+                        "The offsets of the binary circuit are invalid.");
+        for (size_t i = 0; i < length; i++) {
+            PL_ABORT_IF(offsets[i] > offsets[i + 1],
+                        "The offsets of the binary circuit are invalid.");
+        }
+    }
+
+  public:
+    explicit BinaryCircuitView(std::span<const std::byte> buffer)
+        : buffer_{buffer} {
+        PL_ABORT_IF_NOT(std::endian::native == std::endian::little,
+                        "Binary circuits require a little-endian host.");
+        PL_ABORT_IF(buffer_.size() < sizeof(BinaryCircuitHeader),
+                    "The binary circuit is truncated.");
+        PL_ABORT_IF(reinterpret_cast<std::uintptr_t>(buffer_.data()) %
+                            alignof(uint64_t) !=
+                        0,
+                    "The binary circuit must be aligned to 8 bytes.");
+        std::memcpy(&header_, buffer_.data(), sizeof(BinaryCircuitHeader));
+        PL_ABORT_IF_NOT(header_.magic == binary_circuit_magic,
+                        "The buffer is not a binary circuit.");
+        PL_ABORT_IF_NOT(header_.version_major == binary_circuit_version_major,
+                        "Unsupported version of the binary circuit format.");
+        PL_ABORT_IF(header_.size > buffer_.size() ||
+                        header_.size < sizeof(BinaryCircuitHeader) ||
+                        header_.num_sections <
+                            static_cast<uint32_t>(BinarySection::Count) ||
+                        header_.num_sections >
+                            (header_.size - sizeof(BinaryCircuitHeader)) /
+                                sizeof(BinaryCircuitSection),
+                    "The binary circuit is truncated.");
+        buffer_ = buffer_.first(header_.size);
+
+        using enum BinarySection;
+        name_offsets_ = section<uint32_t>(NameOffsets);
+        names_ = section<char>(Names);
+        item_names_ = section<uint32_t>(ItemNames);
+        wire_offsets_ = section<uint32_t>(WireOffsets);
+        wires_ = section<uint32_t>(Wires);
+        param_offsets_ = section<uint32_t>(ParamOffsets);
+        params_ = section<double>(Params);
+        matrix_offsets_ = section<uint32_t>(MatrixOffsets);
+        matrices_ = section<std::complex<double>>(Matrices);
+        observable_offsets_ = section<uint32_t>(ObservableOffsets);
+        coeffs_ = section<double>(Coeffs);
+        term_offsets_ = section<uint32_t>(TermOffsets);
+
+        PL_ABORT_IF(name_offsets_.empty(),
+                    "The offsets of the binary circuit are invalid.");
+        const size_t num_items = numItems();
+        checkOffsets(name_offsets_, numNames(), names_.size());
+        checkOffsets(wire_offsets_, num_items, wires_.size());
+        checkOffsets(param_offsets_, numOperations(), params_.size());
+        checkOffsets(matrix_offsets_, num_items, matrices_.size());
+        checkOffsets(observable_offsets_, numObservables(), coeffs_.size());
+        checkOffsets(term_offsets_, coeffs_.size(), header_.num_factors);
+        PL_ABORT_IF_NOT(item_names_.size() == num_items &&
+                            coeffs_.size() == header_.num_terms,
+                        "The sections of the binary circuit do not match with "
+                        "its header.");
+
+        for (size_t i = 0; i < num_items; i++) {
+            PL_ABORT_IF_NOT((item_names_[i] & ~binary_circuit_inverse_flag) <
+                                numNames(),
+                            "A name index of the binary circuit is invalid.");
+            const size_t num_matrix =
+                matrix_offsets_[i + 1] - matrix_offsets_[i];
+            const size_t num_wires = wire_offsets_[i + 1] - wire_offsets_[i];
+            PL_ABORT_IF_NOT(num_matrix == 0 ||
+                                (num_wires < 16 &&
+                                 num_matrix == size_t{1} << (2 * num_wires)),
+                            "A matrix of the binary circuit does not match "
+                            "with its wires.");
+        }
+        for (const auto wire : wires_) {
+            PL_ABORT_IF_NOT(wire < header_.num_qubits,
+                            "A wire of the binary circuit is out of range.");
+        }
+    }
+
+    [[nodiscard]] auto getHeader() const -> const BinaryCircuitHeader & {
+        return header_;
+    }
+    [[nodiscard]] auto getNumQubits() const -> size_t {
+        return header_.num_qubits;
+    }
+    [[nodiscard]] auto numOperations() const -> size_t {
+        return header_.num_ops;
+    }
+    [[nodiscard]] auto numObservables() const -> size_t {
+        return header_.num_observables;
+    }
+    /// Number of parameters of all operations
+    [[nodiscard]] auto numParams() const -> size_t { return params_.size(); }
+    [[nodiscard]] auto numNames() const -> size_t {
+        return name_offsets_.size() - 1;
+    }
+    /// Number of operations and factors
+    [[nodiscard]] auto numItems() const -> size_t {
+        return size_t{header_.num_ops} + header_.num_factors;
+    }
+
+    [[nodiscard]] auto getName(size_t name_idx) const -> std::string_view {
+        return {names_.data() + name_offsets_[name_idx],
+                name_offsets_[name_idx + 1] - name_offsets_[name_idx]};
+    }
+    [[nodiscard]] auto itemNameIndex(size_t item) const -> size_t {
+        return item_names_[item] & ~binary_circuit_inverse_flag;
+    }
+    [[nodiscard]] auto itemName(size_t item) const -> std::string_view {
+        return getName(itemNameIndex(item));
+    }
+    [[nodiscard]] auto itemWires(size_t item) const
+        -> std::span<const uint32_t> {
+        return wires_.subspan(wire_offsets_[item],
+                              wire_offsets_[item + 1] - wire_offsets_[item]);
+    }
+    [[nodiscard]] auto itemMatrix(size_t item) const
+        -> std::span<const std::complex<double>> {
+        return matrices_.subspan(matrix_offsets_[item],
+                                 matrix_offsets_[item + 1] -
+                                     matrix_offsets_[item]);
+    }
+
+    [[nodiscard]] auto isInverse(size_t op) const -> bool {
+        return (item_names_[op] & binary_circuit_inverse_flag) != 0;
+    }
+    [[nodiscard]] auto opParams(size_t op) const -> std::span<const double> {
+        return params_.subspan(param_offsets_[op],
+                               param_offsets_[op + 1] - param_offsets_[op]);
+    }
+
+    /// Indices of the first and past-the-last terms of an observable
+    [[nodiscard]] auto observableTerms(size_t obs) const
+        -> std::pair<size_t, size_t> {
+        return {observable_offsets_[obs], observable_offsets_[obs + 1]};
+    }
+    [[nodiscard]] auto termCoeff(size_t term) const -> double {
+        return coeffs_[term];
+    }
+    /// Items of the first and past-the-last factors of a term
+    [[nodiscard]] auto termFactors(size_t term) const
+        -> std::pair<size_t, size_t> {
+        return {header_.num_ops + term_offsets_[term],
+                header_.num_ops + term_offsets_[term + 1]};
+    }
+};
+
+/**
+ * @brief Factor of an observable term added to a `BinaryCircuitBuilder`.
+ */
+struct BinaryFactor {
+    std::string name;
+    std::vector<size_t> wires;
+    /// Row-major matrix, e.g. of a `Hermitian` observable
+    std::vector<std::complex<double>> matrix{};
+};
+
+/**
+ * @brief Writer of binary circuits.
+ */
+class BinaryCircuitBuilder {
+  private:
+    size_t num_qubits_;
+    std::unordered_map<std::string, uint32_t> name_indices_;
+    std::vector<uint32_t> name_offsets_{0};
+    std::vector<char> names_;
+    std::vector<uint32_t> op_names_;
+    std::vector<uint32_t> factor_names_;
+    std::vector<std::vector<uint32_t>> op_wires_;
+    std::vector<std::vector<uint32_t>> factor_wires_;
+    std::vector<uint32_t> param_offsets_{0};
+    std::vector<double> params_;
+    std::vector<std::vector<std::complex<double>>> op_matrices_;
+    std::vector<std::vector<std::complex<double>>> factor_matrices_;
+    std::vector<uint32_t> observable_offsets_{0};
+    std::vector<double> coeffs_;
+    std::vector<uint32_t> term_offsets_{0};
+
+    auto nameIndex(const std::string &name) -> uint32_t {
+        const auto [iter, inserted] = name_indices_.try_emplace(
+            name, static_cast<uint32_t>(name_indices_.size()));
+        if (inserted) {
+            names_.insert(names_.end(), name.begin(), name.end());
+            name_offsets_.push_back(static_cast<uint32_t>(names_.size()));
+        }
+        return iter->second;
+    }
+
+    auto toWires(const std::vector<size_t> &wires) const
+        -> std::vector<uint32_t> {
+        std::vector<uint32_t> result;
+        result.reserve(wires.size());
+        for (const auto wire : wires) {
+            PL_ABORT_IF_NOT(wire < num_qubits_, "Invalid wire index.");
+            result.push_back(static_cast<uint32_t>(wire));
+        }
+        return result;
+    }
+
+  public:
+    explicit BinaryCircuitBuilder(size_t num_qubits)
+        : num_qubits_{num_qubits} {}
+
+    /**
+     * @brief Append an operation.
+     *
+     * @param name Name of the operation.
+     * @param wires Wires of the operation.
+     * @param params Parameters of the operation.
+     * @param inverse Whether to apply the inverse of the operation.
+     * @param matrix Row-major matrix, for operations without a gate kernel.
+     */
+    void addOperation(const std::string &name,
+                      const std::vector<size_t> &wires,
+                      const std::vector<double> &params = {},
+                      bool inverse = false,
+                      std::vector<std::complex<double>> matrix = {}) {
+        PL_ABORT_IF_NOT(matrix.empty() ||
+                            matrix.size() == size_t{1} << (2 * wires.size()),
+                        "The size of matrix does not match with the given "
+                        "number of wires");
+        op_wires_.push_back(toWires(wires));
+        op_names_.push_back(nameIndex(name) |
+                            (inverse ? binary_circuit_inverse_flag : 0U));
+        params_.insert(params_.end(), params.begin(), params.end());
+        param_offsets_.push_back(static_cast<uint32_t>(params_.size()));
+        op_matrices_.push_back(std::move(matrix));
+    }
+
+    /**
+     * @brief Append an observable `sum_k coeffs[k] terms[k]`, where each term
+     * is the tensor product of its factors.
+     */
+    void addObservable(const std::vector<double> &coeffs,
+                       const std::vector<std::vector<BinaryFactor>> &terms) {
+        PL_ABORT_IF_NOT(coeffs.size() == terms.size(),
+                        "The number of coefficients and terms must be equal.");
+        for (size_t k = 0; k < terms.size(); k++) {
+            PL_ABORT_IF(terms[k].empty(), "A term must have factors.");
+            for (const auto &factor : terms[k]) {
+                PL_ABORT_IF_NOT(factor.matrix.empty() ||
+                                    factor.matrix.size() ==
+                                        size_t{1} << (2 * factor.wires.size()),
+                                "The size of matrix does not match with the "
+                                "given number of wires");
+                factor_names_.push_back(nameIndex(factor.name));
+                factor_wires_.push_back(toWires(factor.wires));
+                factor_matrices_.push_back(factor.matrix);
+            }
+            coeffs_.push_back(coeffs[k]);
+            term_offsets_.push_back(
+                static_cast<uint32_t>(factor_names_.size()));
+        }
+        observable_offsets_.push_back(static_cast<uint32_t>(coeffs_.size()));
+    }
+
+    /**
+     * @brief Serialize the circuit.
+     */
+    [[nodiscard]] auto build() const -> std::vector<std::byte> {
+        constexpr size_t num_sections =
+            static_cast<size_t>(BinarySection::Count);
+
+        std::vector<uint32_t> item_names(op_names_);
+        item_names.insert(item_names.end(), factor_names_.begin(),
+                          factor_names_.end());
+
+        std::vector<uint32_t> wire_offsets{0};
+        std::vector<uint32_t> wires;
+        std::vector<uint32_t> matrix_offsets{0};
+        std::vector<std::complex<double>> matrices;
+        auto append_items = [&](const auto &items_wires,
+                                const auto &items_matrices) {
+            for (size_t i = 0; i < items_wires.size(); i++) {
+                wires.insert(wires.end(), items_wires[i].begin(),
+                             items_wires[i].end());
+                wire_offsets.push_back(static_cast<uint32_t>(wires.size()));
+                matrices.insert(matrices.end(), items_matrices[i].begin(),
+                                items_matrices[i].end());
+                matrix_offsets.push_back(
+                    static_cast<uint32_t>(matrices.size()));
+            }
+        };
+        append_items(op_wires_, op_matrices_);
+        append_items(factor_wires_, factor_matrices_);
+
+        const std::array<std::span<const std::byte>, num_sections> sections{
+            std::as_bytes(std::span{name_offsets_}),
+            std::as_bytes(std::span{names_}),
+            std::as_bytes(std::span{item_names}),
+            std::as_bytes(std::span{wire_offsets}),
+            std::as_bytes(std::span{wires}),
+            std::as_bytes(std::span{param_offsets_}),
+            std::as_bytes(std::span{params_}),
+            std::as_bytes(std::span{matrix_offsets}),
+            std::as_bytes(std::span{matrices}),
+            std::as_bytes(std::span{observable_offsets_}),
+            std::as_bytes(std::span{coeffs_}),
+            std::as_bytes(std::span{term_offsets_}),
+        };
+        const std::array<size_t, num_sections> counts{
+            name_offsets_.size(),  names_.size(),
+            item_names.size(),     wire_offsets.size(),
+            wires.size(),          param_offsets_.size(),
+            params_.size(),        matrix_offsets.size(),
+            matrices.size(),       observable_offsets_.size(),
+            coeffs_.size(),        term_offsets_.size()};
+
+        auto align = [](size_t offset) { return (offset + 7) & ~size_t{7}; };
+        std::array<BinaryCircuitSection, num_sections> table{};
+        size_t size = sizeof(BinaryCircuitHeader) +
+                      num_sections * sizeof(BinaryCircuitSection);
+        for (size_t s = 0; s < num_sections; s++) {
+            size = align(size);
+            table[s] = {size, counts[s]};
+            size += sections[s].size();
+        }
+        size = align(size);
+
+        const BinaryCircuitHeader header{
+            binary_circuit_magic,
+            binary_circuit_version_major,
+            binary_circuit_version_minor,
+            static_cast<uint32_t>(num_qubits_),
+            static_cast<uint32_t>(op_names_.size()),
+            static_cast<uint32_t>(observable_offsets_.size() - 1),
+            static_cast<uint32_t>(coeffs_.size()),
+            static_cast<uint32_t>(factor_names_.size()),
+            static_cast<uint32_t>(num_sections),
+            size};
+
+        std::vector<std::byte> buffer(size);
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        std::memcpy(buffer.data() + sizeof(header), table.data(),
+                    sizeof(table));
+        for (size_t s = 0; s < num_sections; s++) {
+            if (!sections[s].empty()) {
+                std::memcpy(buffer.data() + table[s].offset,
+                            sections[s].data(), sections[s].size());
+            }
+        }
+        return buffer;
+    }
+};
+} // namespace Pennylane::Util
@@ -0,0 +1,119 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a single-worker job queue returning futures.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "Error.hpp"
+
+namespace Pennylane::Util {
+/**
+ * @brief FIFO job queue served by a single background thread.
+ *
+ * Jobs are executed one after another in submission order, so jobs acting on
+ * the same data never overlap. Exceptions thrown by a job are stored in the
+ * associated future and rethrown by `std::future::get`. The destructor
+ * finishes all pending jobs before joining the worker thread.
+ */
+class JobQueue {
+  private:
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::queue<std::function<void()>> jobs_;
+    bool stop_{false};
+    std::thread worker_; // must be initialized last
+
+    void run() {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cond_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+                if (jobs_.empty()) {
+                    return;
+                }
+                job = std::move(jobs_.front());
+                jobs_.pop();
+            }
+            job();
+        }
+    }
+
+  public:
+    JobQueue() : worker_{[this] { run(); }} {}
+
+    JobQueue(const JobQueue &) = delete;
+    JobQueue(JobQueue &&) = delete;
+    auto operator=(const JobQueue &) -> JobQueue & = delete;
+    auto operator=(JobQueue &&) -> JobQueue & = delete;
+
+    ~JobQueue() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cond_.notify_all();
+        worker_.join();
+    }
+
+    /**
+     * @brief Enqueue a callable and return a future to its result.
+     *
+     * @tparam Func Callable type taking no arguments.
+     * @param func Job to execute on the worker thread.
+     * @return std::future holding the job's return value or exception.
+     */
+    template <class Func>
+    auto submit(Func &&func)
+        -> std::future<std::invoke_result_t<std::decay_t<Func>>> {
+        using ResultT = std::invoke_result_t<std::decay_t<Func>>;
+        auto task = std::make_shared<std::packaged_task<ResultT()>>(
+            std::forward<Func>(func));
+        auto future = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            PL_ABORT_IF(stop_, "Cannot submit to a stopped JobQueue.");
+            jobs_.emplace([task]() { (*task)(); });
+        }
+        cond_.notify_one();
+        return future;
+    }
+
+    /**
+     * @brief Block until every job submitted so far has completed.
+     */
+    void synchronize() { submit([]() {}).wait(); }
+
+    /**
+     * @brief Number of submitted jobs waiting to be started.
+     */
+    [[nodiscard]] auto getNumPending() -> std::size_t {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return jobs_.size();
+    }
+};
+} // namespace Pennylane::Util
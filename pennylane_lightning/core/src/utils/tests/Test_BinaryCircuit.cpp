@@ -0,0 +1,162 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <complex>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "BinaryCircuit.hpp"
+#include "Error.hpp"
+#include "TestHelpers.hpp"
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::Util;
+using ComplexT = std::complex<double>;
+
+auto buildCircuit() -> std::vector<std::byte> {
+    BinaryCircuitBuilder builder{3};
+    builder.addOperation("Hadamard", {0});
+    builder.addOperation("RX", {2}, {0.5}, true);
+    builder.addOperation("CNOT", {0, 1});
+    builder.addOperation("QubitUnitary", {1}, {0.0}, false,
+                         {{0.0, 0.0}, {1.0, 0.0}, {1.0, 0.0}, {0.0, 0.0}});
+    builder.addOperation("RX", {1}, {0.25});
+    builder.addObservable({1.0}, {{{"PauliZ", {0}}}});
+    builder.addObservable(
+        {0.5, -2.0},
+        {{{"PauliX", {0}}, {"PauliY", {2}}},
+         {{"Hermitian", {1}, {{1.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}}}}});
+    return builder.build();
+}
+} // namespace
+/// @endcond
+
+TEST_CASE("BinaryCircuitView", "[BinaryCircuit]") {
+    const auto buffer = buildCircuit();
+    const BinaryCircuitView view{buffer};
+
+    SECTION("Header") {
+        const auto &header = view.getHeader();
+        CHECK(header.version_major == binary_circuit_version_major);
+        CHECK(header.size == buffer.size());
+        CHECK(buffer.size() % 8 == 0);
+        CHECK(view.getNumQubits() == 3);
+        CHECK(view.numOperations() == 5);
+        CHECK(view.numObservables() == 2);
+        CHECK(view.numItems() == 5 + 4);
+        // Names are stored once
+        CHECK(view.numNames() == 8);
+    }
+
+    SECTION("Operations") {
+        CHECK(view.itemName(0) == "Hadamard");
+        CHECK(view.itemName(1) == "RX");
+        CHECK(view.itemNameIndex(1) == view.itemNameIndex(4));
+        CHECK(view.isInverse(1));
+        CHECK(!view.isInverse(4));
+        CHECK(view.opParams(0).empty());
+        REQUIRE(view.opParams(1).size() == 1);
+        CHECK(view.opParams(1)[0] == 0.5);
+        CHECK(view.opParams(4)[0] == 0.25);
+
+        const auto wires = view.itemWires(2);
+        CHECK(std::vector<uint32_t>(wires.begin(), wires.end()) ==
+              std::vector<uint32_t>{0, 1});
+        CHECK(view.itemMatrix(2).empty());
+        const auto matrix = view.itemMatrix(3);
+        REQUIRE(matrix.size() == 4);
+        CHECK(matrix[1] == ComplexT{1.0, 0.0});
+    }
+
+    SECTION("Observables") {
+        CHECK(view.observableTerms(0) == std::pair<size_t, size_t>{0, 1});
+        CHECK(view.observableTerms(1) == std::pair<size_t, size_t>{1, 3});
+        CHECK(view.termCoeff(2) == -2.0);
+
+        const auto [begin, end] = view.termFactors(1);
+        REQUIRE(end - begin == 2);
+        CHECK(view.itemName(begin) == "PauliX");
+        CHECK(view.itemName(begin + 1) == "PauliY");
+        CHECK(view.itemWires(begin + 1)[0] == 2);
+
+        const auto hermitian = view.termFactors(2).first;
+        CHECK(view.itemName(hermitian) == "Hermitian");
+        CHECK(view.itemMatrix(hermitian)[0] == ComplexT{1.0, 0.0});
+    }
+
+    SECTION("Empty circuit") {
+        const auto empty = BinaryCircuitBuilder{1}.build();
+        const BinaryCircuitView empty_view{empty};
+        CHECK(empty_view.numOperations() == 0);
+        CHECK(empty_view.numObservables() == 0);
+    }
+}
+
+TEST_CASE("BinaryCircuitView::Invalid buffers", "[BinaryCircuit]") {
+    const auto buffer = buildCircuit();
+
+    SECTION("Truncated") {
+        PL_CHECK_THROWS_MATCHES(
+            BinaryCircuitView{std::span{buffer}.first(16)},
+            LightningException, "truncated");
+        PL_CHECK_THROWS_MATCHES(
+            BinaryCircuitView{std::span{buffer}.first(buffer.size() - 8)},
+            LightningException, "truncated");
+    }
+
+    SECTION("Magic and version") {
+        auto copy = buffer;
+        copy[0] = std::byte{'X'};
+        PL_CHECK_THROWS_MATCHES(BinaryCircuitView{copy}, LightningException,
+                                "not a binary circuit");
+
+        copy = buffer;
+        const uint16_t version = binary_circuit_version_major + 1;
+        std::memcpy(copy.data() + 4, &version, sizeof(version));
+        PL_CHECK_THROWS_MATCHES(BinaryCircuitView{copy}, LightningException,
+                                "Unsupported version");
+    }
+
+    SECTION("Out-of-range wires") {
+        auto copy = buffer;
+        const uint32_t num_qubits = 1;
+        std::memcpy(copy.data() + 8, &num_qubits, sizeof(num_qubits));
+        PL_CHECK_THROWS_MATCHES(BinaryCircuitView{copy}, LightningException,
+                                "out of range");
+    }
+
+    SECTION("Misaligned buffer") {
+        std::vector<std::byte> copy(buffer.size() + 1);
+        std::memcpy(copy.data() + 1, buffer.data(), buffer.size());
+        PL_CHECK_THROWS_MATCHES(
+            BinaryCircuitView{std::span{copy}.subspan(1)}, LightningException,
+            "aligned");
+    }
+
+    SECTION("Builder") {
+        BinaryCircuitBuilder builder{2};
+        PL_CHECK_THROWS_MATCHES(builder.addOperation("RX", {2}, {0.1}),
+                                LightningException, "Invalid wire index");
+        PL_CHECK_THROWS_MATCHES(
+            builder.addOperation("QubitUnitary", {0}, {}, false,
+                                 std::vector<ComplexT>(2)),
+            LightningException, "size of matrix");
+        PL_CHECK_THROWS_MATCHES(builder.addObservable({1.0, 2.0}, {{}}),
+                                LightningException, "must be equal");
+    }
+}
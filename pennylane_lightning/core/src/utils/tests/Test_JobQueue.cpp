@@ -0,0 +1,75 @@
+// Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "Error.hpp"
+#include "JobQueue.hpp"
+
+/// @cond DEV
+namespace {
+using namespace Pennylane::Util;
+} // namespace
+/// @endcond
+
+TEST_CASE("JobQueue::submit", "[JobQueue]") {
+    SECTION("Returns results through futures") {
+        JobQueue queue;
+        auto f1 = queue.submit([]() { return 42; });
+        auto f2 = queue.submit([]() { return std::vector<double>{1.0, 2.0}; });
+        REQUIRE(f1.get() == 42);
+        REQUIRE(f2.get() == std::vector<double>{1.0, 2.0});
+    }
+    SECTION("Executes jobs in submission order on one worker") {
+        JobQueue queue;
+        std::vector<std::size_t> order;
+        std::vector<std::future<std::thread::id>> ids;
+        for (std::size_t i = 0; i < 16; i++) {
+            ids.emplace_back(queue.submit([&order, i]() {
+                order.push_back(i);
+                return std::this_thread::get_id();
+            }));
+        }
+        queue.synchronize();
+        REQUIRE(queue.getNumPending() == 0);
+        const auto worker_id = ids[0].get();
+        CHECK(worker_id != std::this_thread::get_id());
+        for (std::size_t i = 1; i < ids.size(); i++) {
+            CHECK(ids[i].get() == worker_id);
+        }
+        for (std::size_t i = 0; i < order.size(); i++) {
+            CHECK(order[i] == i);
+        }
+    }
+    SECTION("Propagates exceptions to the future") {
+        JobQueue queue;
+        auto f = queue.submit([]() -> int { PL_ABORT("Job failed"); });
+        auto g = queue.submit([]() { return 1; });
+        REQUIRE_THROWS_WITH(f.get(), Catch::Matchers::Contains("Job failed"));
+        REQUIRE(g.get() == 1);
+    }
+    SECTION("Destructor drains pending jobs") {
+        std::size_t count = 0;
+        {
+            JobQueue queue;
+            for (std::size_t i = 0; i < 8; i++) {
+                queue.submit([&count]() { count++; });
+            }
+        }
+        REQUIRE(count == 8);
+    }
+}
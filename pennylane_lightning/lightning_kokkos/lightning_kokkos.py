@@ -66,7 +66,10 @@ if LK_CPP_BINARY_AVAILABLE:
     import pennylane as qml
 
     # pylint: disable=import-error, no-name-in-module, ungrouped-imports
-    from pennylane_lightning.core._serialize import QuantumScriptSerializer
+    from pennylane_lightning.core._serialize import (
+        QuantumScriptSerializer,
+        is_basis_state_projector,
+    )
     from pennylane_lightning.core._version import __version__
     from pennylane_lightning.lightning_kokkos_ops.algorithms import (
         AdjointJacobianC64,
@@ -141,6 +144,7 @@ if LK_CPP_BINARY_AVAILABLE:
         "OrbitalRotation",
         "QFT",
         "ECR",
+        "GroverOperator",
     }
 
     allowed_observables = {
@@ -402,6 +406,18 @@ if LK_CPP_BINARY_AVAILABLE:
 
                 wires = self.wires.indices(ops.wires)
 
+                if name == "DiagonalQubitUnitary":
+                    # Apply the diagonal directly instead of building the dense matrix
+                    state.applyDiagonal(
+                        np.ravel(ops.parameters[0]), wires, isinstance(ops, Adjoint)
+                    )
+                    continue
+
+                if name == "GroverOperator":
+                    # Self-inverse reflection about |+>^n, applied without a matrix
+                    state.applyGroverOperator(wires)
+                    continue
+
                 if method is None:
                     # Inverse can be set to False since qml.matrix(ops) is already in inverted form
                     try:
@@ -462,9 +478,9 @@ if LK_CPP_BINARY_AVAILABLE:
             Returns:
                 Expectation value of the observable
             """
-            if observable.name in [
-                "Projector",
-            ]:
+            if observable.name == "Projector" and (
+                self.shots is not None or not is_basis_state_projector(observable)
+            ):
                 return super().expval(observable, shot_range=shot_range, bin_size=bin_size)
 
             if self.shots is not None:
@@ -494,7 +510,7 @@ if LK_CPP_BINARY_AVAILABLE:
                 return measure.expval(matrix, observable_wires)
 
             if (
-                observable.name in ["Hamiltonian", "Hermitian"]
+                observable.name in ["Hamiltonian", "Hermitian", "Projector"]
                 or (observable.arithmetic_depth > 0)
                 or isinstance(observable.name, List)
             ):
@@ -522,9 +538,9 @@ if LK_CPP_BINARY_AVAILABLE:
             Returns:
                 Variance of the observable
             """
-            if observable.name in [
-                "Projector",
-            ]:
+            if observable.name == "Projector" and (
+                self.shots is not None or not is_basis_state_projector(observable)
+            ):
                 return super().var(observable, shot_range=shot_range, bin_size=bin_size)
 
             if self.shots is not None:
@@ -549,7 +565,7 @@ if LK_CPP_BINARY_AVAILABLE:
                 )
 
             if (
-                observable.name in ["Hamiltonian", "Hermitian"]
+                observable.name in ["Hamiltonian", "Hermitian", "Projector"]
                 or (observable.arithmetic_depth > 0)
                 or isinstance(observable.name, List)
             ):
@@ -627,14 +643,20 @@ if LK_CPP_BINARY_AVAILABLE:
                     "mixed with other return types"
                 )
 
+            # Projectors onto basis states are native observables, other projectors are not
             for measurement in measurements:
                 if isinstance(measurement.obs, Tensor):
-                    if any(isinstance(o, Projector) for o in measurement.obs.non_identity_obs):
+                    if any(
+                        isinstance(o, Projector) and not is_basis_state_projector(o)
+                        for o in measurement.obs.non_identity_obs
+                    ):
                         raise QuantumFunctionError(
                             "Adjoint differentiation method does not support the "
                             "Projector observable"
                         )
-                elif isinstance(measurement.obs, Projector):
+                elif isinstance(measurement.obs, Projector) and not is_basis_state_projector(
+                    measurement.obs
+                ):
                     raise QuantumFunctionError(
                         "Adjoint differentiation method does not support the Projector observable"
                     )
@@ -57,13 +57,17 @@ if LQ_CPP_BINARY_AVAILABLE:
         QuantumFunctionError,
     )
     from pennylane.operation import Tensor
+    from pennylane.ops.op_math import Adjoint
     from pennylane.measurements import MeasurementProcess, Expectation, State
     from pennylane.wires import Wires
 
     import pennylane as qml
 
     # pylint: disable=import-error, no-name-in-module, ungrouped-imports
-    from pennylane_lightning.core._serialize import QuantumScriptSerializer
+    from pennylane_lightning.core._serialize import (
+        QuantumScriptSerializer,
+        is_basis_state_projector,
+    )
     from pennylane_lightning.core._version import __version__
     from pennylane_lightning.lightning_qubit_ops.algorithms import (
         AdjointJacobianC64,
@@ -132,6 +136,7 @@ if LQ_CPP_BINARY_AVAILABLE:
         "OrbitalRotation",
         "QFT",
         "ECR",
+        "GroverOperator",
     }
 
     allowed_observables = {
@@ -353,6 +358,22 @@ if LQ_CPP_BINARY_AVAILABLE:
                 method = getattr(sim, operation.name, None)
 
                 wires = self.wires.indices(operation.wires)
+                is_adjoint = isinstance(operation, Adjoint)
+                base = operation.base if is_adjoint else operation
+                if base.name == "DiagonalQubitUnitary":
+                    # Apply the diagonal directly instead of building the dense matrix; the
+                    # adjoint applies the conjugated diagonal
+                    sim.applyDiagonal(np.ravel(base.parameters[0]), wires, is_adjoint)
+                    continue
+                if operation.name == "GroverOperator":
+                    # Self-inverse reflection about |+>^n, applied without a matrix
+                    sim.applyGroverOperator(wires)
+                    continue
+                if operation.name in ("QubitCarry", "QubitSum"):
+                    # Classical reversible gates, applied as a permutation of the basis states
+                    perm = np.argmax(np.abs(qml.matrix(operation)), axis=0)
+                    sim.applyPermutation(perm.tolist(), wires)
+                    continue
                 if method is None:
                     # Inverse can be set to False since qml.matrix(operation) is already in
                     # inverted form
@@ -415,10 +436,10 @@ if LQ_CPP_BINARY_AVAILABLE:
             Returns:
                 Expectation value of the observable
             """
-            if observable.name in [
-                "Identity",
-                "Projector",
-            ]:
+            if observable.name == "Identity" or (
+                observable.name == "Projector"
+                and (self.shots is not None or not is_basis_state_projector(observable))
+            ):
                 return super().expval(observable, shot_range=shot_range, bin_size=bin_size)
 
             if self.shots is not None:
@@ -445,7 +466,7 @@ if LQ_CPP_BINARY_AVAILABLE:
                 )
 
             if (
-                observable.name in ["Hamiltonian", "Hermitian"]
+                observable.name in ["Hamiltonian", "Hermitian", "Projector"]
                 or (observable.arithmetic_depth > 0)
                 or isinstance(observable.name, List)
             ):
@@ -473,10 +494,10 @@ if LQ_CPP_BINARY_AVAILABLE:
             Returns:
                 Variance of the observable
             """
-            if observable.name in [
-                "Identity",
-                "Projector",
-            ]:
+            if observable.name == "Identity" or (
+                observable.name == "Projector"
+                and (self.shots is not None or not is_basis_state_projector(observable))
+            ):
                 return super().var(observable, shot_range=shot_range, bin_size=bin_size)
 
             if self.shots is not None:
@@ -504,7 +525,7 @@ if LQ_CPP_BINARY_AVAILABLE:
                 )
 
             if (
-                observable.name in ["Hamiltonian", "Hermitian"]
+                observable.name in ["Hamiltonian", "Hermitian", "Projector"]
                 or (observable.arithmetic_depth > 0)
                 or isinstance(observable.name, List)
             ):
@@ -584,14 +605,20 @@ if LQ_CPP_BINARY_AVAILABLE:
                     "mixed with other return types"
                 )
 
+            # Projectors onto basis states are native observables, other projectors are not
             for measurement in measurements:
                 if isinstance(measurement.obs, Tensor):
-                    if any(isinstance(obs, Projector) for obs in measurement.obs.non_identity_obs):
+                    if any(
+                        isinstance(obs, Projector) and not is_basis_state_projector(obs)
+                        for obs in measurement.obs.non_identity_obs
+                    ):
                         raise QuantumFunctionError(
                             "Adjoint differentiation method does "
                             "not support the Projector observable"
                         )
-                elif isinstance(measurement.obs, Projector):
+                elif isinstance(measurement.obs, Projector) and not is_basis_state_projector(
+                    measurement.obs
+                ):
                     raise QuantumFunctionError(
                         "Adjoint differentiation method does not support the Projector observable"
                     )
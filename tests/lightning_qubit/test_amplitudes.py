@@ -0,0 +1,52 @@
+# Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Unit tests for partial amplitude access of lightning.qubit state vectors.
+"""
+import pytest
+from conftest import LightningDevice  # tested device
+
+import numpy as np
+
+from pennylane_lightning.lightning_qubit import LightningQubit
+
+if not LightningQubit._CPP_BINARY_AVAILABLE:
+    pytest.skip("No binary module found. Skipping.", allow_module_level=True)
+
+if LightningDevice != LightningQubit:
+    pytest.skip("Exclusive tests for lightning.qubit. Skipping.", allow_module_level=True)
+
+from pennylane_lightning.lightning_qubit_ops import StateVectorC64, StateVectorC128
+
+
+@pytest.mark.parametrize(
+    "c_dtype,sv_type", [(np.complex64, StateVectorC64), (np.complex128, StateVectorC128)]
+)
+def test_get_amplitudes(c_dtype, sv_type):
+    """Test index, range and bitstring-slice amplitude access."""
+    num_qubits = 4
+    rng = np.random.default_rng(42)
+    ket = (rng.random(2**num_qubits) + 1j * rng.random(2**num_qubits)).astype(c_dtype)
+    sv = sv_type(ket)
+
+    indices = [3, 0, 15, 3]
+    assert np.allclose(sv.getAmplitudes(indices), ket[indices])
+    assert np.allclose(sv.getAmplitudesRange(4, 11), ket[4:11])
+
+    # Wire 0 is the most significant bit.
+    expected = ket.reshape([2] * num_qubits)[1, :, 0, :].ravel()
+    assert np.allclose(sv.getAmplitudesSlice([2, 0], [0, 1]), expected)
+
+    with pytest.raises(RuntimeError, match="Basis-state index out of range."):
+        sv.getAmplitudes([16])
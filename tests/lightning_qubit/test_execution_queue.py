@@ -0,0 +1,174 @@
+# Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Unit tests for the asynchronous execution queue of lightning.qubit.
+"""
+import sys
+
+import pytest
+from conftest import LightningDevice  # tested device
+
+import numpy as np
+import pennylane as qml
+
+from pennylane_lightning.lightning_qubit import LightningQubit
+
+if not LightningQubit._CPP_BINARY_AVAILABLE:
+    pytest.skip("No binary module found. Skipping.", allow_module_level=True)
+
+if LightningDevice != LightningQubit:
+    pytest.skip("Exclusive tests for lightning.qubit. Skipping.", allow_module_level=True)
+
+from pennylane_lightning.core._serialize import QuantumScriptSerializer
+from pennylane_lightning.lightning_qubit_ops import StateVectorC64, StateVectorC128
+from pennylane_lightning.lightning_qubit_ops.algorithms import (
+    AdjointJacobianC64,
+    AdjointJacobianC128,
+    ExecutionQueueC64,
+    ExecutionQueueC128,
+    create_ops_listC64,
+    create_ops_listC128,
+)
+
+params = [0.4, -0.7, 1.1]
+
+
+def _tape():
+    with qml.tape.QuantumTape() as tape:
+        qml.RX(params[0], wires=0)
+        qml.RY(params[1], wires=1)
+        qml.CNOT(wires=[0, 1])
+        qml.RX(params[2], wires=2)
+        qml.expval(qml.PauliZ(0))
+        qml.expval(qml.PauliZ(1) @ qml.PauliZ(2))
+    return tape
+
+
+@pytest.mark.parametrize(
+    "c_dtype,sv_type,queue_type,adj_type,create_ops",
+    [
+        (np.complex64, StateVectorC64, ExecutionQueueC64, AdjointJacobianC64, create_ops_listC64),
+        (
+            np.complex128,
+            StateVectorC128,
+            ExecutionQueueC128,
+            AdjointJacobianC128,
+            create_ops_listC128,
+        ),
+    ],
+)
+class TestExecutionQueue:
+    """Tests for the ExecutionQueue bindings."""
+
+    def _serialize(self, tape, c_dtype, create_ops):
+        serializer = QuantumScriptSerializer("lightning.qubit", c_dtype == np.complex64)
+        wires_map = {w: w for w in range(3)}
+        ops, _ = serializer.serialize_ops(tape, wires_map)
+        obs = serializer.serialize_observables(tape, wires_map)
+        return create_ops(*ops), obs
+
+    def test_matches_synchronous(self, c_dtype, sv_type, queue_type, adj_type, create_ops):
+        """Test that queued jobs give the same results as synchronous execution."""
+        tape = _tape()
+        ops, obs = self._serialize(tape, c_dtype, create_ops)
+        tp = [0, 1, 2]
+
+        ket = np.zeros(8, dtype=c_dtype)
+        ket[0] = 1.0
+
+        queue = queue_type()
+        f_apply = queue.apply_operations(ket, ops)
+        f_expval = queue.expval(ket, obs)
+        f_jac = queue.adjoint_jacobian(ket, obs, ops, tp)
+
+        assert f_apply.result() is None
+        expvals = f_expval.result()
+        jac = f_jac.result()
+        assert f_jac.done()
+        assert queue.num_pending() == 0
+
+        dev = qml.device("lightning.qubit", wires=3, c_dtype=c_dtype)
+        expected = qml.execute([tape], dev, None)[0]
+        tol = 1e-5 if c_dtype == np.complex64 else 1e-7
+        assert np.allclose(expvals, expected, atol=tol)
+
+        expected_jac = adj_type()(sv_type(ket), obs, ops, tp)
+        assert jac.shape == (len(obs) * len(tp),)
+        assert np.allclose(jac, expected_jac, atol=tol)
+
+    def test_result_is_owned_by_numpy(self, c_dtype, sv_type, queue_type, adj_type, create_ops):
+        """Test that returned arrays stay valid after the queue is released."""
+        tape = _tape()
+        ops, obs = self._serialize(tape, c_dtype, create_ops)
+
+        ket = np.zeros(8, dtype=c_dtype)
+        ket[0] = 1.0
+
+        queue = queue_type()
+        queue.apply_operations(ket, ops)
+        res = queue.expval(ket, obs).result()
+        del queue
+
+        assert res.flags["OWNDATA"] is False
+        assert res.base is not None
+        assert np.isclose(res[0], np.cos(params[0]), atol=1e-5)
+
+    def test_errors_are_raised_by_result(self, c_dtype, sv_type, queue_type, adj_type, create_ops):
+        """Test that errors in a job are raised when retrieving its result."""
+        ket = np.zeros(8, dtype=c_dtype)
+        ket[0] = 1.0
+        _, obs = self._serialize(_tape(), c_dtype, create_ops)
+        ops = create_ops(["RX"], [[0.1, 0.2]], [[0]], [False], [[]])
+
+        queue = queue_type()
+        future = queue.adjoint_jacobian(ket, obs, ops, [0])
+        queue.synchronize()
+        assert future.done()
+        with pytest.raises(RuntimeError, match="not supported using the adjoint"):
+            future.result()
+
+    def test_handle_keeps_the_state_alive(self, c_dtype, sv_type, queue_type, adj_type, create_ops):
+        """Test that a job runs on the caller's array, which its handle keeps alive."""
+        tape = _tape()
+        ops, _ = self._serialize(tape, c_dtype, create_ops)
+        expected = qml.matrix(qml.tape.QuantumScript(tape.operations), wire_order=range(3))[:, 0]
+
+        ket = np.zeros(8, dtype=c_dtype)
+        ket[0] = 1.0
+        num_refs = sys.getrefcount(ket)
+
+        queue = queue_type()
+        future = queue.apply_operations(ket, ops)
+        assert sys.getrefcount(ket) == num_refs + 1
+        assert future.result() is None
+        assert sys.getrefcount(ket) == num_refs
+
+        tol = 1e-5 if c_dtype == np.complex64 else 1e-7
+        assert np.allclose(ket, expected, atol=tol)
+
+    def test_state_is_not_converted(self, c_dtype, sv_type, queue_type, adj_type, create_ops):
+        """Test that arrays that would need a conversion are rejected."""
+        ops, _ = self._serialize(_tape(), c_dtype, create_ops)
+        other_dtype = np.complex128 if c_dtype == np.complex64 else np.complex64
+        queue = queue_type()
+
+        with pytest.raises(TypeError):
+            queue.apply_operations(np.zeros(8, dtype=other_dtype), ops)
+        with pytest.raises(TypeError):
+            queue.apply_operations(np.zeros(16, dtype=c_dtype)[::2], ops)
+
+        ket = np.zeros(8, dtype=c_dtype)
+        ket.flags.writeable = False
+        with pytest.raises(RuntimeError, match="read-only"):
+            queue.apply_operations(ket, ops)
@@ -0,0 +1,80 @@
+# Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Import-time benchmark for the lightning.qubit binary module.
+
+Kernels are registered on first use, so importing the module must stay cheap and
+the first gate applied pays for the registration of its precision only.
+
+Wall-clock timings depend on the machine and its load, so this benchmark only runs
+when the ``PL_BENCHMARK`` environment variable is set.
+"""
+import json
+import os
+import subprocess
+import sys
+
+import pytest
+from conftest import LightningDevice  # tested device
+
+from pennylane_lightning.lightning_qubit import LightningQubit
+
+if not LightningQubit._CPP_BINARY_AVAILABLE:
+    pytest.skip("No binary module found. Skipping.", allow_module_level=True)
+
+if LightningDevice != LightningQubit:
+    pytest.skip("Exclusive tests for lightning.qubit. Skipping.", allow_module_level=True)
+
+if "PL_BENCHMARK" not in os.environ:
+    pytest.skip("Benchmark. Set PL_BENCHMARK to run it.", allow_module_level=True)
+
+# Generous budgets (in seconds) to catch regressions, not to measure precisely.
+IMPORT_BUDGET = 0.5
+FIRST_GATE_BUDGET = 0.5
+NUM_RUNS = 3
+
+BENCHMARK_SCRIPT = """
+import json
+import time
+
+import numpy as np
+
+start = time.perf_counter()
+import pennylane_lightning.lightning_qubit_ops as ops
+
+imported = time.perf_counter()
+state = np.zeros(2**4, dtype=np.complex128)
+state[0] = 1.0
+sv = ops.StateVectorC128(state)
+sv.Hadamard([0], False, [])
+first_gate = time.perf_counter()
+
+print(json.dumps({"import": imported - start, "first_gate": first_gate - imported}))
+"""
+
+
+def run_benchmark():
+    """Time the import and the first gate in a fresh interpreter."""
+    output = subprocess.run(
+        [sys.executable, "-c", BENCHMARK_SCRIPT], capture_output=True, check=True, text=True
+    ).stdout
+    return json.loads(output.strip().splitlines()[-1])
+
+
+def test_import_time():
+    """Test that importing the binary module and applying a first gate stay within budget."""
+    timings = [run_benchmark() for _ in range(NUM_RUNS)]
+
+    assert min(t["import"] for t in timings) < IMPORT_BUDGET
+    assert min(t["first_gate"] for t in timings) < FIRST_GATE_BUDGET
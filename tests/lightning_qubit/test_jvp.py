@@ -0,0 +1,122 @@
+# Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Unit tests for the forward-mode Jacobian vector product of lightning.qubit.
+"""
+import pytest
+from conftest import LightningDevice  # tested device
+
+import numpy as np
+import pennylane as qml
+
+from pennylane_lightning.lightning_qubit import LightningQubit
+
+if not LightningQubit._CPP_BINARY_AVAILABLE:
+    pytest.skip("No binary module found. Skipping.", allow_module_level=True)
+
+if LightningDevice != LightningQubit:
+    pytest.skip("Exclusive tests for lightning.qubit. Skipping.", allow_module_level=True)
+
+from pennylane_lightning.core._serialize import QuantumScriptSerializer
+from pennylane_lightning.lightning_qubit_ops import StateVectorC64, StateVectorC128
+from pennylane_lightning.lightning_qubit_ops.algorithms import (
+    JacobianVectorProductC64,
+    JacobianVectorProductC128,
+    create_ops_listC64,
+    create_ops_listC128,
+)
+
+
+def _tape(params):
+    with qml.tape.QuantumTape() as tape:
+        qml.RX(params[0], wires=0)
+        qml.RY(params[1], wires=1)
+        qml.CNOT(wires=[0, 1])
+        qml.IsingZZ(params[2], wires=[1, 2])
+        qml.RZ(params[3], wires=2)
+        qml.Hadamard(wires=2)
+        qml.expval(qml.PauliZ(0))
+        qml.expval(qml.PauliX(2) @ qml.PauliZ(1))
+    return tape
+
+
+@pytest.mark.parametrize(
+    "c_dtype,sv_type,jvp_type,create_ops",
+    [
+        (np.complex64, StateVectorC64, JacobianVectorProductC64, create_ops_listC64),
+        (np.complex128, StateVectorC128, JacobianVectorProductC128, create_ops_listC128),
+    ],
+)
+def test_jvp_matches_adjoint(c_dtype, sv_type, jvp_type, create_ops):
+    """Test that the forward-mode expectation value JVP matches the adjoint Jacobian."""
+    params = np.array([0.4, -0.7, 1.1, 0.3])
+    tangent = np.array([0.5, -1.0, 0.2, 0.8], dtype=np.real(c_dtype(0)).dtype)
+    tape = _tape(params)
+
+    serializer = QuantumScriptSerializer("lightning.qubit", c_dtype == np.complex64)
+    wires_map = {w: w for w in range(3)}
+    ops, _ = serializer.serialize_ops(tape, wires_map)
+    obs = serializer.serialize_observables(tape, wires_map)
+
+    ket = np.zeros(8, dtype=c_dtype)
+    ket[0] = 1.0
+    tp = [0, 1, 2, 3]
+    jvp = jvp_type().expval(sv_type(ket), obs, create_ops(*ops), tangent, tp)
+
+    dev = qml.device("lightning.qubit", wires=3, c_dtype=c_dtype)
+    tape.trainable_params = {0, 1, 2, 3}
+    expected = np.array(dev.adjoint_jacobian(tape)) @ tangent
+
+    tol = 1e-5 if c_dtype == np.complex64 else 1e-7
+    assert np.allclose(jvp, expected, atol=tol)
+
+
+@pytest.mark.parametrize(
+    "c_dtype,sv_type,jvp_type,create_ops",
+    [
+        (np.complex64, StateVectorC64, JacobianVectorProductC64, create_ops_listC64),
+        (np.complex128, StateVectorC128, JacobianVectorProductC128, create_ops_listC128),
+    ],
+)
+def test_jvp_probs_finite_difference(c_dtype, sv_type, jvp_type, create_ops):
+    """Test the forward-mode probability JVP against central finite differences."""
+    params = np.array([0.4, -0.7, 1.1, 0.3])
+    tangent = np.array([0.5, -1.0, 0.2, 0.8])
+
+    serializer = QuantumScriptSerializer("lightning.qubit", c_dtype == np.complex64)
+    wires_map = {w: w for w in range(3)}
+    ops, _ = serializer.serialize_ops(_tape(params), wires_map)
+
+    ket = np.zeros(8, dtype=c_dtype)
+    ket[0] = 1.0
+    jvp = jvp_type().probs(
+        sv_type(ket), create_ops(*ops), tangent.astype(np.real(ket).dtype), [0, 1, 2, 3]
+    )
+
+    def probs(p):
+        dev = qml.device("default.qubit", wires=3)
+
+        @qml.qnode(dev)
+        def circuit():
+            for op in _tape(p).operations:
+                qml.apply(op)
+            return qml.probs(wires=range(3))
+
+        return circuit()
+
+    h = 1e-4
+    expected = (probs(params + h * tangent) - probs(params - h * tangent)) / (2 * h)
+
+    tol = 1e-3 if c_dtype == np.complex64 else 1e-6
+    assert np.allclose(jvp, expected, atol=tol)
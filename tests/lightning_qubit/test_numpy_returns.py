@@ -0,0 +1,158 @@
+# Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Unit tests for the NumPy results returned by the lightning.qubit bindings.
+"""
+import pytest
+from conftest import LightningDevice  # tested device
+
+import numpy as np
+import pennylane as qml
+
+from pennylane_lightning.lightning_qubit import LightningQubit
+
+if not LightningQubit._CPP_BINARY_AVAILABLE:
+    pytest.skip("No binary module found. Skipping.", allow_module_level=True)
+
+if LightningDevice != LightningQubit:
+    pytest.skip("Exclusive tests for lightning.qubit. Skipping.", allow_module_level=True)
+
+from pennylane_lightning.core._serialize import QuantumScriptSerializer
+from pennylane_lightning.lightning_qubit_ops import (
+    MeasurementsC64,
+    MeasurementsC128,
+    StateVectorC64,
+    StateVectorC128,
+)
+from pennylane_lightning.lightning_qubit_ops.algorithms import (
+    AdjointJacobianC64,
+    AdjointJacobianC128,
+    create_ops_listC64,
+    create_ops_listC128,
+)
+
+
+def _random_state(num_qubits, c_dtype):
+    rng = np.random.default_rng(1234)
+    ket = rng.random(2**num_qubits) + 1j * rng.random(2**num_qubits)
+    return (ket / np.linalg.norm(ket)).astype(c_dtype)
+
+
+@pytest.mark.parametrize(
+    "c_dtype,sv_type,meas_type",
+    [
+        (np.complex64, StateVectorC64, MeasurementsC64),
+        (np.complex128, StateVectorC128, MeasurementsC128),
+    ],
+)
+def test_probs(c_dtype, sv_type, meas_type):
+    """Test that probabilities are returned as owning arrays and can be written into a
+    preallocated array."""
+    ket = _random_state(3, c_dtype)
+    m = meas_type(sv_type(ket))
+    expected = np.abs(ket) ** 2
+
+    probs = m.probs()
+    assert probs.flags.owndata is False
+    assert probs.flags.writeable
+    assert np.allclose(probs, expected)
+
+    out = np.empty(4, dtype=probs.dtype)
+    m.probs([2, 0], out)
+    assert np.allclose(out, expected.reshape(2, 2, 2).sum(axis=1).T.ravel())
+
+    with pytest.raises(RuntimeError, match="The output array has the wrong size."):
+        m.probs([0], out)
+
+
+@pytest.mark.parametrize(
+    "c_dtype,sv_type,meas_type",
+    [
+        (np.complex64, StateVectorC64, MeasurementsC64),
+        (np.complex128, StateVectorC128, MeasurementsC128),
+    ],
+)
+def test_probs_out_not_converted(c_dtype, sv_type, meas_type):
+    """Test that output arrays which would need a conversion are rejected instead of being
+    written into a temporary copy."""
+    m = meas_type(sv_type(_random_state(3, c_dtype)))
+    dtype = m.probs().dtype
+
+    with pytest.raises(TypeError):
+        m.probs([2, 0], np.empty(8, dtype=dtype)[::2])
+    with pytest.raises(TypeError):
+        m.probs([2, 0], np.empty(4, dtype=np.float16))
+    with pytest.raises(TypeError):
+        m.generate_samples(3, 10, np.zeros((10, 3), dtype=np.int8))
+
+    out = np.empty(4, dtype=dtype)
+    out.flags.writeable = False
+    with pytest.raises(RuntimeError, match="The output array is read-only."):
+        m.probs([2, 0], out)
+
+
+@pytest.mark.parametrize(
+    "c_dtype,sv_type,meas_type",
+    [
+        (np.complex64, StateVectorC64, MeasurementsC64),
+        (np.complex128, StateVectorC128, MeasurementsC128),
+    ],
+)
+def test_generate_samples(c_dtype, sv_type, meas_type):
+    """Test the shape of returned and preallocated samples."""
+    ket = np.zeros(8, dtype=c_dtype)
+    ket[5] = 1.0
+    m = meas_type(sv_type(ket))
+
+    samples = m.generate_samples(3, 10)
+    assert samples.shape == (10, 3)
+    assert np.all(samples == [1, 0, 1])
+
+    out = np.zeros((10, 3), dtype=samples.dtype)
+    m.generate_samples(3, 10, out)
+    assert np.all(out == [1, 0, 1])
+
+
+@pytest.mark.parametrize(
+    "c_dtype,sv_type,adj_type,create_ops",
+    [
+        (np.complex64, StateVectorC64, AdjointJacobianC64, create_ops_listC64),
+        (np.complex128, StateVectorC128, AdjointJacobianC128, create_ops_listC128),
+    ],
+)
+def test_adjoint_jacobian_out(c_dtype, sv_type, adj_type, create_ops):
+    """Test that the adjoint Jacobian can be written into a preallocated array."""
+    with qml.tape.QuantumTape() as tape:
+        qml.RX(0.4, wires=0)
+        qml.CNOT(wires=[0, 1])
+        qml.RY(-0.3, wires=1)
+        qml.expval(qml.PauliZ(1))
+
+    serializer = QuantumScriptSerializer("lightning.qubit", c_dtype == np.complex64)
+    wires_map = {0: 0, 1: 1}
+    ops, _ = serializer.serialize_ops(tape, wires_map)
+    obs = serializer.serialize_observables(tape, wires_map)
+
+    dev = qml.device("lightning.qubit", wires=2, c_dtype=c_dtype)
+    dev.apply(tape.operations)
+    sv = sv_type(dev.state)
+    ops_list = create_ops(*ops)
+
+    jac = adj_type()(sv, obs, ops_list, [0, 1])
+    out = np.empty(2, dtype=jac.dtype)
+    adj_type()(sv, obs, ops_list, [0, 1], out)
+    assert np.allclose(out, jac)
+
+    with pytest.raises(TypeError):
+        adj_type()(sv, obs, ops_list, [0, 1], np.empty(4, dtype=jac.dtype)[::2])
@@ -0,0 +1,108 @@
+# Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Unit tests for the prefix-caching parameter-shift engine of lightning.qubit.
+"""
+import pytest
+from conftest import LightningDevice  # tested device
+
+import numpy as np
+import pennylane as qml
+
+from pennylane_lightning.lightning_qubit import LightningQubit
+
+if not LightningQubit._CPP_BINARY_AVAILABLE:
+    pytest.skip("No binary module found. Skipping.", allow_module_level=True)
+
+if LightningDevice != LightningQubit:
+    pytest.skip("Exclusive tests for lightning.qubit. Skipping.", allow_module_level=True)
+
+from pennylane_lightning.core._serialize import QuantumScriptSerializer
+from pennylane_lightning.lightning_qubit_ops import StateVectorC64, StateVectorC128
+from pennylane_lightning.lightning_qubit_ops.algorithms import (
+    ParameterShiftJacobianC64,
+    ParameterShiftJacobianC128,
+    create_ops_listC64,
+    create_ops_listC128,
+)
+
+
+@pytest.mark.parametrize("max_snapshots", [1, 2, 8])
+@pytest.mark.parametrize(
+    "c_dtype,sv_type,ps_type,create_ops",
+    [
+        (np.complex64, StateVectorC64, ParameterShiftJacobianC64, create_ops_listC64),
+        (np.complex128, StateVectorC128, ParameterShiftJacobianC128, create_ops_listC128),
+    ],
+)
+def test_parameter_shift_matches_adjoint(c_dtype, sv_type, ps_type, create_ops, max_snapshots):
+    """Test that the prefix-caching parameter-shift Jacobian matches the adjoint method."""
+    params = np.array([0.4, -0.7, 1.1, 0.3])
+    with qml.tape.QuantumTape() as tape:
+        qml.RX(params[0], wires=0)
+        qml.RY(params[1], wires=1)
+        qml.CNOT(wires=[0, 1])
+        qml.IsingZZ(params[2], wires=[1, 2])
+        qml.RZ(params[3], wires=2)
+        qml.Hadamard(wires=2)
+        qml.expval(qml.PauliZ(0))
+        qml.expval(qml.PauliX(2) @ qml.PauliZ(1))
+
+    serializer = QuantumScriptSerializer("lightning.qubit", c_dtype == np.complex64)
+    wires_map = {w: w for w in range(3)}
+    ops, _ = serializer.serialize_ops(tape, wires_map)
+    obs = serializer.serialize_observables(tape, wires_map)
+
+    ket = np.zeros(8, dtype=c_dtype)
+    ket[0] = 1.0
+    tp = [0, 1, 2, 3]
+    jac = ps_type().parameter_shift(sv_type(ket), obs, create_ops(*ops), tp, max_snapshots)
+
+    dev = qml.device("lightning.qubit", wires=3, c_dtype=c_dtype)
+    tape.trainable_params = {0, 1, 2, 3}
+    expected = dev.adjoint_jacobian(tape)
+
+    tol = 1e-5 if c_dtype == np.complex64 else 1e-7
+    assert np.allclose(jac.reshape(len(obs), len(tp)), np.array(expected), atol=tol)
+
+
+@pytest.mark.parametrize(
+    "c_dtype,sv_type,ps_type,create_ops,tol",
+    [
+        (np.complex64, StateVectorC64, ParameterShiftJacobianC64, create_ops_listC64, 2e-3),
+        (np.complex128, StateVectorC128, ParameterShiftJacobianC128, create_ops_listC128, 1e-6),
+    ],
+)
+def test_finite_diff_default_step(c_dtype, sv_type, ps_type, create_ops, tol):
+    """Test that the default step of the finite-difference Jacobian, which depends on the
+    precision, matches the analytic gradient."""
+    params = np.array([0.4, -0.7])
+    with qml.tape.QuantumTape() as tape:
+        qml.RX(params[0], wires=0)
+        qml.RY(params[1], wires=1)
+        qml.expval(qml.PauliZ(0))
+        qml.expval(qml.PauliZ(1))
+
+    serializer = QuantumScriptSerializer("lightning.qubit", c_dtype == np.complex64)
+    wires_map = {w: w for w in range(2)}
+    ops, _ = serializer.serialize_ops(tape, wires_map)
+    obs = serializer.serialize_observables(tape, wires_map)
+
+    ket = np.zeros(4, dtype=c_dtype)
+    ket[0] = 1.0
+    tp = [0, 1]
+    jac = ps_type().finite_diff(sv_type(ket), obs, create_ops(*ops), tp)
+
+    expected = np.array([[-np.sin(params[0]), 0.0], [0.0, -np.sin(params[1])]])
+    assert np.allclose(jac.reshape(len(obs), len(tp)), expected, atol=tol)
@@ -0,0 +1,87 @@
+# Copyright 2018-2023 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Unit tests for statevector snapshots of lightning.qubit.
+"""
+import pytest
+from conftest import LightningDevice  # tested device
+
+import numpy as np
+
+from pennylane_lightning.lightning_qubit import LightningQubit
+
+if not LightningQubit._CPP_BINARY_AVAILABLE:
+    pytest.skip("No binary module found. Skipping.", allow_module_level=True)
+
+if LightningDevice != LightningQubit:
+    pytest.skip("Exclusive tests for lightning.qubit. Skipping.", allow_module_level=True)
+
+from pennylane_lightning.lightning_qubit_ops import StateVectorC64, StateVectorC128
+
+
+@pytest.mark.parametrize(
+    "sv_class, dtype", [(StateVectorC64, np.complex64), (StateVectorC128, np.complex128)]
+)
+class TestSnapshot:
+    """Tests for snapshot and restore."""
+
+    @staticmethod
+    def random_state(num_qubits, dtype):
+        rng = np.random.default_rng(42)
+        state = rng.random(2**num_qubits) + 1j * rng.random(2**num_qubits)
+        return (state / np.linalg.norm(state)).astype(dtype)
+
+    def test_restore(self, sv_class, dtype):
+        """Test that restoring a snapshot recovers the state."""
+        state = self.random_state(5, dtype)
+        expected = state.copy()
+        sv = sv_class(state)
+
+        snap = sv.snapshot(chunk_qubits=2)
+        assert snap.num_qubits == 5
+        assert snap.num_chunks == 8
+
+        sv.Hadamard([0], False, [])
+        assert not np.allclose(state, expected)
+        sv.restore(snap)
+        assert np.array_equal(state, expected)
+
+    def test_shared_chunks(self, sv_class, dtype):
+        """Test that a snapshot shares unchanged chunks with its base."""
+        state = self.random_state(5, dtype)
+        sv = sv_class(state)
+
+        base = sv.snapshot(chunk_qubits=2)
+        sv.PauliX([0], False, [])
+        flipped = sv.snapshot(base)
+        assert flipped.num_shared_chunks(base) == 0
+
+        sv.restore(base)
+        same = sv.snapshot(base)
+        assert same.num_shared_chunks(base) == base.num_chunks
+
+    def test_buffer_pool(self, sv_class, dtype):
+        """Test that the buffer pool can be disabled and cleared."""
+        state = self.random_state(5, dtype)
+        expected = state.copy()
+        sv = sv_class(state)
+
+        sv_class.setBufferPoolCapacity(0)
+        snap = sv.snapshot(chunk_qubits=2)
+        sv.Hadamard([0], False, [])
+        sv.restore(snap)
+        assert np.array_equal(state, expected)
+
+        sv_class.clearBufferPool()
+        sv_class.setBufferPoolCapacity(capacity=2**22)
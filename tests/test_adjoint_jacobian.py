@@ -157,10 +157,12 @@ class TestAdjointJacobian:
 
     @pytest.mark.skipif(not ld._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
     def test_proj_unsupported(self, dev):
-        """Test if a QuantumFunctionError is raised for a Projector observable"""
+        """Test if a QuantumFunctionError is raised for a Projector observable onto a state
+        vector"""
+        state = np.array([1, 1, 0, 0], requires_grad=False) / np.sqrt(2)
         with qml.tape.QuantumTape() as tape:
             qml.CRX(0.1, wires=[0, 1])
-            qml.expval(qml.Projector([0, 1], wires=[0, 1]))
+            qml.expval(qml.Projector(state, wires=[0, 1]))
 
         with pytest.raises(
             qml.QuantumFunctionError, match="differentiation method does not support the Projector"
@@ -169,13 +171,42 @@ class TestAdjointJacobian:
 
         with qml.tape.QuantumTape() as tape:
             qml.CRX(0.1, wires=[0, 1])
-            qml.expval(qml.Projector([0], wires=[0]) @ qml.PauliZ(0))
+            qml.expval(qml.Projector(state[::2] * np.sqrt(2), wires=[0]) @ qml.PauliZ(1))
 
         with pytest.raises(
             qml.QuantumFunctionError, match="differentiation method does not support the Projector"
         ):
             dev.adjoint_jacobian(tape)
 
+    @pytest.mark.skipif(not ld._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
+    @pytest.mark.skipif(
+        device_name == "lightning.gpu", reason="Native projectors are not available on lightning.gpu"
+    )
+    @pytest.mark.parametrize(
+        "obs",
+        [
+            qml.Projector([0, 1], wires=[0, 1]),
+            qml.Projector([1], wires=[1]) @ qml.PauliX(0),
+        ],
+    )
+    def test_basis_state_projector(self, obs, dev, tol):
+        """Test the adjoint Jacobian of projectors onto computational basis states"""
+        with qml.tape.QuantumTape() as tape:
+            qml.RX(0.4, wires=[0])
+            qml.CRY(-0.7, wires=[0, 1])
+            qml.RY(1.1, wires=[1])
+            qml.expval(obs)
+
+        tape.trainable_params = {0, 1, 2}
+
+        calculated_val = dev.adjoint_jacobian(tape)
+
+        qml.execute([tape], dev, None)
+        tapes, fn = qml.gradients.param_shift(tape)
+        expected_val = fn(qml.execute(tapes, dev, None))
+
+        assert np.allclose(calculated_val, expected_val, atol=tol, rtol=0)
+
     @pytest.mark.parametrize("theta", np.linspace(-2 * np.pi, 2 * np.pi, 7))
     @pytest.mark.parametrize("G", [qml.RX, qml.RY, qml.RZ])
     @pytest.mark.parametrize("stateprep", [qml.QubitStateVector, qml.StatePrep])
@@ -1415,3 +1446,81 @@ def test_diff_qubit_unitary(n_targets):
         assert np.allclose(jac, jac_fd)
         assert np.allclose(jac, jac_ps)
         assert np.allclose(jac, jac_def)
+
+
+@pytest.mark.skipif(
+    device_name != "lightning.qubit" or not ld._CPP_BINARY_AVAILABLE,
+    reason="The term-resolved Jacobian is bound for lightning.qubit only",
+)
+@pytest.mark.parametrize("c_dtype", [np.complex64, np.complex128])
+@pytest.mark.parametrize("max_states", [1, 2, 3])
+def test_adjoint_jacobian_terms(c_dtype, max_states):
+    """Tests that the term-resolved adjoint Jacobian matches the per-term adjoint Jacobians,
+    and that the term expectation values are the derivatives with respect to the coefficients."""
+    from pennylane_lightning.core._serialize import QuantumScriptSerializer
+    from pennylane_lightning.lightning_qubit_ops.algorithms import (
+        AdjointJacobianC64,
+        AdjointJacobianC128,
+        adjoint_jacobian_termsC64,
+        adjoint_jacobian_termsC128,
+        create_ops_listC64,
+        create_ops_listC128,
+    )
+
+    use_csingle = c_dtype == np.complex64
+    adj_type, adj_terms, create_ops = (
+        (AdjointJacobianC64, adjoint_jacobian_termsC64, create_ops_listC64)
+        if use_csingle
+        else (AdjointJacobianC128, adjoint_jacobian_termsC128, create_ops_listC128)
+    )
+    tol = 1e-5 if use_csingle else 1e-7
+
+    n_wires = 3
+    wires_map = {i: i for i in range(n_wires)}
+    params = np.array([0.3, -0.7, 1.2, 0.5], requires_grad=False)
+    coeffs = np.array([0.4, -1.3, 0.8], requires_grad=True)
+    terms = [qml.PauliZ(0) @ qml.PauliX(1), qml.PauliY(2), qml.PauliX(0) @ qml.PauliZ(2)]
+
+    def ansatz(x):
+        qml.Hadamard(wires=0)
+        qml.RX(x[0], wires=0)
+        qml.CNOT(wires=[0, 1])
+        qml.RY(x[1], wires=1)
+        qml.IsingZZ(x[2], wires=[1, 2])
+        qml.RZ(x[3], wires=2)
+
+    def tape_of(observable):
+        with qml.tape.QuantumTape() as tape:
+            ansatz(params)
+            qml.expval(observable)
+        return tape
+
+    serializer = QuantumScriptSerializer(device_name, use_csingle)
+    tape = tape_of(qml.Hamiltonian(coeffs, terms))
+    ops, _ = serializer.serialize_ops(tape, wires_map)
+    ops_list = create_ops(*ops)
+    (hamiltonian,) = serializer.serialize_observables(tape, wires_map)
+    tp = list(range(len(params)))
+
+    dev = qml.device(device_name, wires=n_wires, c_dtype=c_dtype)
+    dev.apply(tape.operations)
+    sv = serializer.sv_type(dev.state)
+
+    jac, term_expvals = adj_terms(sv, hamiltonian, ops_list, tp, max_states)
+    assert jac.shape == (len(terms), len(params))
+    assert term_expvals.shape == (len(terms),)
+
+    for k, term in enumerate(terms):
+        term_obs = serializer.serialize_observables(tape_of(term), wires_map)
+        expected = adj_type()(sv, term_obs, ops_list, tp)
+        assert np.allclose(jac[k], expected, atol=tol)
+
+    # d<H>/dc_k
+    def cost(c):
+        ansatz(params)
+        return qml.expval(qml.Hamiltonian(c, terms))
+
+    dev_def = qml.device("default.qubit", wires=n_wires)
+    expected_expvals = qml.grad(qml.QNode(cost, dev_def))(coeffs)
+    assert np.allclose(term_expvals, expected_expvals, atol=tol)
+    assert np.allclose(coeffs @ jac, adj_type()(sv, [hamiltonian], ops_list, tp), atol=tol)
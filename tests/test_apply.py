@@ -1481,6 +1481,18 @@ class TestApplyLightningMethod:
         assert np.allclose(dev.state, starting_state, atol=tol, rtol=0)
         assert dev.state.dtype == dev.C_DTYPE
 
+    @pytest.mark.parametrize("adjoint", [False, True])
+    def test_apply_diagonal_qubit_unitary(self, adjoint, tol):
+        """Test that DiagonalQubitUnitary and its adjoint apply the (conjugated) diagonal."""
+        dev = qml.device(device_name, wires=2)
+        diag = np.exp(1j * np.array([0.1, -0.4, 1.3, 2.2]))
+        op = qml.DiagonalQubitUnitary(diag, wires=[1, 0])
+        dev.apply([qml.Hadamard(0), qml.Hadamard(1), qml.adjoint(op) if adjoint else op])
+
+        expected = np.conj(diag) if adjoint else diag
+        expected = expected.reshape(2, 2).T.ravel() / 2
+        assert np.allclose(dev.state, expected, atol=tol, rtol=0)
+
     @pytest.mark.skipif(
         not ld._CPP_BINARY_AVAILABLE or device_name != "lightning.gpu",
         reason="Only meaningful when binary is available.",
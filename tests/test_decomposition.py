@@ -15,7 +15,7 @@
 Unit tests for operation decomposition with Lightning devices.
 """
 import pytest
-from conftest import LightningDevice as ld
+from conftest import LightningDevice as ld, device_name
 
 import numpy as np
 import pennylane as qml
@@ -40,3 +40,58 @@ class TestDenseMatrixDecompositionThreshold:
         wires = np.linspace(0, n_wires - 1, n_wires, dtype=int)
         op = op(wires=wires)
         assert ld.stopping_condition.__get__(op)(op) == condition
+
+    @pytest.mark.skipif(
+        device_name not in ("lightning.qubit", "lightning.kokkos"),
+        reason="GroverOperator is only applied natively by lightning.qubit and lightning.kokkos",
+    )
+    def test_native_grover_operator(self):
+        """Tests that devices applying GroverOperator natively accept it on any number of
+        wires."""
+        dev = qml.device(device_name, wires=13)
+        op = qml.GroverOperator(wires=range(13))
+        assert dev.stopping_condition(op)
+
+
+@pytest.mark.parametrize("n_wires", [3, 14])
+def test_grover_operator(n_wires):
+    """Tests GroverOperator on an entangled state, including on more wires than the
+    dense-matrix threshold."""
+    wires = list(range(n_wires))
+    dev = qml.device(device_name, wires=n_wires + 1)
+
+    def circuit(grover):
+        for w in wires:
+            qml.RY(0.1 * (w + 1), wires=w)
+        qml.CNOT(wires=[0, n_wires])
+        if grover:
+            qml.GroverOperator(wires=wires[::-1])
+        return qml.state()
+
+    # 2|s><s| - I about the uniform superposition |s> of the first n_wires wires
+    state = qml.QNode(circuit, dev)(False).reshape(2**n_wires, 2)
+    expected = 2 * state.mean(axis=0) - state
+
+    result = qml.QNode(circuit, dev)(True)
+    assert np.allclose(result, expected.ravel())
+
+
+@pytest.mark.parametrize("adjoint", [False, True])
+@pytest.mark.parametrize("n_wires", [3, 12])
+def test_qft(n_wires, adjoint):
+    """Tests QFT on a subset of the wires of an entangled state against its decomposition,
+    including on more wires than the dense-matrix threshold."""
+    wires = list(range(1, n_wires + 1))[::-1]
+    dev = qml.device(device_name, wires=n_wires + 2)
+
+    def circuit(native):
+        for w in range(n_wires + 2):
+            qml.RY(0.1 * (w + 1), wires=w)
+        qml.CNOT(wires=[0, n_wires + 1])
+        qft = qml.QFT if native else qml.QFT.compute_decomposition
+        (qml.adjoint(qft) if adjoint else qft)(wires=wires)
+        return qml.state()
+
+    expected = qml.QNode(circuit, dev)(False)
+    result = qml.QNode(circuit, dev)(True)
+    assert np.allclose(result, expected)
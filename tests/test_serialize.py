@@ -14,12 +14,14 @@
 """
 Unit tests for the serialization helper functions.
 """
+import struct
+
 import pytest
 from conftest import device_name, LightningDevice
 
 import numpy as np
 import pennylane as qml
-from pennylane_lightning.core._serialize import QuantumScriptSerializer
+from pennylane_lightning.core._serialize import QuantumScriptSerializer, pack_binary_circuit
 
 if not LightningDevice._CPP_BINARY_AVAILABLE:
     pytest.skip("No binary module found. Skipping.", allow_module_level=True)
@@ -36,6 +38,7 @@ if device_name == "lightning.kokkos":
         HamiltonianC128,
         SparseHamiltonianC64,
         SparseHamiltonianC128,
+        ProjectorObsC128,
     )
 elif device_name == "lightning.gpu":
     from pennylane_lightning.lightning_gpu_ops.observables import (
@@ -50,6 +53,9 @@ elif device_name == "lightning.gpu":
         SparseHamiltonianC64,
         SparseHamiltonianC128,
     )
+
+    # Projectors are serialized as Hermitian observables on lightning.gpu
+    ProjectorObsC128 = HermitianObsC128
 else:
     from pennylane_lightning.lightning_qubit_ops.observables import (
         NamedObsC64,
@@ -62,6 +68,7 @@ else:
         HamiltonianC128,
         SparseHamiltonianC64,
         SparseHamiltonianC128,
+        ProjectorObsC128,
     )
 
 
@@ -95,7 +102,9 @@ def test_wrong_device_name():
             qml.PauliZ(0) @ qml.Hermitian(np.eye(2), wires=1) @ qml.Projector([0], wires=2),
             TensorProdObsC128,
         ),
-        (qml.Projector([0], wires=0), HermitianObsC128),
+        (qml.Projector([0], wires=0), ProjectorObsC128),
+        (qml.Projector([1, 0], wires=[0, 1]), ProjectorObsC128),
+        (qml.Projector([0.6, 0.8], wires=0), HermitianObsC128),
         (qml.Hamiltonian([1], [qml.PauliZ(0)]), HamiltonianC128),
         (qml.sum(qml.Hadamard(0), qml.PauliX(1)), HermitianObsC128),
         (
@@ -560,3 +569,72 @@ class TestSerializeOps:
         assert s[1] == s_expected[1]
 
         assert all(np.allclose(s1, s2) for s1, s2 in zip(s[0][4], s_expected[0][4]))
+
+
+def read_binary_sections(buffer):
+    """Read the header and the sections of a binary circuit."""
+    magic, major, minor, *counts, size = struct.unpack_from("<4sHH6IQ", buffer)
+    dtypes = ["<u4", "u1", "<u4", "<u4", "<u4", "<u4", "<f8", "<u4", "<c16", "<u4", "<f8", "<u4"]
+    sections = []
+    for idx, dtype in enumerate(dtypes):
+        offset, count = struct.unpack_from("<QQ", buffer, 40 + 16 * idx)
+        assert offset % 8 == 0
+        sections.append(np.frombuffer(buffer, dtype=dtype, count=count, offset=offset))
+    return (magic, major, minor, counts, size), sections
+
+
+class TestSerializeBinary:
+    """Tests the serialization of tapes into binary circuits."""
+
+    wires_dict = {i: i for i in range(3)}
+
+    def test_layout(self):
+        """Test the header and the sections of a packed circuit."""
+        buffer = pack_binary_circuit(
+            2,
+            [("RX", [0], [0.4], False, []), ("RX", [1], [0.2], True, [])],
+            [[(0.5, [("PauliZ", [0], []), ("PauliX", [1], [])])]],
+        )
+        (magic, major, minor, counts, size), sections = read_binary_sections(buffer)
+
+        assert (magic, major, minor) == (b"PLBC", 1, 0)
+        assert counts == [2, 2, 1, 1, 2, 12]
+        assert size == len(buffer) and size % 8 == 0
+        assert bytes(sections[1]).decode() == "RXPauliZPauliX"
+        assert sections[2].tolist() == [0, 1 << 31, 1, 2]
+        assert sections[4].tolist() == [0, 1, 0, 1]
+        assert sections[6].tolist() == [0.4, 0.2]
+        assert sections[10].tolist() == [0.5]
+        assert sections[11].tolist() == [0, 2]
+
+    def test_tape(self):
+        """Test a tape is serialized with its matrices and flattened observables."""
+        unitary = np.array([[0, 1j], [1j, 0]])
+        with qml.tape.QuantumTape() as tape:
+            qml.RY(0.3, wires=0)
+            qml.QubitUnitary(unitary, wires=2)
+            qml.expval(qml.Hamiltonian([0.5, 2.0], [qml.PauliX(0) @ qml.PauliZ(1), qml.PauliY(2)]))
+            qml.expval(qml.Hermitian(np.eye(2), wires=1))
+
+        buffer, uses_stateprep = QuantumScriptSerializer(device_name).serialize_binary(
+            tape, self.wires_dict
+        )
+        (_, _, _, counts, _), sections = read_binary_sections(buffer)
+
+        assert not uses_stateprep
+        assert counts == [3, 2, 2, 3, 4, 12]
+        assert sections[6].tolist() == [0.3, 0.0]
+        assert sections[7].tolist() == [0, 0, 4, 4, 4, 4, 8]
+        assert np.allclose(sections[8], np.concatenate([unitary.ravel(), np.eye(2).ravel()]))
+        assert sections[9].tolist() == [0, 2, 3]
+        assert sections[10].tolist() == [0.5, 2.0, 1.0]
+        assert sections[11].tolist() == [0, 2, 3, 4]
+
+    def test_sparse_hamiltonian(self):
+        """Test SparseHamiltonian observables are not supported."""
+        Hmat = qml.Hamiltonian([1.0], [qml.PauliZ(0)]).sparse_matrix()
+        H = qml.SparseHamiltonian(Hmat, wires=[0])
+        tape = qml.tape.QuantumScript([], [qml.expval(H)])
+
+        with pytest.raises(qml.DeviceError, match="SparseHamiltonian"):
+            QuantumScriptSerializer(device_name).serialize_binary(tape, self.wires_dict)
@@ -183,11 +183,13 @@ class TestVectorJacobianProduct:
             dev.vjp(tape.measurements, dy)(tape)
 
     def test_proj_unsupported(self, dev):
-        """Test if a QuantumFunctionError is raised for a Projector observable"""
+        """Test if a QuantumFunctionError is raised for a Projector observable onto a state
+        vector"""
+        state = np.array([1, 1, 0, 0], requires_grad=False) / np.sqrt(2)
 
         with qml.tape.QuantumTape() as tape:
             qml.CRX(0.1, wires=[0, 1])
-            qml.expval(qml.Projector([0, 1], wires=[0, 1]))
+            qml.expval(qml.Projector(state, wires=[0, 1]))
 
         dy = np.array([1.0])
 
@@ -199,7 +201,7 @@ class TestVectorJacobianProduct:
 
         with qml.tape.QuantumTape() as tape:
             qml.CRX(0.1, wires=[0, 1])
-            qml.expval(qml.Projector([0], wires=[0]) @ qml.PauliZ(0))
+            qml.expval(qml.Projector(state[::2] * np.sqrt(2), wires=[0]) @ qml.PauliZ(1))
 
         with pytest.raises(
             qml.QuantumFunctionError,